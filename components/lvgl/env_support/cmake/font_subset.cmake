@@ -0,0 +1,60 @@
+include_guard(GLOBAL)
+
+set(LV_FONT_SUBSET_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/../../scripts/font_subset.py)
+
+# Generate a subset of a built-in font with only the characters used by an
+# application and add it to the sources of a target.
+#
+#   lv_font_subset(<target> FONT <font.c> NAME <name>
+#                  [CHARS <characters>...] [RANGES <0x20-0x7F,0xB0>...]
+#                  [SCAN <source, translation file or directory>...]
+#                  [LV_INCLUDE <path of lvgl.h>])
+#
+# The font is regenerated when the scanned files change, and CMake runs again
+# when files are added to a scanned directory.
+function(lv_font_subset target)
+  cmake_parse_arguments(SUBSET "" "FONT;NAME;LV_INCLUDE" "CHARS;RANGES;SCAN" ${ARGN})
+  if(NOT SUBSET_FONT OR NOT SUBSET_NAME)
+    message(FATAL_ERROR "lv_font_subset: FONT and NAME are required")
+  endif()
+  if(NOT SUBSET_LV_INCLUDE)
+    set(SUBSET_LV_INCLUDE lvgl.h)
+  endif()
+
+  if(COMMAND idf_build_get_property)
+    idf_build_get_property(python PYTHON)
+  else()
+    find_package(Python3 REQUIRED COMPONENTS Interpreter)
+    set(python ${Python3_EXECUTABLE})
+  endif()
+
+  set(args --font ${SUBSET_FONT} --name ${SUBSET_NAME} --lv-include ${SUBSET_LV_INCLUDE})
+  foreach(chars ${SUBSET_CHARS})
+    list(APPEND args --chars ${chars})
+  endforeach()
+  foreach(range ${SUBSET_RANGES})
+    list(APPEND args --range ${range})
+  endforeach()
+
+  set(depends ${LV_FONT_SUBSET_SCRIPT} ${SUBSET_FONT})
+  foreach(path ${SUBSET_SCAN})
+    list(APPEND args --scan ${path})
+    if(IS_DIRECTORY ${path})
+      file(GLOB_RECURSE scanned CONFIGURE_DEPENDS
+           ${path}/*.c ${path}/*.h ${path}/*.cpp ${path}/*.hpp ${path}/*.cc ${path}/*.cxx
+           ${path}/*.po ${path}/*.pot ${path}/*.json ${path}/*.txt)
+      list(APPEND depends ${scanned})
+    else()
+      list(APPEND depends ${path})
+    endif()
+  endforeach()
+
+  set(output ${CMAKE_CURRENT_BINARY_DIR}/${SUBSET_NAME}.c)
+  add_custom_command(
+    OUTPUT ${output}
+    COMMAND ${python} ${LV_FONT_SUBSET_SCRIPT} ${args} -o ${output}
+    DEPENDS ${depends}
+    COMMENT "Generating the ${SUBSET_NAME} font subset"
+    VERBATIM)
+  target_sources(${target} PRIVATE ${output})
+endfunction()
@@ -172,10 +172,12 @@
     #define LV_DRAW_SW_COMPLEX          1
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /*Allow buffering some shadow calculation.
-        *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
-        #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+        /*Memory budget for caching the blurred corners of shadows.
+        *The shadows with the same width, radius and spread reuse the corners in every stripe and frame.
+        *A corner takes `2 * (shadow_width + radius)^2` bytes.
+        *0: to disable caching
+        *It replaces the deprecated LV_DRAW_SW_SHADOW_CACHE_SIZE which was the largest shadow size in pixels.*/
+        #define LV_DRAW_SW_SHADOW_CACHE_BYTES 0  /*[bytes]*/
 
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
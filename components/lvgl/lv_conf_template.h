@@ -128,6 +128,11 @@
 /*The target buffer size for simple layer chunks.*/
 #define LV_DRAW_LAYER_SIMPLE_BUF_SIZE    (24 * 1024)   /*[bytes]*/
 
+/*Use RGB565A8 (3 bytes/pixel) instead of ARGB8888 (4 bytes/pixel) for the simple layers with alpha channel
+ *if the display is RGB565. The layers need 25% less memory so simple layers are drawn in fewer chunks.
+ *The draw units need to render to RGB565A8 (the software renderer needs `LV_DRAW_SW_SUPPORT_RGB565A8`)*/
+#define LV_DRAW_LAYER_USE_RGB565A8  0
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -169,10 +174,12 @@
     #define LV_DRAW_SW_COMPLEX          1
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /*Allow buffering some shadow calculation.
-        *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
-        #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+        /*Memory budget for caching the blurred corners of shadows.
+        *The shadows with the same width, radius and spread reuse the corners in every stripe and frame.
+        *A corner takes `2 * (shadow_width + radius)^2` bytes.
+        *0: to disable caching
+        *It replaces the deprecated LV_DRAW_SW_SHADOW_CACHE_SIZE which was the largest shadow size in pixels.*/
+        #define LV_DRAW_SW_SHADOW_CACHE_BYTES 0  /*[bytes]*/
 
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
@@ -181,6 +188,18 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /* Memory budget for caching the color maps of gradients.
+     * The same gradient is not recalculated for each stripe of a partial refresh or on every frame.
+     * A map takes about 4 bytes per pixel of the gradient's width (horizontal) or height (vertical)
+     * and 1 kB for complex gradients.
+     * 0: to disable caching */
+    #define LV_DRAW_SW_GRADIENT_CACHE_SIZE (4 * 1024)   /*[bytes]*/
+
+    /* Collect the glyphs of a text line into a coverage buffer and blend them at once
+     * instead of blending every glyph one by one. Used for fonts with line height <= 32 px.
+     * Takes `line_height * clip_area_width` bytes from the scratch memory of the draw unit. */
+    #define LV_DRAW_SW_GLYPH_RUN        1
+
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -369,6 +388,12 @@
  *The main logic is like `LV_CACHE_DEF_SIZE` but for image headers.*/
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/*Memory budget for widgets with `LV_OBJ_FLAG_CACHE_AS_BITMAP`. Such widgets are rendered once
+ *together with their children into a bitmap which is reused until something in them is invalidated.
+ *If the budget is exceeded the least recently used bitmaps are freed.
+ *0: disable the feature and draw the widgets normally*/
+#define LV_OBJ_BITMAP_CACHE_SIZE 0      /*[bytes]*/
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS   2
@@ -529,6 +554,23 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Memory budget for caching the decoded A8 bitmaps of the glyphs of built-in (fmt_txt) fonts.
+ *The glyphs are not unpacked again each time they are drawn, e.g. for each stripe of a partial refresh.
+ *A glyph takes its width * height bytes plus about 100 bytes.
+ *0: to disable caching*/
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (8 * 1024)   /*[bytes]*/
+
+/*Number of cached Unicode letter -> glyph id lookups of built-in (fmt_txt) fonts.
+ *Saves searching the cmaps each time a letter is measured or drawn. Must be a power of 2.
+ *The letters of the first cmap are looked up directly if it's a simple range (e.g. ASCII).
+ *0: to disable caching*/
+#define LV_FONT_FMT_TXT_GID_CACHE_SIZE 64
+
+/*1: Create a hash table of the kerning pairs of the fonts loaded by `lv_binfont_create()`
+ *to find the kerning values in constant time instead of binary searching the pairs.
+ *It takes 7.5..15 bytes per pair. Fonts with kerning classes don't need it.*/
+#define LV_FONT_FMT_TXT_KERN_HASH 0
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -626,6 +668,10 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LINE_CACHE 1     /*Store the line breaks of labels (8 bytes per line) to measure the text only when it changes*/
+    /*Max. size of the A8 bitmap the text of a scrolling label is rendered to once.
+     *While scrolling only the bitmap is drawn at the current offset. 0: disable*/
+    #define LV_LABEL_SCROLL_BITMAP_SIZE 0   /*[bytes]*/
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /*The count of wait chart*/
 #endif
 
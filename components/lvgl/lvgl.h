@@ -40,6 +40,7 @@ extern "C" {
 #include "src/core/lv_group.h"
 #include "src/indev/lv_indev.h"
 #include "src/core/lv_refr.h"
+#include "src/core/lv_obj_bitmap_cache.h"
 #include "src/display/lv_display.h"
 
 #include "src/font/lv_font.h"
@@ -0,0 +1,639 @@
+#!/usr/bin/env python3
+"""
+Create a subset of a built-in (lv_font_conv generated) LVGL font with only the
+characters used by an application.
+
+The characters can be given explicitly or collected from the string literals
+of C sources and from translation files. The glyphs of the output are ordered
+so that consecutive characters become dense FORMAT0_TINY ranges, and only the
+isolated characters go to one SPARSE_TINY list. Unused kerning classes are
+removed too.
+
+Example:
+    font_subset.py --font src/font/lv_font_montserrat_14.c --name app_font_14 \
+                   --scan main/ --scan translations/hu.po -o app_font_14.c
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+CMAP_TYPES = {
+    'LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL': 0,
+    'LV_FONT_FMT_TXT_CMAP_SPARSE_FULL': 1,
+    'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY': 2,
+    'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY': 3,
+}
+
+# Consecutive characters shorter than this go to the sparse list
+MIN_RANGE_LENGTH = 3
+
+SOURCE_EXTENSIONS = ('.c', '.h', '.cpp', '.hpp', '.cc', '.cxx', '.po', '.pot')
+SCAN_EXTENSIONS = SOURCE_EXTENSIONS + ('.json', '.txt')
+
+C_TOKEN_RE = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'|\b[A-Za-z_]\w*\b',
+                        re.DOTALL)
+
+
+def fail(msg):
+    sys.exit('font_subset.py: error: ' + msg)
+
+
+def strip_comments(src):
+    return re.sub(r'/\*.*?\*/|//[^\n]*', '', src, flags=re.DOTALL)
+
+
+def parse_int(s):
+    return int(s, 0)
+
+
+class FontSource:
+    """The data of an lv_font_conv generated C font"""
+
+    def __init__(self, path):
+        with open(path, encoding='utf-8') as f:
+            src = strip_comments(f.read())
+
+        # Keep only the declarations for LVGL v8 and newer
+        src = re.sub(r'^#else\n[^\n]*=\s*\{\n#endif\n', '', src, flags=re.MULTILINE)
+
+        self.path = path
+        self.bitmap = self.array(src, 'glyph_bitmap')
+
+        self.glyphs = []
+        body = self.block(src, r'glyph_dsc\[\]\s*=\s*\{')
+        for g in re.finditer(r'\{([^{}]*)\}', body):
+            fields = dict((k, parse_int(v)) for k, v in re.findall(r'\.(\w+)\s*=\s*(-?\w+)', g.group(1)))
+            self.glyphs.append(fields)
+        if not self.glyphs:
+            fail('no glyph descriptors in ' + path)
+
+        self.cp_to_gid = {}
+        body = self.block(src, r'lv_font_fmt_txt_cmap_t\s+cmaps\[\]\s*=\s*\{')
+        for c in re.finditer(r'\{([^{}]*)\}', body):
+            fields = dict(re.findall(r'\.(\w+)\s*=\s*(\w+)', c.group(1)))
+            self.add_cmap(src, fields)
+
+        dsc = self.fields(self.block(src, r'lv_font_fmt_txt_dsc_t\s+font_dsc\s*=\s*\{'))
+        self.bpp = parse_int(dsc['bpp'])
+        self.kern_scale = parse_int(dsc.get('kern_scale', '0'))
+        self.bitmap_format = parse_int(dsc.get('bitmap_format', '0'))
+
+        self.kern_classes = None
+        self.kern_pairs = None
+        kern_dsc = dsc.get('kern_dsc', 'NULL')
+        if kern_dsc != 'NULL':
+            if parse_int(dsc.get('kern_classes', '0')):
+                k = self.fields(self.block(src, r'lv_font_fmt_txt_kern_classes_t\s+\w+\s*=\s*\{'))
+                self.kern_classes = {
+                    'left': self.array(src, k['left_class_mapping']),
+                    'right': self.array(src, k['right_class_mapping']),
+                    'values': self.array(src, k['class_pair_values']),
+                    'left_cnt': parse_int(k['left_class_cnt']),
+                    'right_cnt': parse_int(k['right_class_cnt']),
+                }
+            else:
+                k = self.fields(self.block(src, r'lv_font_fmt_txt_kern_pair_t\s+\w+\s*=\s*\{'))
+                ids = self.array(src, k['glyph_ids'])
+                values = self.array(src, k['values'])
+                self.kern_pairs = [(ids[i * 2], ids[i * 2 + 1], values[i]) for i in range(parse_int(k['pair_cnt']))]
+
+        font = self.fields(self.block(src, r'lv_font_t\s+\w+\s*=\s*\{'))
+        self.line_height = parse_int(font['line_height'])
+        self.base_line = parse_int(font['base_line'])
+        self.subpx = font.get('subpx', 'LV_FONT_SUBPX_NONE')
+        self.underline_position = parse_int(font.get('underline_position', '0'))
+        self.underline_thickness = parse_int(font.get('underline_thickness', '0'))
+
+    def block(self, src, start):
+        m = re.search(start, src)
+        if not m:
+            fail('"%s" not found in %s' % (start, self.path))
+        depth = 1
+        i = m.end()
+        while depth:
+            if i >= len(src):
+                fail('unterminated block in ' + self.path)
+            if src[i] == '{':
+                depth += 1
+            elif src[i] == '}':
+                depth -= 1
+            i += 1
+        return src[m.end():i - 1]
+
+    def array(self, src, name):
+        body = self.block(src, r'\b' + re.escape(name) + r'\[\]\s*=\s*\{')
+        return [parse_int(v) for v in re.findall(r'-?\b\w+\b', body)]
+
+    @staticmethod
+    def fields(body):
+        # Drop the preprocessor conditions around the fields
+        body = re.sub(r'^\s*#.*$', '', body, flags=re.MULTILINE)
+        return dict(re.findall(r'\.(\w+)\s*=\s*&?([\w-]+)', body))
+
+    def add_cmap(self, src, fields):
+        start = parse_int(fields['range_start'])
+        length = parse_int(fields['range_length'])
+        gid_start = parse_int(fields['glyph_id_start'])
+        cmap_type = CMAP_TYPES[fields['type']]
+        unicode_list = None
+        ofs_list = None
+        if fields.get('unicode_list', 'NULL') != 'NULL':
+            unicode_list = self.array(src, fields['unicode_list'])
+        if fields.get('glyph_id_ofs_list', 'NULL') != 'NULL':
+            ofs_list = self.array(src, fields['glyph_id_ofs_list'])
+
+        if cmap_type == 0:
+            # Characters mapped to the offset of the first one (except itself) are missing
+            for i in range(length):
+                if i == 0 or ofs_list[i] != 0:
+                    self.cp_to_gid.setdefault(start + i, gid_start + ofs_list[i])
+        elif cmap_type == 2:
+            for i in range(length):
+                self.cp_to_gid.setdefault(start + i, gid_start + i)
+        else:
+            for i, rcp in enumerate(unicode_list):
+                gid = gid_start + (ofs_list[i] if cmap_type == 1 else i)
+                self.cp_to_gid.setdefault(start + rcp, gid)
+
+    def glyph_bitmap(self, gid):
+        g = self.glyphs[gid]
+        if g['box_w'] == 0 or g['box_h'] == 0:
+            return []
+        start = g['bitmap_index']
+        end = len(self.bitmap)
+        for other in self.glyphs:
+            if start < other['bitmap_index'] < end:
+                end = other['bitmap_index']
+        return self.bitmap[start:end]
+
+
+def decode_c_string(body):
+    """Convert the content of a C string literal to text. Escaped bytes are decoded as UTF-8."""
+    out = bytearray()
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c != '\\':
+            out += c.encode('utf-8')
+            i += 1
+            continue
+        i += 1
+        if i >= len(body):
+            break
+        c = body[i]
+        simple = {'n': 10, 't': 9, 'r': 13, 'a': 7, 'b': 8, 'f': 12, 'v': 11, '0': 0,
+                  '\\': 92, '"': 34, "'": 39, '?': 63}
+        if c == 'x':
+            m = re.match(r'[0-9a-fA-F]+', body[i + 1:])
+            if m:
+                out.append(int(m.group(0), 16) & 0xFF)
+                i += 1 + len(m.group(0))
+                continue
+        elif c in 'uU':
+            n = 4 if c == 'u' else 8
+            m = re.match(r'[0-9a-fA-F]{%d}' % n, body[i + 1:])
+            if m:
+                out += chr(int(m.group(0), 16)).encode('utf-8', 'ignore')
+                i += 1 + n
+                continue
+        elif c in '01234567':
+            m = re.match(r'[0-7]{1,3}', body[i:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += len(m.group(0))
+            continue
+        elif c in simple:
+            out.append(simple[c])
+            i += 1
+            continue
+        out += c.encode('utf-8')
+        i += 1
+    return out.decode('utf-8', 'ignore')
+
+
+def load_symbols():
+    """Map the LV_SYMBOL_... names to their characters"""
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src', 'font', 'lv_symbol_def.h')
+    symbols = {}
+    try:
+        with open(path, encoding='utf-8') as f:
+            for name, value in re.findall(r'#define\s+(LV_SYMBOL_\w+)\s+"([^"]*)"', f.read()):
+                symbols.setdefault(name, decode_c_string(value))
+    except OSError:
+        pass
+    return symbols
+
+
+def scan_source(text, symbols):
+    chars = set()
+    for m in C_TOKEN_RE.finditer(text):
+        tok = m.group(0)
+        if tok[0] == '"':
+            chars.update(decode_c_string(tok[1:-1]))
+        elif tok in symbols:
+            chars.update(symbols[tok])
+    return chars
+
+
+def scan_json(data):
+    chars = set()
+    if isinstance(data, str):
+        chars.update(data)
+    elif isinstance(data, list):
+        for v in data:
+            chars |= scan_json(v)
+    elif isinstance(data, dict):
+        for v in data.values():
+            chars |= scan_json(v)
+    return chars
+
+
+def scan_file(path, symbols):
+    with open(path, encoding='utf-8', errors='ignore') as f:
+        text = f.read()
+    ext = os.path.splitext(path)[1].lower()
+    if ext in SOURCE_EXTENSIONS:
+        return scan_source(text, symbols)
+    if ext == '.json':
+        try:
+            return scan_json(json.loads(text))
+        except ValueError as e:
+            fail('%s: %s' % (path, e))
+    return set(text)
+
+
+def scan_path(path, symbols):
+    if not os.path.isdir(path):
+        return scan_file(path, symbols)
+    chars = set()
+    for root, dirs, files in os.walk(path):
+        dirs.sort()
+        for name in sorted(files):
+            if name.lower().endswith(SCAN_EXTENSIONS):
+                chars |= scan_file(os.path.join(root, name), symbols)
+    return chars
+
+
+def parse_ranges(text):
+    """E.g. "0x20-0x7F,0xB0" like lv_font_conv's -r option"""
+    cps = set()
+    for part in text.split(','):
+        part = part.strip()
+        if not part:
+            continue
+        m = re.match(r'^(\w+)\s*-\s*(\w+)$', part)
+        try:
+            if m:
+                cps.update(range(parse_int(m.group(1)), parse_int(m.group(2)) + 1))
+            else:
+                cps.add(parse_int(part))
+        except ValueError:
+            fail('invalid range: ' + part)
+    return cps
+
+
+def build_subset(font, cps):
+    """Return the new gid order and the cmaps as (range_start, codepoints, type)"""
+    cps = sorted(cp for cp in cps if cp in font.cp_to_gid)
+
+    runs = []
+    for cp in cps:
+        if runs and runs[-1][-1] + 1 == cp:
+            runs[-1].append(cp)
+        else:
+            runs.append([cp])
+
+    cmaps = []
+    singles = []
+    for run in runs:
+        if len(run) >= MIN_RANGE_LENGTH:
+            cmaps.append((run[0], run, 'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY'))
+        else:
+            singles += run
+
+    # One sparse cmap can have only 16 bit offsets
+    while singles:
+        part = [cp for cp in singles if cp - singles[0] <= 0xFFFF]
+        singles = singles[len(part):]
+        cmaps.append((part[0], part, 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY'))
+
+    # The lookup of the first cmap is the fastest so start with the largest range
+    cmaps.sort(key=lambda c: (c[2] != 'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY', -len(c[1]), c[0]))
+
+    gids = [0]
+    for cmap in cmaps:
+        gids += [font.cp_to_gid[cp] for cp in cmap[1]]
+    return gids, cmaps
+
+
+def format_array(values, fmt=lambda v: str(v), per_line=8, indent='    '):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join(fmt(v) for v in values[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def char_comment(cp):
+    c = chr(cp)
+    if c == '"' or c == '\\':
+        c = '\\' + c
+    return 'U+%04X "%s"' % (cp, c)
+
+
+def generate(font, gids, cmaps, name, opts, lv_include):
+    guard = name.upper()
+    out = []
+    w = out.append
+
+    w('/*******************************************************************************')
+    w(' * Size: subset of %s' % os.path.basename(font.path))
+    w(' * Bpp: %d' % font.bpp)
+    w(' * Opts: %s' % opts)
+    w(' ******************************************************************************/')
+    w('')
+    if lv_include:
+        w('#include "%s"' % lv_include)
+    else:
+        w('#ifdef LV_LVGL_H_INCLUDE_SIMPLE')
+        w('    #include "lvgl.h"')
+        w('#else')
+        w('    #include "lvgl/lvgl.h"')
+        w('#endif')
+    w('')
+    w('#ifndef %s' % guard)
+    w('    #define %s 1' % guard)
+    w('#endif')
+    w('')
+    w('#if %s' % guard)
+    w('')
+
+    cp_of_gid = {}
+    for cmap in cmaps:
+        for cp in cmap[1]:
+            cp_of_gid[len(cp_of_gid) + 1] = cp
+
+    w('/*-----------------')
+    w(' *    BITMAPS')
+    w(' *----------------*/')
+    w('')
+    w('/*Store the image of the glyphs*/')
+    w('static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {')
+    bitmap_index = []
+    size = 0
+    for new_gid in range(1, len(gids)):
+        data = font.glyph_bitmap(gids[new_gid])
+        bitmap_index.append(size)
+        size += len(data)
+        w('    /* %s */' % char_comment(cp_of_gid[new_gid]))
+        if data:
+            w(format_array(data, lambda v: hex(v)) + (',' if new_gid < len(gids) - 1 else ''))
+        w('')
+    if size == 0:
+        w('    0')
+    w('};')
+    w('')
+    w('')
+
+    w('/*---------------------')
+    w(' *  GLYPH DESCRIPTION')
+    w(' *--------------------*/')
+    w('')
+    w('static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {')
+    dscs = ['    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */']
+    for new_gid in range(1, len(gids)):
+        g = font.glyphs[gids[new_gid]]
+        dscs.append('    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}' %
+                    (bitmap_index[new_gid - 1], g['adv_w'], g['box_w'], g['box_h'], g['ofs_x'], g['ofs_y']))
+    w(',\n'.join(dscs))
+    w('};')
+    w('')
+
+    w('/*---------------------')
+    w(' *  CHARACTER MAPPING')
+    w(' *--------------------*/')
+    w('')
+    for i, cmap in enumerate(cmaps):
+        if cmap[2] == 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY':
+            w('static const uint16_t unicode_list_%d[] = {' % i)
+            w(format_array([cp - cmap[0] for cp in cmap[1]], lambda v: hex(v)))
+            w('};')
+            w('')
+    w('/*Collect the unicode lists and glyph_id offsets*/')
+    w('static const lv_font_fmt_txt_cmap_t cmaps[] = {')
+    items = []
+    gid_start = 1
+    for i, cmap in enumerate(cmaps):
+        sparse = cmap[2] == 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY'
+        items.append('    {\n'
+                     '        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n'
+                     '        .unicode_list = %s, .glyph_id_ofs_list = NULL, .list_length = %d, .type = %s\n'
+                     '    }' % (cmap[0], cmap[1][-1] - cmap[0] + 1, gid_start,
+                               'unicode_list_%d' % i if sparse else 'NULL', len(cmap[1]) if sparse else 0, cmap[2]))
+        gid_start += len(cmap[1])
+    w(',\n'.join(items))
+    w('};')
+    w('')
+
+    kern = subset_kerning(font, gids)
+    if kern:
+        w('/*-----------------')
+        w(' *    KERNING')
+        w(' *----------------*/')
+        w('')
+        out += generate_kerning(kern, len(gids))
+
+    w('/*--------------------')
+    w(' *  ALL CUSTOM DATA')
+    w(' *--------------------*/')
+    w('')
+    w('/*Store all the custom data of the font*/')
+    w('static const lv_font_fmt_txt_dsc_t font_dsc = {')
+    w('    .glyph_bitmap = glyph_bitmap,')
+    w('    .glyph_dsc = glyph_dsc,')
+    w('    .cmaps = cmaps,')
+    w('    .kern_dsc = %s,' % ('&kern_' + kern[0] if kern else 'NULL'))
+    w('    .kern_scale = %d,' % font.kern_scale)
+    w('    .cmap_num = %d,' % len(cmaps))
+    w('    .bpp = %d,' % font.bpp)
+    w('    .kern_classes = %d,' % (1 if kern and kern[0] == 'classes' else 0))
+    w('    .bitmap_format = %d,' % font.bitmap_format)
+    w('};')
+    w('')
+    w('')
+
+    w('/*-----------------')
+    w(' *  PUBLIC FONT')
+    w(' *----------------*/')
+    w('')
+    w('/*Initialize a public general font descriptor*/')
+    w('const lv_font_t %s = {' % name)
+    w('    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph\'s data*/')
+    w('    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph\'s bitmap*/')
+    w('    .line_height = %d,          /*The maximum line height required by the font*/' % font.line_height)
+    w('    .base_line = %d,             /*Baseline measured from the bottom of the line*/' % font.base_line)
+    w('    .subpx = %s,' % font.subpx)
+    w('    .underline_position = %d,' % font.underline_position)
+    w('    .underline_thickness = %d,' % font.underline_thickness)
+    w('    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */')
+    w('};')
+    w('')
+    w('#endif /*#if %s*/' % guard)
+    w('')
+    return '\n'.join(out)
+
+
+def subset_kerning(font, gids):
+    """Return the kerning of the subset as ('classes', (left, right, values, left_cnt, right_cnt)),
+    ('pairs', [(left, right, value)]) or None"""
+    new_gid = dict((gid, i) for i, gid in enumerate(gids) if i)
+    if font.kern_pairs is not None:
+        pairs = sorted((new_gid[l], new_gid[r], v) for l, r, v in font.kern_pairs
+                       if l in new_gid and r in new_gid and v)
+        return ('pairs', pairs) if pairs else None
+
+    if font.kern_classes is None:
+        return None
+
+    k = font.kern_classes
+    left = [k['left'][gid] if gid < len(k['left']) else 0 for gid in gids]
+    right = [k['right'][gid] if gid < len(k['right']) else 0 for gid in gids]
+    left[0] = right[0] = 0
+
+    def value(lc, rc):
+        return k['values'][(lc - 1) * k['right_cnt'] + (rc - 1)]
+
+    pairs = [(l, r, value(left[l], right[r])) for l in range(1, len(gids)) for r in range(1, len(gids))
+             if left[l] and right[r] and value(left[l], right[r])]
+    if not pairs:
+        return None
+
+    # Keep only the classes used by the remaining glyphs
+    left_used = sorted(set(c for c in left if c))
+    right_used = sorted(set(c for c in right if c))
+
+    # With a few glyphs the pairs can be smaller than the class table
+    ids_size = 4 if len(gids) > 256 else 2
+    if len(pairs) * (ids_size + 1) < len(left_used) * len(right_used) + len(gids) * 2:
+        return ('pairs', pairs)
+
+    left_new = dict((c, i + 1) for i, c in enumerate(left_used))
+    right_new = dict((c, i + 1) for i, c in enumerate(right_used))
+    values = [value(lc, rc) for lc in left_used for rc in right_used]
+    return ('classes', ([left_new.get(c, 0) for c in left], [right_new.get(c, 0) for c in right],
+                        values, len(left_used), len(right_used)))
+
+
+def generate_kerning(kern, glyph_cnt):
+    out = []
+    w = out.append
+    if kern[0] == 'classes':
+        left, right, values, left_cnt, right_cnt = kern[1]
+        w('/*Map glyph_ids to kern left classes*/')
+        w('static const uint8_t kern_left_class_mapping[] = {')
+        w(format_array(left))
+        w('};')
+        w('')
+        w('/*Map glyph_ids to kern right classes*/')
+        w('static const uint8_t kern_right_class_mapping[] = {')
+        w(format_array(right))
+        w('};')
+        w('')
+        w('/*Kern values between classes*/')
+        w('static const int8_t kern_class_values[] = {')
+        w(format_array(values))
+        w('};')
+        w('')
+        w('')
+        w('/*Collect the kern class\' data in one place*/')
+        w('static const lv_font_fmt_txt_kern_classes_t kern_classes = {')
+        w('    .class_pair_values   = kern_class_values,')
+        w('    .left_class_mapping  = kern_left_class_mapping,')
+        w('    .right_class_mapping = kern_right_class_mapping,')
+        w('    .left_class_cnt      = %d,' % left_cnt)
+        w('    .right_class_cnt     = %d,' % right_cnt)
+        w('};')
+        w('')
+    else:
+        pairs = kern[1]
+        ids_16 = glyph_cnt > 256
+        w('/*Pair left and right glyphs for kerning*/')
+        w('static const %s kern_pair_glyph_ids[] = {' % ('uint16_t' if ids_16 else 'uint8_t'))
+        w(format_array([i for p in pairs for i in p[:2]]))
+        w('};')
+        w('')
+        w('/* Kerning between the respective left and right glyphs')
+        w(' * 4.4 format which needs to scaled with `kern_scale`*/')
+        w('static const int8_t kern_pair_values[] = {')
+        w(format_array([p[2] for p in pairs]))
+        w('};')
+        w('')
+        w('/*Collect the kern pair\'s data in one place*/')
+        w('static const lv_font_fmt_txt_kern_pair_t kern_pairs = {')
+        w('    .glyph_ids = kern_pair_glyph_ids,')
+        w('    .values = kern_pair_values,')
+        w('    .pair_cnt = %d,' % len(pairs))
+        w('    .glyph_ids_size = %d' % (1 if ids_16 else 0))
+        w('};')
+        w('')
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Create a subset of a built-in LVGL font with the used characters only')
+    parser.add_argument('--font', required=True, help='the lv_font_conv generated C file of the font')
+    parser.add_argument('--name', required=True, help='the name of the lv_font_t variable to generate')
+    parser.add_argument('--chars', action='append', default=[], help='characters to include')
+    parser.add_argument('--range', action='append', default=[], help='code points to include, e.g. 0x20-0x7F,0xB0')
+    parser.add_argument('--scan', action='append', default=[],
+                        help='C sources, translation (.po, .json) or text files or directories to collect the '
+                             'characters of the string literals from')
+    parser.add_argument('--lv-include', help='the path of lvgl.h to include instead of the default one')
+    parser.add_argument('-o', '--output', required=True, help='the C file to write')
+    args = parser.parse_args()
+
+    if not re.match(r'^[A-Za-z_]\w*$', args.name):
+        fail('invalid font name: ' + args.name)
+
+    symbols = load_symbols()
+    chars = set()
+    for c in args.chars:
+        chars.update(c)
+    for path in args.scan:
+        if not os.path.exists(path):
+            fail('no such file or directory: ' + path)
+        chars |= scan_path(path, symbols)
+
+    cps = set(ord(c) for c in chars if ord(c) >= 0x20 or c == '\t')
+    for r in args.range:
+        cps |= parse_ranges(r)
+    # Tabs are drawn as spaces
+    if 0x09 in cps:
+        cps.discard(0x09)
+        cps.add(0x20)
+
+    font = FontSource(args.font)
+    missing = sorted(cp for cp in cps if cp not in font.cp_to_gid)
+    if missing:
+        print('font_subset.py: %d characters are not in %s: %s' %
+              (len(missing), os.path.basename(args.font), ' '.join('U+%04X' % cp for cp in missing[:20])),
+              file=sys.stderr)
+
+    gids, cmaps = build_subset(font, cps)
+    opts = '--font %s --name %s, %d glyphs' % (os.path.basename(args.font), args.name, len(gids) - 1)
+    text = generate(font, gids, cmaps, args.name, opts, args.lv_include)
+
+    # Don't touch the output if it's the same to avoid needless rebuilds
+    try:
+        with open(args.output, encoding='utf-8') as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
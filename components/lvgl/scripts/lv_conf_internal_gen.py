@@ -49,6 +49,7 @@ fout.write(
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_SSE2         3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 /* Handle special Kconfig options */
@@ -214,6 +215,20 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
     #endif
 #endif
 
+/*LV_DRAW_SW_SHADOW_CACHE_SIZE was the largest cached shadow size in pixels.
+ *Convert it to the budget of one corner of that size.*/
+#if !defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && defined(CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
+#endif
+
+#if LV_DRAW_SW_COMPLEX && defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+    #warning "LV_DRAW_SW_SHADOW_CACHE_SIZE is deprecated, use LV_DRAW_SW_SHADOW_CACHE_BYTES. Please update lv_conf.h or run menuconfig again."
+    #if LV_DRAW_SW_SHADOW_CACHE_BYTES == 0
+        #undef LV_DRAW_SW_SHADOW_CACHE_BYTES
+        #define LV_DRAW_SW_SHADOW_CACHE_BYTES (2 * LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #endif
+#endif
+
 /*If running without lv_conf.h add typedefs with default value*/
 #ifdef LV_CONF_SKIP
     #if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)    /*Disable warnings for Visual Studio*/
@@ -31,7 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
+#if LV_USE_FONT_COMPRESSED || LV_FONT_FMT_TXT_GID_CACHE_SIZE > 0
 #include "../font/lv_font_fmt_txt_private.h"
 #endif
 
@@ -121,13 +121,21 @@ typedef struct lv_global_t {
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
 
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+    lv_cache_t * obj_bitmap_cache;
+    lv_ll_t obj_bitmap_acquired_ll;
+#endif
+
     lv_draw_global_info_t draw_info;
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    lv_draw_sw_shadow_cache_t sw_shadow_cache;
+#if defined(LV_DRAW_SW_SHADOW_CACHE_BYTES) && LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    lv_cache_t * sw_shadow_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if defined(LV_DRAW_SW_GRADIENT_CACHE_SIZE) && LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    lv_cache_t * sw_grad_cache;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -189,6 +197,14 @@ typedef struct lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    lv_cache_t * font_fmt_txt_glyph_cache;
+#endif
+
+#if LV_FONT_FMT_TXT_GID_CACHE_SIZE > 0
+    lv_font_fmt_txt_gid_cache_entry_t font_fmt_txt_gid_cache[LV_FONT_FMT_TXT_GID_CACHE_SIZE];
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
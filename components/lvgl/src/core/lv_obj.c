@@ -12,6 +12,7 @@
 #include "lv_obj_style_private.h"
 #include "lv_obj_event_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_bitmap_cache_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "lv_refr.h"
@@ -279,6 +280,10 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+    if(f & LV_OBJ_FLAG_CACHE_AS_BITMAP) lv_obj_bitmap_cache_drop(obj);
+#endif
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         if(lv_obj_is_layout_positioned(obj)) {
@@ -525,6 +530,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
 
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+    lv_obj_bitmap_cache_drop(obj);
+#endif
+
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
@@ -0,0 +1,300 @@
+/**
+ * @file lv_obj_bitmap_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_bitmap_cache_private.h"
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+
+#include "lv_obj_private.h"
+#include "lv_obj_event_private.h"
+#include "lv_obj_draw_private.h"
+#include "lv_refr_private.h"
+#include "../display/lv_display_private.h"
+#include "../draw/lv_draw_private.h"
+#include "../draw/lv_draw_image.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/lv_area_private.h"
+#include "lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CACHE_NAME  "OBJ_BITMAP"
+
+#define obj_bitmap_cache_p (LV_GLOBAL_DEFAULT()->obj_bitmap_cache)
+#define obj_bitmap_acquired_ll_p (&(LV_GLOBAL_DEFAULT()->obj_bitmap_acquired_ll))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    const lv_obj_t * obj;
+    lv_draw_buf_t * draw_buf;
+} obj_bitmap_cache_data_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_cache_compare_res_t obj_bitmap_cache_compare_cb(const obj_bitmap_cache_data_t * lhs,
+                                                          const obj_bitmap_cache_data_t * rhs);
+static void obj_bitmap_cache_free_cb(obj_bitmap_cache_data_t * entry, void * user_data);
+static void evict_until(uint32_t size);
+static lv_color_format_t get_color_format(lv_obj_t * obj, const lv_area_t * area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_obj_bitmap_cache_init(uint32_t size)
+{
+    if(obj_bitmap_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    obj_bitmap_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(obj_bitmap_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) obj_bitmap_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) obj_bitmap_cache_free_cb,
+    });
+
+    lv_ll_init(obj_bitmap_acquired_ll_p, sizeof(lv_cache_entry_t *));
+
+    lv_cache_set_name(obj_bitmap_cache_p, CACHE_NAME);
+    return obj_bitmap_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_obj_bitmap_cache_deinit(void)
+{
+    if(obj_bitmap_cache_p == NULL) return;
+
+    lv_obj_bitmap_cache_release_all();
+    lv_cache_destroy(obj_bitmap_cache_p, NULL);
+    obj_bitmap_cache_p = NULL;
+}
+
+void lv_obj_bitmap_cache_resize(uint32_t new_size, bool evict_now)
+{
+    lv_cache_set_max_size(obj_bitmap_cache_p, new_size, NULL);
+    if(evict_now) {
+        evict_until(new_size);
+    }
+}
+
+void lv_obj_bitmap_cache_drop(const lv_obj_t * obj)
+{
+    if(obj_bitmap_cache_p == NULL) return;
+
+    if(obj == NULL) {
+        lv_cache_drop_all(obj_bitmap_cache_p, NULL);
+        return;
+    }
+
+    obj_bitmap_cache_data_t search_key;
+    search_key.obj = obj;
+    lv_cache_drop(obj_bitmap_cache_p, &search_key, NULL);
+}
+
+uint32_t lv_obj_bitmap_cache_get_size(void)
+{
+    if(obj_bitmap_cache_p == NULL) return 0;
+    return lv_cache_get_size(obj_bitmap_cache_p, NULL);
+}
+
+void lv_obj_bitmap_cache_invalidate(const lv_obj_t * obj)
+{
+    while(obj) {
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_AS_BITMAP)) {
+            lv_obj_bitmap_cache_drop(obj);
+        }
+        obj = obj->parent;
+    }
+}
+
+lv_result_t lv_obj_bitmap_cache_draw(lv_layer_t * layer, lv_obj_t * obj)
+{
+    if(!lv_cache_is_enabled(obj_bitmap_cache_p)) return LV_RESULT_INVALID;
+
+    /*The children can't be clipped to the bitmap*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return LV_RESULT_INVALID;
+
+    lv_area_t obj_area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_area);
+    lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+
+    int32_t w = lv_area_get_width(&obj_area);
+    int32_t h = lv_area_get_height(&obj_area);
+    if(w <= 0 || h <= 0) return LV_RESULT_INVALID;
+
+    obj_bitmap_cache_data_t search_key;
+    search_key.obj = obj;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(obj_bitmap_cache_p, &search_key, NULL);
+    if(entry) {
+        /*Only the position can change without invalidating the children (e.g. scrolling the parent),
+         *if the size has changed too render again*/
+        obj_bitmap_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+        if(cached_data->draw_buf->header.w != (uint32_t)w || cached_data->draw_buf->header.h != (uint32_t)h) {
+            lv_cache_release(obj_bitmap_cache_p, entry, NULL);
+            lv_cache_drop(obj_bitmap_cache_p, &search_key, NULL);
+            entry = NULL;
+        }
+    }
+
+    bool render = false;
+    if(entry == NULL) {
+        lv_color_format_t cf = get_color_format(obj, &obj_area);
+        search_key.slot.size = lv_draw_buf_width_to_stride(w, cf) * h;
+        if(cf == LV_COLOR_FORMAT_RGB565A8) search_key.slot.size += search_key.slot.size / 2;   /*The alpha plane*/
+        if(search_key.slot.size > lv_cache_get_max_size(obj_bitmap_cache_p, NULL)) {
+            LV_LOG_INFO("%p is too large to cache as bitmap", (void *)obj);
+            return LV_RESULT_INVALID;
+        }
+
+        /*Make room for the new bitmap before allocating it*/
+        evict_until(lv_cache_get_max_size(obj_bitmap_cache_p, NULL) - search_key.slot.size);
+
+        search_key.draw_buf = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+        if(search_key.draw_buf == NULL) {
+            LV_LOG_WARN("Couldn't allocate bitmap for %p", (void *)obj);
+            return LV_RESULT_INVALID;
+        }
+
+        if(lv_color_format_has_alpha(cf)) {
+            lv_draw_buf_clear(search_key.draw_buf, NULL);
+        }
+
+        entry = lv_cache_add(obj_bitmap_cache_p, &search_key, NULL);
+        if(entry == NULL) {
+            lv_draw_buf_destroy(search_key.draw_buf);
+            return LV_RESULT_INVALID;
+        }
+        render = true;
+    }
+
+    /*The draw task can be executed later so keep the bitmap alive until the refresh is ready*/
+    lv_cache_entry_t ** acquired = lv_ll_ins_tail(obj_bitmap_acquired_ll_p);
+    LV_ASSERT_MALLOC(acquired);
+    if(acquired == NULL) {
+        lv_cache_release(obj_bitmap_cache_p, entry, NULL);
+        if(render) lv_cache_drop(obj_bitmap_cache_p, &search_key, NULL);
+        return LV_RESULT_INVALID;
+    }
+    *acquired = entry;
+
+    obj_bitmap_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    lv_draw_image_dsc_t draw_dsc;
+    lv_draw_image_dsc_init(&draw_dsc);
+    draw_dsc.base.obj = obj;
+
+    if(render) {
+        /*Render the widget into the bitmap as a layer. The layer is blended when all its draw tasks
+         *are ready, but the bitmap is not freed with the layer as it stays in the cache.*/
+        lv_layer_t * new_layer = lv_draw_layer_create(layer, cached_data->draw_buf->header.cf, &obj_area);
+        if(new_layer == NULL) {
+            /*It's acquired so it will be freed when released at the end of the refresh*/
+            lv_cache_drop(obj_bitmap_cache_p, &search_key, NULL);
+            return LV_RESULT_INVALID;
+        }
+        new_layer->draw_buf = cached_data->draw_buf;
+        new_layer->draw_buf_external = true;
+        lv_obj_redraw(new_layer, obj);
+
+        draw_dsc.src = new_layer;
+        lv_draw_layer(layer, &draw_dsc, &obj_area);
+    }
+    else {
+        draw_dsc.src = cached_data->draw_buf;
+        lv_draw_image(layer, &draw_dsc, &obj_area);
+    }
+
+    return LV_RESULT_OK;
+}
+
+void lv_obj_bitmap_cache_release_all(void)
+{
+    if(obj_bitmap_cache_p == NULL) return;
+
+    lv_cache_entry_t ** entry;
+    LV_LL_READ(obj_bitmap_acquired_ll_p, entry) {
+        lv_cache_release(obj_bitmap_cache_p, *entry, NULL);
+    }
+    lv_ll_clear(obj_bitmap_acquired_ll_p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t obj_bitmap_cache_compare_cb(const obj_bitmap_cache_data_t * lhs,
+                                                          const obj_bitmap_cache_data_t * rhs)
+{
+    if(lhs->obj != rhs->obj) {
+        return lhs->obj > rhs->obj ? 1 : -1;
+    }
+    return 0;
+}
+
+static void obj_bitmap_cache_free_cb(obj_bitmap_cache_data_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*The decoders might have seen the bitmap as a variable image, forget it*/
+    lv_image_cache_drop(entry->draw_buf);
+    lv_draw_buf_destroy(entry->draw_buf);
+}
+
+/**
+ * Evict the least recently used bitmaps which are not in use until the cache is not larger than `size`.
+ * Unlike `lv_cache_reserve` it returns if all the remaining bitmaps are in use.
+ * @param size      the maximum size of the cache in bytes
+ */
+static void evict_until(uint32_t size)
+{
+    while(lv_cache_get_size(obj_bitmap_cache_p, NULL) > size) {
+        if(!lv_cache_evict_one(obj_bitmap_cache_p, NULL)) break;
+    }
+}
+
+/**
+ * Use the native color format if the widget fully covers its bitmap, else use a format with alpha channel.
+ * On RGB565 displays it's RGB565A8 (3 bytes per pixel) even if the layers are ARGB8888, as the bitmaps
+ * are neither transformed nor masked.
+ * @param obj       pointer to a widget
+ * @param area      the area of the bitmap
+ * @return          the color format of the bitmap
+ */
+static lv_color_format_t get_color_format(lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_area_is_in(area, &obj->coords, 0)) {
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = area;
+        lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+        if(info.res == LV_COVER_RES_COVER) return LV_COLOR_FORMAT_NATIVE;
+    }
+
+#if LV_DRAW_SW_SUPPORT_RGB565A8
+    if(lv_refr_get_disp_refreshing()->color_format == LV_COLOR_FORMAT_RGB565) return LV_COLOR_FORMAT_RGB565A8;
+#endif
+
+    return LV_COLOR_FORMAT_ARGB8888;
+}
+
+#endif /*LV_OBJ_BITMAP_CACHE_SIZE > 0*/
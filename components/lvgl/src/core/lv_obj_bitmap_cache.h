@@ -0,0 +1,64 @@
+/**
+ * @file lv_obj_bitmap_cache.h
+ *
+ */
+
+#ifndef LV_OBJ_BITMAP_CACHE_H
+#define LV_OBJ_BITMAP_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_types.h"
+
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Resize the cache of the widgets having `LV_OBJ_FLAG_CACHE_AS_BITMAP`.
+ * If set to 0, the cache will be disabled and the widgets are drawn normally.
+ * @param new_size  new size of the cache in bytes
+ * @param evict_now true: evict the bitmaps exceeding the new size now, false: wait for the next cache cleanup
+ */
+void lv_obj_bitmap_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Drop the cached bitmap of a widget. It will be rendered again when it's drawn next time.
+ * Normally it's not required to call it as invalidating a widget or any of its children drops the bitmap.
+ * @param obj       pointer to a widget, or NULL to drop all the cached bitmaps
+ */
+void lv_obj_bitmap_cache_drop(const lv_obj_t * obj);
+
+/**
+ * Get the number of bytes currently used by the cached bitmaps
+ * @return          the used memory in bytes
+ */
+uint32_t lv_obj_bitmap_cache_get_size(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_OBJ_BITMAP_CACHE_SIZE > 0*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_BITMAP_CACHE_H*/
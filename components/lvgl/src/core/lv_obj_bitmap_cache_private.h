@@ -0,0 +1,78 @@
+/**
+ * @file lv_obj_bitmap_cache_private.h
+ *
+ */
+
+#ifndef LV_OBJ_BITMAP_CACHE_PRIVATE_H
+#define LV_OBJ_BITMAP_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_bitmap_cache.h"
+
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the cache of widget bitmaps
+ * @param size      size of the cache in bytes
+ * @return          LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed
+ */
+lv_result_t lv_obj_bitmap_cache_init(uint32_t size);
+
+/**
+ * Free all the cached bitmaps and the cache itself
+ */
+void lv_obj_bitmap_cache_deinit(void);
+
+/**
+ * Drop the cached bitmap of `obj` and all its parents as something has changed in them.
+ * Called when an area of `obj` is invalidated.
+ * @param obj       pointer to the invalidated widget
+ */
+void lv_obj_bitmap_cache_invalidate(const lv_obj_t * obj);
+
+/**
+ * Draw a widget having `LV_OBJ_FLAG_CACHE_AS_BITMAP` from its cached bitmap.
+ * If there is no bitmap yet the widget and its children are rendered into a new one first.
+ * The bitmap is kept referenced until `lv_obj_bitmap_cache_release_all` is called.
+ * @param layer     pointer to the layer where the widget should be drawn
+ * @param obj       pointer to the widget
+ * @return          LV_RESULT_OK: the bitmap was drawn;
+ *                  LV_RESULT_INVALID: the widget can't be cached, it should be drawn normally
+ */
+lv_result_t lv_obj_bitmap_cache_draw(lv_layer_t * layer, lv_obj_t * obj);
+
+/**
+ * Release the bitmaps used during a refresh so that they can be evicted again.
+ * Should be called when all the draw tasks are ready.
+ */
+void lv_obj_bitmap_cache_release_all(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_OBJ_BITMAP_CACHE_SIZE > 0*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_BITMAP_CACHE_PRIVATE_H*/
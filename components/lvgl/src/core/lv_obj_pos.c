@@ -14,6 +14,7 @@
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
+#include "lv_obj_bitmap_cache_private.h"
 #include "../core/lv_global.h"
 
 /*********************
@@ -814,6 +815,11 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+    /*Drop the bitmaps even if the area is not visible now as it can be scrolled in later*/
+    lv_obj_bitmap_cache_invalidate(obj);
+#endif
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
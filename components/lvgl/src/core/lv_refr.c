@@ -10,9 +10,11 @@
 #include "lv_obj_draw_private.h"
 #include "../misc/lv_area_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
+#include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/lv_draw_mask_private.h"
 #include "lv_obj_private.h"
 #include "lv_obj_event_private.h"
+#include "lv_obj_bitmap_cache_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../tick/lv_tick.h"
@@ -48,6 +50,7 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
+static lv_display_rotation_t get_render_rotation(lv_display_t * disp);
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
@@ -74,10 +77,16 @@ static void wait_for_flushing(lv_display_t * disp);
  */
 void lv_refr_init(void)
 {
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+    lv_obj_bitmap_cache_init(LV_OBJ_BITMAP_CACHE_SIZE);
+#endif
 }
 
 void lv_refr_deinit(void)
 {
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+    lv_obj_bitmap_cache_deinit();
+#endif
 }
 
 void lv_refr_now(lv_display_t * disp)
@@ -190,7 +199,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 lv_area_t bottom = obj->coords;
                 bottom.y1 = bottom.y2 - rout + 1;
                 if(lv_area_intersect(&bottom, &bottom, &clip_area_ori)) {
-                    layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &bottom);
+                    layer_children = lv_draw_layer_create(layer, lv_draw_layer_get_alpha_color_format(), &bottom);
 
                     for(i = 0; i < child_cnt; i++) {
                         lv_obj_t * child = obj->spec_attr->children[i];
@@ -211,7 +220,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 lv_area_t top = obj->coords;
                 top.y2 = top.y1 + rout - 1;
                 if(lv_area_intersect(&top, &top, &clip_area_ori)) {
-                    layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &top);
+                    layer_children = lv_draw_layer_create(layer, lv_draw_layer_get_alpha_color_format(), &top);
 
                     for(i = 0; i < child_cnt; i++) {
                         lv_obj_t * child = obj->spec_attr->children[i];
@@ -419,12 +428,21 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
     disp_refr->inv_p = 0;
 
+#if LV_USE_DRAW_SW
+    /*Only after rendering, idle refreshes say nothing about the needed memory*/
+    lv_draw_sw_scratch_shrink();
+#endif
+
 refr_finish:
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_cleanup();
 #endif
 
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+    lv_obj_bitmap_cache_release_all();
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -544,6 +562,8 @@ static void refr_sync_areas(void)
          * @todo Resize SDL window will trigger crash because of sync_area is larger than disp_area
          */
         lv_area_intersect(sync_area, sync_area, &disp_area);
+        /*The buffers store the pixels in the orientation of the display*/
+        if(get_render_rotation(disp_refr) != LV_DISPLAY_ROTATION_0) lv_display_rotate_area(disp_refr, sync_area);
         lv_draw_buf_copy(off_screen, sync_area, on_screen, sync_area);
     }
 
@@ -597,12 +617,18 @@ static void refr_invalid_areas(void)
  */
 static void layer_reshape_draw_buf(lv_layer_t * layer, uint32_t stride)
 {
-    lv_draw_buf_t * ret = lv_draw_buf_reshape(
-                              layer->draw_buf,
-                              layer->color_format,
-                              lv_area_get_width(&layer->buf_area),
-                              lv_area_get_height(&layer->buf_area),
-                              stride);
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+
+    /*With rotated rendering the buffer has the orientation of the display*/
+    if(layer->rotation == LV_DISPLAY_ROTATION_90 || layer->rotation == LV_DISPLAY_ROTATION_270) {
+        int32_t tmp = w;
+        w = h;
+        h = tmp;
+        stride = LV_STRIDE_AUTO;
+    }
+
+    lv_draw_buf_t * ret = lv_draw_buf_reshape(layer->draw_buf, layer->color_format, w, h, stride);
     LV_UNUSED(ret);
     LV_ASSERT_NULL(ret);
 }
@@ -616,6 +642,7 @@ static void refr_area(const lv_area_t * area_p)
     LV_PROFILER_BEGIN;
     lv_layer_t * layer = disp_refr->layer_head;
     layer->draw_buf = disp_refr->buf_act;
+    layer->rotation = get_render_rotation(disp_refr);
 
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     lv_matrix_identity(&layer->matrix);
@@ -713,6 +740,12 @@ static void refr_area_part(lv_layer_t * layer)
         if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
             /*The area always starts at 0;0*/
             lv_area_move(&a, -disp_refr->refreshed_area.x1, -disp_refr->refreshed_area.y1);
+            if(layer->rotation == LV_DISPLAY_ROTATION_90 || layer->rotation == LV_DISPLAY_ROTATION_270) {
+                lv_area_set(&a, 0, 0, lv_area_get_height(&a) - 1, lv_area_get_width(&a) - 1);
+            }
+        }
+        else if(layer->rotation != LV_DISPLAY_ROTATION_0) {
+            lv_display_rotate_area(disp_refr, &a);
         }
 
         lv_draw_buf_clear(layer->draw_buf, &a);
@@ -1029,6 +1062,12 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
 
     lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_AS_BITMAP) &&
+           lv_obj_bitmap_cache_draw(layer, obj) == LV_RESULT_OK) {
+            return;
+        }
+#endif
         lv_obj_redraw(layer, obj);
     }
     else {
@@ -1037,14 +1076,23 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
         lv_result_t res = layer_get_area(layer, obj, layer_type, &layer_area_full, &obj_draw_size);
         if(res != LV_RESULT_OK) return;
 
+        /*The software renderer can't apply bitmap masks on RGB565A8 layers and
+         *transforming RGB565A8 would blend the color of the transparent pixels into the edges*/
+        lv_color_format_t alpha_cf = LV_COLOR_FORMAT_ARGB8888;
+        if(layer_type == LV_LAYER_TYPE_SIMPLE && lv_obj_get_style_bitmap_mask_src(obj, 0) == NULL) {
+            alpha_cf = lv_draw_layer_get_alpha_color_format();
+        }
+
         /*Simple layers can be subdivided into smaller layers*/
         uint32_t max_rgb_row_height = lv_area_get_height(&layer_area_full);
-        uint32_t max_argb_row_height = lv_area_get_height(&layer_area_full);
+        uint32_t max_alpha_row_height = lv_area_get_height(&layer_area_full);
         if(layer_type == LV_LAYER_TYPE_SIMPLE) {
             int32_t w = lv_area_get_width(&layer_area_full);
             uint8_t px_size = lv_color_format_get_size(disp_refr->color_format);
+            /*RGB565A8 has a 2 bytes RGB565 and a 1 byte alpha plane*/
+            uint8_t alpha_px_size = alpha_cf == LV_COLOR_FORMAT_RGB565A8 ? 3 : sizeof(lv_color32_t);
             max_rgb_row_height = LV_DRAW_LAYER_SIMPLE_BUF_SIZE / w / px_size;
-            max_argb_row_height = LV_DRAW_LAYER_SIMPLE_BUF_SIZE / w / sizeof(lv_color32_t);
+            max_alpha_row_height = LV_DRAW_LAYER_SIMPLE_BUF_SIZE / w / alpha_px_size;
         }
 
         lv_area_t layer_area_act;
@@ -1054,18 +1102,18 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
         layer_area_act.y2 = layer_area_full.y1;
 
         while(layer_area_act.y2 < layer_area_full.y2) {
-            /* Test with an RGB layer size (which is larger than the ARGB layer size)
-             * If it really doesn't need alpha use it. Else switch to the ARGB size*/
+            /* Test with an RGB layer size (which is larger than the layer size with alpha channel)
+             * If it really doesn't need alpha use it. Else switch to the size with alpha channel*/
             layer_area_act.y2 = layer_area_act.y1 + max_rgb_row_height - 1;
             if(layer_area_act.y2 > layer_area_full.y2) layer_area_act.y2 = layer_area_full.y2;
             bool area_need_alpha = alpha_test_area_on_obj(obj, &layer_area_act);
             if(area_need_alpha) {
-                layer_area_act.y2 = layer_area_act.y1 + max_argb_row_height - 1;
+                layer_area_act.y2 = layer_area_act.y1 + max_alpha_row_height - 1;
                 if(layer_area_act.y2 > layer_area_full.y2) layer_area_act.y2 = layer_area_full.y2;
             }
 
             lv_layer_t * new_layer = lv_draw_layer_create(layer,
-                                                          area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
+                                                          area_need_alpha ? alpha_cf : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
             lv_obj_redraw(new_layer, obj);
 
             lv_point_t pivot = {
@@ -1111,8 +1159,16 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
     lv_color_format_t cf = disp->color_format;
     uint32_t stride = lv_draw_buf_width_to_stride(area_w, cf);
     uint32_t overhead = LV_COLOR_INDEXED_PALETTE_SIZE(cf) * sizeof(lv_color32_t);
+    uint32_t buf_size = disp->buf_act->data_size - overhead;
 
-    int32_t max_row = (uint32_t)(disp->buf_act->data_size - overhead) / stride;
+    int32_t max_row = buf_size / stride;
+
+    lv_display_rotation_t rotation = get_render_rotation(disp);
+    if(rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270) {
+        /*The rows of the area are the columns of the rotated buffer*/
+        max_row = buf_size / area_w / lv_color_format_get_size(cf);
+        while(max_row > 0 && lv_draw_buf_width_to_stride(max_row, cf) * area_w > buf_size) max_row--;
+    }
 
     if(max_row > area_h) max_row = area_h;
 
@@ -1146,6 +1202,24 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
     return max_row;
 }
 
+/**
+ * Get the rotation with which the display's layer should be rendered
+ * @param disp  pointer to a display
+ * @return      the rotation of the display with rotated rendering, else `LV_DISPLAY_ROTATION_0`
+ */
+static lv_display_rotation_t get_render_rotation(lv_display_t * disp)
+{
+    if(!disp->rotated_rendering) return LV_DISPLAY_ROTATION_0;
+
+    /*The blending can write whole pixels only in any order*/
+    if(lv_color_format_get_bpp(disp->color_format) < 8 || disp->color_format == LV_COLOR_FORMAT_RGB565A8 ||
+       LV_COLOR_FORMAT_IS_INDEXED(disp->color_format)) {
+        return LV_DISPLAY_ROTATION_0;
+    }
+
+    return disp->rotation;
+}
+
 /**
  * Flush the content of the draw buffer
  */
@@ -1175,7 +1249,14 @@ static void draw_buf_flush(lv_display_t * disp)
     bool flushing_last = disp->flushing_last;
 
     if(disp->flush_cb) {
-        call_flush_cb(disp, &disp->refreshed_area, layer->draw_buf->data);
+        if(layer->rotation != LV_DISPLAY_ROTATION_0) {
+            lv_area_t rotated_area = disp->refreshed_area;
+            lv_display_rotate_area(disp, &rotated_area);
+            call_flush_cb(disp, &rotated_area, layer->draw_buf->data);
+        }
+        else {
+            call_flush_cb(disp, &disp->refreshed_area, layer->draw_buf->data);
+        }
     }
     /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
     if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
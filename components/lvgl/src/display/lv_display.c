@@ -812,6 +812,25 @@ lv_display_rotation_t lv_display_get_rotation(lv_display_t * disp)
     return disp->rotation;
 }
 
+void lv_display_set_rotated_rendering(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+    if(disp->rotated_rendering == en) return;
+
+    disp->rotated_rendering = en;
+
+    /*The whole content needs to be sent again in the new orientation*/
+    if(disp->sys_layer) lv_obj_invalidate(disp->sys_layer);
+}
+
+bool lv_display_get_rotated_rendering(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+    return disp->rotated_rendering;
+}
+
 void lv_display_set_theme(lv_display_t * disp, lv_theme_t * th)
 {
     if(!disp) disp = lv_display_get_default();
@@ -158,6 +158,17 @@ void lv_display_set_offset(lv_display_t * disp, int32_t x, int32_t y);
  */
 void lv_display_set_rotation(lv_display_t * disp, lv_display_rotation_t rotation);
 
+/**
+ * Render directly in the native orientation of the display instead of rotating the rendered areas later.
+ * The software renderer writes every pixel to its rotated position, so `flush_cb` receives
+ * the rotated area (as `lv_display_rotate_area()` would return it) with the pixels in the panel's order
+ * and `lv_draw_sw_rotate()` is not needed.
+ * Only color formats with at least 8 bits per pixel are supported and the vector graphics are not rotated.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param en        true: render in the rotated orientation; false: render in the logical orientation
+ */
+void lv_display_set_rotated_rendering(lv_display_t * disp, bool en);
+
 /**
  * Set the DPI (dot per inch) of the display.
  * dpi = sqrt(hor_res^2 + ver_res^2) / diagonal"
@@ -215,6 +226,13 @@ int32_t lv_display_get_offset_y(const lv_display_t * disp);
  */
 lv_display_rotation_t lv_display_get_rotation(lv_display_t * disp);
 
+/**
+ * Check if the display renders directly in its native orientation.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          true: the pixels passed to `flush_cb` are already rotated
+ */
+bool lv_display_get_rotated_rendering(lv_display_t * disp);
+
 /**
  * Get the DPI of the display
  * @param disp      pointer to a display (NULL to use the default display)
@@ -142,6 +142,7 @@ struct lv_display_t {
     lv_event_list_t event_list;
 
     uint32_t rotation  : 3; /**< Element of  lv_display_rotation_t*/
+    uint32_t rotated_rendering : 1; /**< 1: render directly in the rotated orientation*/
 
     lv_theme_t * theme;     /**< The theme assigned to the screen*/
 
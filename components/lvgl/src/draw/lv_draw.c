@@ -209,11 +209,8 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
                 lv_draw_image_dsc_t * draw_image_dsc = t->draw_dsc;
                 lv_layer_t * layer_drawn = (lv_layer_t *)draw_image_dsc->src;
 
-                if(layer_drawn->draw_buf) {
-                    int32_t h = lv_area_get_height(&layer_drawn->buf_area);
-                    uint32_t layer_size_byte = h * layer_drawn->draw_buf->header.stride;
-
-                    _draw_info.used_memory_for_layers_kb -= get_layer_size_kb(layer_size_byte);
+                if(layer_drawn->draw_buf && !layer_drawn->draw_buf_external) {
+                    _draw_info.used_memory_for_layers_kb -= get_layer_size_kb(layer_drawn->draw_buf->data_size);
                     LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
                     lv_draw_buf_destroy(layer_drawn->draw_buf);
                     layer_drawn->draw_buf = NULL;
@@ -424,6 +421,16 @@ lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t c
     return new_layer;
 }
 
+lv_color_format_t lv_draw_layer_get_alpha_color_format(void)
+{
+#if LV_DRAW_LAYER_USE_RGB565A8
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp && disp->color_format == LV_COLOR_FORMAT_RGB565) return LV_COLOR_FORMAT_RGB565A8;
+#endif
+
+    return LV_COLOR_FORMAT_ARGB8888;
+}
+
 void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
 {
     /*If the buffer of the layer is already allocated return it*/
@@ -434,7 +441,6 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     /*If the buffer of the layer is not allocated yet, allocate it now*/
     int32_t w = lv_area_get_width(&layer->buf_area);
     int32_t h = lv_area_get_height(&layer->buf_area);
-    uint32_t layer_size_byte = h * lv_draw_buf_width_to_stride(w, layer->color_format);
 
     layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
 
@@ -443,7 +449,7 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
         return NULL;
     }
 
-    _draw_info.used_memory_for_layers_kb += get_layer_size_kb(layer_size_byte);
+    _draw_info.used_memory_for_layers_kb += get_layer_size_kb(layer->draw_buf->data_size);
     LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
 
     if(lv_color_format_has_alpha(layer->color_format)) {
@@ -458,6 +464,16 @@ void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
     return lv_draw_buf_goto_xy(layer->draw_buf, x, y);
 }
 
+lv_opa_t * lv_draw_layer_go_to_xy_alpha(lv_layer_t * layer, int32_t x, int32_t y)
+{
+    const lv_draw_buf_t * draw_buf = layer->draw_buf;
+    uint32_t stride = draw_buf->header.stride;
+    lv_opa_t * alpha = (lv_opa_t *)draw_buf->data + stride * draw_buf->header.h;
+
+    /*The alpha plane's stride is always the half of the RGB565 plane's*/
+    return alpha + (stride / 2) * y + x;
+}
+
 lv_draw_task_type_t lv_draw_task_get_type(const lv_draw_task_t * t)
 {
     return t->type;
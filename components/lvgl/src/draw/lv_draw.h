@@ -58,6 +58,7 @@ typedef enum {
     LV_DRAW_TASK_TYPE_MASK_RECTANGLE,
     LV_DRAW_TASK_TYPE_MASK_BITMAP,
     LV_DRAW_TASK_TYPE_VECTOR,
+    LV_DRAW_TASK_TYPE_POLYLINE,
 } lv_draw_task_type_t;
 
 typedef enum {
@@ -93,6 +94,13 @@ struct lv_layer_t  {
      */
     lv_area_t phy_clip_area;
 
+    /**
+     * The content of `draw_buf` is stored rotated by this `lv_display_rotation_t` value.
+     * Set only on the display's layer with rotated rendering, `buf_area` and the clip areas
+     * are still in the not rotated coordinates.
+     */
+    uint8_t rotation;
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /** Transform matrix to be applied when rendering the layer */
     lv_matrix_t matrix;
@@ -104,6 +112,9 @@ struct lv_layer_t  {
     lv_layer_t * parent;
     lv_layer_t * next;
     bool all_tasks_added;
+
+    /** `draw_buf` is owned by someone else (e.g. a cache) so don't free it together with the layer*/
+    bool draw_buf_external;
     void * user_data;
 };
 
@@ -220,6 +231,14 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check);
  */
 lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t color_format, const lv_area_t * area);
 
+/**
+ * Get the color format of the layers which need an alpha channel (e.g. for widgets with opacity).
+ * It's RGB565A8 (3 bytes per pixel) if `LV_DRAW_LAYER_USE_RGB565A8` is enabled
+ * and the display being refreshed is RGB565, else ARGB8888 (4 bytes per pixel).
+ * @return                  the color format to pass to `lv_draw_layer_create()`
+ */
+lv_color_format_t lv_draw_layer_get_alpha_color_format(void);
+
 /**
  * Try to allocate a buffer for the layer.
  * @param layer             pointer to a layer
@@ -236,6 +255,16 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer);
  */
 void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y);
 
+/**
+ * Go to the alpha value of a pixel on an RGB565A8 layer.
+ * The alpha values are stored in a separate plane after the RGB565 pixels.
+ * @param layer             pointer to an RGB565A8 layer with allocated buffer
+ * @param x                 the target X coordinate
+ * @param y                 the target Y coordinate
+ * @return                  pointer to the alpha value of the pixel
+ */
+lv_opa_t * lv_draw_layer_go_to_xy_alpha(lv_layer_t * layer, int32_t x, int32_t y);
+
 /**
  * Get the type of a draw task
  * @param t   the draw task to get the type of
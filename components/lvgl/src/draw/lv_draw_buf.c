@@ -163,7 +163,10 @@ void lv_draw_buf_clear(lv_draw_buf_t * draw_buf, const lv_area_t * a)
 
     if(a == NULL) {
         uint8_t * buf = lv_draw_buf_goto_xy(draw_buf, 0, 0);
-        lv_memzero(buf, header->h * stride);
+        uint32_t size = header->h * stride;
+        /*Clear the alpha plane too*/
+        if(header->cf == LV_COLOR_FORMAT_RGB565A8) size += header->h * (stride / 2);
+        lv_memzero(buf, size);
         return;
     }
 
@@ -186,6 +189,15 @@ void lv_draw_buf_clear(lv_draw_buf_t * draw_buf, const lv_area_t * a)
         lv_memzero(buf, line_length);
         buf += stride;
     }
+
+    if(header->cf == LV_COLOR_FORMAT_RGB565A8) {
+        uint32_t alpha_stride = stride / 2;
+        uint8_t * alpha = (uint8_t *)draw_buf->data + stride * header->h + alpha_stride * a_clipped.y1 + a_clipped.x1;
+        for(y = a_clipped.y1; y <= a_clipped.y2; y++) {
+            lv_memzero(alpha, lv_area_get_width(&a_clipped));
+            alpha += alpha_stride;
+        }
+    }
 }
 
 void lv_draw_buf_copy(lv_draw_buf_t * dest, const lv_area_t * dest_area,
@@ -38,6 +38,8 @@
  **********************/
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_draw_label_lines_t * lines,
+                              uint32_t line_idx, uint32_t line_start, uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -146,6 +148,90 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_character(lv_layer_t * layer, lv_draw_label_d
     LV_PROFILER_END;
 }
 
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                int32_t letter_space, int32_t max_width, lv_text_flag_t flag)
+{
+    if(lv_draw_label_lines_is_valid(lines, font, letter_space, max_width, flag)) return true;
+
+    if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
+
+    uint32_t line_cnt = 0;
+    uint32_t line_start = 0;
+    while(1) {
+        /*Keep space for the closing empty line too*/
+        if(line_cnt + 1 >= lines->line_cap) {
+            uint32_t new_cap = lines->line_cap ? lines->line_cap * 2 : 4;
+            lv_draw_label_line_t * new_lines = lv_realloc(lines->lines, new_cap * sizeof(lv_draw_label_line_t));
+            if(new_lines == NULL) {
+                lv_draw_label_lines_invalidate(lines);
+                return false;
+            }
+            lines->lines = new_lines;
+            lines->line_cap = new_cap;
+        }
+
+        if(text[line_start] == '\0') break;
+
+        uint32_t line_len = lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+        lines->lines[line_cnt].start = line_start;
+        lines->lines[line_cnt].width = lv_text_get_width(&text[line_start], line_len, font, letter_space);
+        line_cnt++;
+        line_start += line_len;
+    }
+
+    lines->lines[line_cnt].start = line_start;
+    lines->lines[line_cnt].width = 0;
+    lines->line_cnt = line_cnt;
+    lines->font = font;
+    lines->letter_space = letter_space;
+    lines->max_width = max_width;
+    lines->flag = flag;
+
+    return true;
+}
+
+bool lv_draw_label_lines_is_valid(const lv_draw_label_lines_t * lines, const lv_font_t * font, int32_t letter_space,
+                                  int32_t max_width, lv_text_flag_t flag)
+{
+    if(lines->font == NULL) return false;
+    if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
+
+    return lines->font == font && lines->letter_space == letter_space && lines->max_width == max_width &&
+           lines->flag == flag;
+}
+
+void lv_draw_label_lines_invalidate(lv_draw_label_lines_t * lines)
+{
+    lines->font = NULL;
+}
+
+void lv_draw_label_lines_free(lv_draw_label_lines_t * lines)
+{
+    lv_free(lines->lines);
+    lv_memzero(lines, sizeof(lv_draw_label_lines_t));
+}
+
+void lv_draw_label_lines_get_size(const lv_draw_label_lines_t * lines, const char * text, int32_t line_space,
+                                  lv_point_t * size_res)
+{
+    int32_t letter_height = lv_font_get_line_height(lines->font);
+    uint32_t line_cnt = lines->line_cnt;
+
+    /*The text is one line taller if the last character is '\n' or '\r'*/
+    uint32_t text_len = lines->lines[line_cnt].start;
+    if(text_len != 0 && (text[text_len - 1] == '\n' || text[text_len - 1] == '\r')) line_cnt++;
+
+    size_res->x = 0;
+    uint32_t i;
+    for(i = 0; i < lines->line_cnt; i++) {
+        size_res->x = LV_MAX(size_res->x, lines->lines[i].width);
+    }
+
+    /*An empty text is still one line tall*/
+    if(line_cnt == 0) size_res->y = letter_height;
+    else size_res->y = (int32_t)line_cnt * (letter_height + line_space) - line_space;
+}
+
 void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc,
                                       const lv_area_t * coords,
                                       lv_draw_glyph_cb_t cb)
@@ -162,10 +248,21 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
+    /*Use the line breaks only if they were calculated with the same parameters*/
+    const lv_draw_label_lines_t * lines = dsc->lines;
+    if(lines && !lv_draw_label_lines_is_valid(lines, font, dsc->letter_space, lv_area_get_width(coords), dsc->flag)) {
+        lines = NULL;
+    }
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(lines) {
+        lv_point_t p;
+        lv_draw_label_lines_get_size(lines, dsc->text, dsc->line_space, &p);
+        w = p.x;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -189,10 +286,23 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_end;
+    uint32_t line_idx       = 0;
     int32_t last_line_start = -1;
 
+    if(lines) {
+        /*Jump to the first visible line*/
+        if(pos.y + line_height_font < draw_unit->clip_area->y1) {
+            if(line_height <= 0) return;
+            line_idx = (draw_unit->clip_area->y1 - line_height_font - pos.y + line_height - 1) / line_height;
+            if(line_idx >= lines->line_cnt) return;
+            pos.y += (int32_t)line_idx * line_height;
+        }
+        line_start = lines->lines[line_idx].start;
+        line_end = line_idx < lines->line_cnt ? lines->lines[line_idx + 1].start : line_start;
+    }
     /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    else if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             dsc->hint->line_start = -1;
@@ -206,11 +316,12 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
         pos.y += dsc->hint->y;
     }
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
-                                                           dsc->flag);
+    if(lines == NULL) {
+        line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    }
 
     /*Go the first visible line*/
-    while(pos.y + line_height_font < draw_unit->clip_area->y1) {
+    while(lines == NULL && pos.y + line_height_font < draw_unit->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
         line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
@@ -228,14 +339,14 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -346,20 +457,24 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        if(lines) {
+            line_idx++;
+            line_end = line_idx < lines->line_cnt ? lines->lines[line_idx + 1].start : line_start;
+        }
+        else {
+            line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -378,6 +493,14 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
  *   STATIC FUNCTIONS
  **********************/
 
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_draw_label_lines_t * lines,
+                              uint32_t line_idx, uint32_t line_start, uint32_t line_end)
+{
+    if(lines) return line_idx < lines->line_cnt ? lines->lines[line_idx].width : 0;
+
+    return lv_text_get_width(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space);
+}
+
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
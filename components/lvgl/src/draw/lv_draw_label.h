@@ -54,6 +54,10 @@ typedef struct {
      * 0: `text` is const and it's pointer will be valid during rendering.*/
     uint8_t text_local : 1;
     lv_draw_label_hint_t * hint;
+
+    /** Precalculated line breaks of `text`. Used instead of measuring the text again if
+     *  they were calculated with the same font, letter space, width and flags. Can be NULL.*/
+    const lv_draw_label_lines_t * lines;
 } lv_draw_label_dsc_t;
 
 /**
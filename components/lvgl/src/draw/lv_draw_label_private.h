@@ -0,0 +1,138 @@
+/**
+ * @file lv_draw_label_private.h
+ *
+ */
+
+#ifndef LV_DRAW_LABEL_PRIVATE_H
+#define LV_DRAW_LABEL_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_draw_label.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Store some info to speed up drawing of very large texts
+ * It takes a lot of time to get the first visible character because
+ * all the previous characters needs to be checked to calculate the positions.
+ * This structure stores an earlier (e.g. at -1000 px) coordinate and the index of that line.
+ * Therefore the calculations can start from here.*/
+struct lv_draw_label_hint_t {
+    /** Index of the line at `y` coordinate*/
+    int32_t line_start;
+
+    /** Give the `y` coordinate of the first letter at `line start` index. Relative to the label's coordinates*/
+    int32_t y;
+
+    /** The 'y1' coordinate of the label when the hint was saved.
+     * Used to invalidate the hint if the label has moved too much.*/
+    int32_t coord_y;
+};
+
+/** A line of a text*/
+typedef struct {
+    uint32_t start;     /**< Byte index of the first letter of the line*/
+    int32_t width;      /**< Width of the line as `lv_text_get_width` measures it*/
+} lv_draw_label_line_t;
+
+/** The line breaks of a text to measure the text only once when it's drawn many times.
+ * The `y` coordinate of the i-th line is `i * (font_line_height + line_space)`.*/
+struct lv_draw_label_lines_t {
+    /** `line_cnt + 1` lines, the last one starts at the terminating `'\0'` and is empty*/
+    lv_draw_label_line_t * lines;
+    uint32_t line_cnt;
+    uint32_t line_cap;          /**< Number of allocated elements in `lines`*/
+
+    /** The parameters of `lv_text_get_next_line` the lines were calculated with.
+     *  `font == NULL` means the lines are invalid.*/
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_width;
+    lv_text_flag_t flag;
+};
+
+struct lv_draw_glyph_dsc_t {
+    void * glyph_data;  /**< Depends on `format` field, it could be image source or draw buf of bitmap or vector data. */
+    lv_font_glyph_format_t format;
+    const lv_area_t * letter_coords;
+    const lv_area_t * bg_coords;
+    const lv_font_glyph_dsc_t * g;
+    lv_color_t color;
+    lv_opa_t opa;
+    lv_draw_buf_t * _draw_buf; /**< a shared draw buf for get_bitmap, do not use it directly, use glyph_data instead */
+};
+
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Calculate the line breaks of a text unless they are already calculated with the same parameters.
+ * The parameters are the same as of `lv_text_get_next_line`.
+ * @param lines         the line table to update
+ * @param text          the text to break to lines
+ * @param font          the font of the text
+ * @param letter_space  letter space
+ * @param max_width     max width of the lines. Ignored if `flag` contains `LV_TEXT_FLAG_EXPAND`.
+ * @param flag          settings for the text from `lv_text_flag_t`
+ * @return              true: the lines are valid; false: out of memory
+ */
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                int32_t letter_space, int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Check if the line breaks were calculated with the given parameters
+ * @param lines         the line table
+ * @param font          the font of the text
+ * @param letter_space  letter space
+ * @param max_width     max width of the lines. Ignored if `flag` contains `LV_TEXT_FLAG_EXPAND`.
+ * @param flag          settings for the text from `lv_text_flag_t`
+ * @return              true: the lines can be used
+ */
+bool lv_draw_label_lines_is_valid(const lv_draw_label_lines_t * lines, const lv_font_t * font, int32_t letter_space,
+                                  int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Mark the line breaks to be recalculated, e.g. because the text has changed
+ * @param lines         the line table
+ */
+void lv_draw_label_lines_invalidate(lv_draw_label_lines_t * lines);
+
+/**
+ * Free the memory allocated by the line table
+ * @param lines         the line table
+ */
+void lv_draw_label_lines_free(lv_draw_label_lines_t * lines);
+
+/**
+ * Get the size of a text from its line breaks the same way as `lv_text_get_size` would calculate it
+ * @param lines         valid line table of `text`
+ * @param text          the text
+ * @param line_space    line space
+ * @param size_res      store the result here
+ */
+void lv_draw_label_lines_get_size(const lv_draw_label_lines_t * lines, const char * text, int32_t line_space,
+                                  lv_point_t * size_res);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_LABEL_PRIVATE_H*/
@@ -72,6 +72,49 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_line(lv_layer_t * layer, const lv_draw_line_d
     LV_PROFILER_END;
 }
 
+lv_draw_line_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task)
+{
+    return task->type == LV_DRAW_TASK_TYPE_POLYLINE ? (lv_draw_line_dsc_t *)task->draw_dsc : NULL;
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_polyline(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc)
+{
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->points == NULL || dsc->point_cnt < 2) return;
+
+    LV_PROFILER_BEGIN;
+    lv_area_t a;
+    a.x1 = LV_COORD_MAX;
+    a.y1 = LV_COORD_MAX;
+    a.x2 = LV_COORD_MIN;
+    a.y2 = LV_COORD_MIN;
+    uint32_t i;
+    for(i = 0; i < dsc->point_cnt; i++) {
+        a.x1 = LV_MIN(a.x1, (int32_t)dsc->points[i].x);
+        a.x2 = LV_MAX(a.x2, (int32_t)dsc->points[i].x);
+        a.y1 = LV_MIN(a.y1, (int32_t)dsc->points[i].y);
+        a.y2 = LV_MAX(a.y2, (int32_t)dsc->points[i].y);
+    }
+    lv_area_increase(&a, dsc->width, dsc->width);
+
+    lv_draw_task_t * t = lv_draw_add_task(layer, &a);
+
+    /*Store the points right after the descriptor*/
+    uint32_t points_size = dsc->point_cnt * sizeof(lv_point_precise_t);
+    lv_draw_line_dsc_t * new_dsc = lv_malloc(sizeof(*dsc) + points_size);
+    LV_ASSERT_MALLOC(new_dsc);
+    lv_memcpy(new_dsc, dsc, sizeof(*dsc));
+    lv_memcpy(new_dsc + 1, dsc->points, points_size);
+    new_dsc->points = (const lv_point_precise_t *)(new_dsc + 1);
+
+    t->draw_dsc = new_dsc;
+    t->type = LV_DRAW_TASK_TYPE_POLYLINE;
+
+    lv_draw_finalize_task_creation(layer, t);
+    LV_PROFILER_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
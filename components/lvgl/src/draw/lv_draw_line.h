@@ -39,6 +39,9 @@ typedef struct {
     uint8_t round_start : 1;
     uint8_t round_end   : 1;
     uint8_t raw_end     : 1;    /**< Do not bother with perpendicular line ending if it's not visible for any reason */
+
+    const lv_point_precise_t * points;  /**< Points of a polyline, used only by `lv_draw_polyline` */
+    uint32_t point_cnt;                 /**< Number of `points` */
 } lv_draw_line_dsc_t;
 
 /**********************
@@ -65,6 +68,23 @@ lv_draw_line_dsc_t * lv_draw_task_get_line_dsc(lv_draw_task_t * task);
  */
 void lv_draw_line(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Try to get a polyline draw descriptor from a draw task.
+ * @param task      draw task
+ * @return          the task's draw descriptor or NULL if the task is not of type LV_DRAW_TASK_TYPE_POLYLINE
+ */
+lv_draw_line_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task);
+
+/**
+ * Create a draw task to draw connected lines through `dsc->points` in one pass.
+ * The joins are rounded and the overlapping parts of the segments are blended only once.
+ * `round_start` and `round_end` are applied on the first and last points, `p1` and `p2` are ignored.
+ * The points are copied so they needn't remain valid after the call.
+ * @param layer     pointer to a layer
+ * @param dsc       pointer to an initialized `lv_draw_line_dsc_t` variable
+ */
+void lv_draw_polyline(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,649 @@
+﻿/**
+ * @file lv_draw_sw_blend.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../misc/lv_area_private.h"
+#include "lv_draw_sw_blend_private.h"
+#include "../../lv_draw_private.h"
+#include "../lv_draw_sw.h"
+#include "../lv_draw_sw_private.h"
+#if LV_DRAW_SW_SUPPORT_L8
+    #include "lv_draw_sw_blend_to_l8.h"
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88
+    #include "lv_draw_sw_blend_to_al88.h"
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565
+    #include "lv_draw_sw_blend_to_rgb565.h"
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565A8
+    #include "lv_draw_sw_blend_to_rgb565a8.h"
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+    #include "lv_draw_sw_blend_to_argb8888.h"
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+    #include "lv_draw_sw_blend_to_rgb888.h"
+#endif
+#if LV_DRAW_SW_SUPPORT_I1
+    #include "lv_draw_sw_blend_to_i1.h"
+#endif
+#if LV_USE_DRAW_SW
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Fully transparent or opaque parts of a mask line shorter than this are blended with the mask too.
+ *Splitting the line is not worth it for a few pixels.*/
+#define SPAN_MIN_LEN    16
+
+/*Blend about this many pixels at once to layers with rotated buffer*/
+#define ROTATED_CHUNK_PX    1024
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static int32_t get_mask_span(const lv_opa_t * mask_buf, int32_t len, lv_draw_sw_mask_res_t * res);
+static void blend_color(lv_layer_t * layer, lv_draw_sw_blend_fill_dsc_t * dsc);
+static void blend_color_spans(lv_layer_t * layer, const lv_draw_sw_blend_fill_dsc_t * dsc);
+static void blend_image(lv_layer_t * layer, lv_draw_sw_blend_image_dsc_t * dsc);
+static void blend_image_spans(lv_layer_t * layer, const lv_draw_sw_blend_image_dsc_t * dsc);
+static void blend_color_rotated(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_fill_dsc_t * dsc);
+static void blend_image_rotated(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_image_dsc_t * dsc);
+static uint8_t * rotated_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y, int32_t * step_x, int32_t * step_y);
+static void copy_pixels(uint8_t * dest, int32_t dest_step_x, int32_t dest_step_y,
+                        const uint8_t * src, int32_t src_step_x, int32_t src_step_y,
+                        int32_t w, int32_t h, uint32_t px_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc)
+{
+    /*Do not draw transparent things*/
+    if(blend_dsc->opa <= LV_OPA_MIN) return;
+    if(blend_dsc->mask_buf && blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_TRANSP) return;
+
+    lv_area_t blend_area;
+    if(!lv_area_intersect(&blend_area, blend_dsc->blend_area, draw_unit->clip_area)) return;
+
+    LV_PROFILER_BEGIN;
+    lv_layer_t * layer = draw_unit->target_layer;
+    uint32_t layer_stride_byte = layer->draw_buf->header.stride;
+
+    if(blend_dsc->src_buf == NULL) {
+        lv_draw_sw_blend_fill_dsc_t fill_dsc;
+        fill_dsc.dest_w = lv_area_get_width(&blend_area);
+        fill_dsc.dest_h = lv_area_get_height(&blend_area);
+        fill_dsc.dest_stride = layer_stride_byte;
+        fill_dsc.opa = blend_dsc->opa;
+        fill_dsc.color = blend_dsc->color;
+
+        if(blend_dsc->mask_buf == NULL) fill_dsc.mask_buf = NULL;
+        else if(blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) fill_dsc.mask_buf = NULL;
+        else fill_dsc.mask_buf = blend_dsc->mask_buf;
+
+
+        fill_dsc.relative_area  = blend_area;
+        lv_area_move(&fill_dsc.relative_area, -layer->buf_area.x1, -layer->buf_area.y1);
+        fill_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
+                                                   blend_area.y1 - layer->buf_area.y1);
+        if(fill_dsc.mask_buf) {
+            fill_dsc.mask_stride = blend_dsc->mask_stride == 0  ? lv_area_get_width(blend_dsc->mask_area) : blend_dsc->mask_stride;
+            fill_dsc.mask_buf += fill_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
+                                 (blend_area.x1 - blend_dsc->mask_area->x1);
+        }
+
+        if(layer->rotation != LV_DISPLAY_ROTATION_0) {
+            blend_color_rotated(draw_unit, &fill_dsc);
+        }
+        else if(fill_dsc.mask_buf && fill_dsc.dest_h == 1 && fill_dsc.dest_w >= SPAN_MIN_LEN * 2 &&
+                lv_color_format_get_bpp(layer->color_format) >= 8) {
+            blend_color_spans(layer, &fill_dsc);
+        }
+        else {
+            blend_color(layer, &fill_dsc);
+        }
+    }
+    else {
+        if(!lv_area_intersect(&blend_area, &blend_area, blend_dsc->src_area)) {
+            LV_PROFILER_END;
+            return;
+        }
+
+        if(blend_dsc->mask_area && !lv_area_intersect(&blend_area, &blend_area, blend_dsc->mask_area)) {
+            LV_PROFILER_END;
+            return;
+        }
+
+        lv_draw_sw_blend_image_dsc_t image_dsc;
+        image_dsc.dest_w = lv_area_get_width(&blend_area);
+        image_dsc.dest_h = lv_area_get_height(&blend_area);
+        image_dsc.dest_stride = layer_stride_byte;
+
+        image_dsc.opa = blend_dsc->opa;
+        image_dsc.blend_mode = blend_dsc->blend_mode;
+        image_dsc.src_stride = blend_dsc->src_stride;
+        image_dsc.src_color_format = blend_dsc->src_color_format;
+
+        const uint8_t * src_buf = blend_dsc->src_buf;
+        uint32_t src_px_size = lv_color_format_get_bpp(blend_dsc->src_color_format);
+        src_buf += image_dsc.src_stride * (blend_area.y1 - blend_dsc->src_area->y1);
+        src_buf += ((blend_area.x1 - blend_dsc->src_area->x1) * src_px_size) >> 3;
+        image_dsc.src_buf = src_buf;
+
+
+        if(blend_dsc->mask_buf == NULL) image_dsc.mask_buf = NULL;
+        else if(blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) image_dsc.mask_buf = NULL;
+        else image_dsc.mask_buf = blend_dsc->mask_buf;
+
+        if(image_dsc.mask_buf) {
+            image_dsc.mask_buf = blend_dsc->mask_buf;
+            image_dsc.mask_stride = blend_dsc->mask_stride ? blend_dsc->mask_stride : lv_area_get_width(blend_dsc->mask_area);
+            image_dsc.mask_buf += image_dsc.mask_stride * (blend_area.y1 - blend_dsc->mask_area->y1) +
+                                  (blend_area.x1 - blend_dsc->mask_area->x1);
+        }
+
+        image_dsc.relative_area  = blend_area;
+        lv_area_move(&image_dsc.relative_area, -layer->buf_area.x1, -layer->buf_area.y1);
+
+        image_dsc.src_area  = *blend_dsc->src_area;
+        lv_area_move(&image_dsc.src_area, -layer->buf_area.x1, -layer->buf_area.y1);
+
+        image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
+                                                    blend_area.y1 - layer->buf_area.y1);
+
+        if(layer->rotation != LV_DISPLAY_ROTATION_0) {
+            blend_image_rotated(draw_unit, &image_dsc);
+        }
+        else if(image_dsc.mask_buf && image_dsc.dest_h == 1 && image_dsc.dest_w >= SPAN_MIN_LEN * 2 &&
+                lv_color_format_get_bpp(layer->color_format) >= 8 &&
+                lv_color_format_get_bpp(image_dsc.src_color_format) >= 8 &&
+                image_dsc.src_color_format != LV_COLOR_FORMAT_RGB565A8) {
+            blend_image_spans(layer, &image_dsc);
+        }
+        else {
+            blend_image(layer, &image_dsc);
+        }
+    }
+    LV_PROFILER_END;
+}
+
+void lv_draw_sw_rotated_layer_copy(lv_layer_t * layer, const lv_area_t * area, void * buf, int32_t stride,
+                                   bool to_layer)
+{
+    uint32_t px_size = lv_color_format_get_size(layer->color_format);
+    int32_t step_x;
+    int32_t step_y;
+    uint8_t * rot_buf = rotated_go_to_xy(layer, area->x1 - layer->buf_area.x1, area->y1 - layer->buf_area.y1,
+                                         &step_x, &step_y);
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+
+    if(to_layer) copy_pixels(rot_buf, step_x, step_y, buf, px_size, stride, w, h, px_size);
+    else copy_pixels(buf, px_size, stride, rot_buf, step_x, step_y, w, h, px_size);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get the length of the same value in a mask line
+ * @param mask_buf  the mask line
+ * @param len       length of `mask_buf`
+ * @param v         the value to look for
+ * @return          number of `v`s at the start of `mask_buf`
+ */
+static inline int32_t get_run_length(const lv_opa_t * mask_buf, int32_t len, lv_opa_t v)
+{
+    int32_t i = 0;
+    while(i < len && ((lv_uintptr_t)&mask_buf[i] & 0x3)) {
+        if(mask_buf[i] != v) return i;
+        i++;
+    }
+
+    /*Compare 4 bytes at once*/
+    uint32_t v32 = v * 0x01010101U;
+    while(i + 4 <= len && *(const uint32_t *)&mask_buf[i] == v32) i += 4;
+
+    while(i < len && mask_buf[i] == v) i++;
+    return i;
+}
+
+/**
+ * Get the next span of a mask line which is either fully transparent,
+ * fully opaque, or mixed (e.g. the anti-aliased edges)
+ * @param mask_buf  the mask line
+ * @param len       length of `mask_buf`
+ * @param res       store the type of the span here
+ * @return          length of the span
+ */
+static int32_t get_mask_span(const lv_opa_t * mask_buf, int32_t len, lv_draw_sw_mask_res_t * res)
+{
+    lv_opa_t v = mask_buf[0];
+    if(v == LV_OPA_TRANSP || v == LV_OPA_COVER) {
+        int32_t run = get_run_length(mask_buf, len, v);
+        if(run >= SPAN_MIN_LEN || run == len) {
+            *res = v == LV_OPA_TRANSP ? LV_DRAW_SW_MASK_RES_TRANSP : LV_DRAW_SW_MASK_RES_FULL_COVER;
+            return run;
+        }
+    }
+
+    /*Mixed span until a long enough transparent or opaque run*/
+    *res = LV_DRAW_SW_MASK_RES_CHANGED;
+    int32_t run = 0;
+    lv_opa_t run_v = 0;
+    int32_t i;
+    for(i = 0; i < len; i++) {
+        v = mask_buf[i];
+        if(v == LV_OPA_TRANSP || v == LV_OPA_COVER) {
+            if(run > 0 && v == run_v) run++;
+            else {
+                run = 1;
+                run_v = v;
+            }
+
+            if(run == SPAN_MIN_LEN) return i - run + 1;
+        }
+        else {
+            run = 0;
+        }
+    }
+
+    return len;
+}
+
+static void blend_color(lv_layer_t * layer, lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    switch(layer->color_format) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+            lv_draw_sw_blend_color_to_rgb565(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565A8
+        case LV_COLOR_FORMAT_RGB565A8:
+            lv_draw_sw_blend_color_to_rgb565a8(dsc, lv_draw_layer_go_to_xy_alpha(layer, dsc->relative_area.x1,
+                                                                                 dsc->relative_area.y1),
+                                               dsc->dest_stride / 2);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888:
+            lv_draw_sw_blend_color_to_argb8888(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+            lv_draw_sw_blend_color_to_rgb888(dsc, 3);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+            lv_draw_sw_blend_color_to_rgb888(dsc, 4);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+            lv_draw_sw_blend_color_to_l8(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88
+        case LV_COLOR_FORMAT_AL88:
+            lv_draw_sw_blend_color_to_al88(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_I1
+        case LV_COLOR_FORMAT_I1:
+            lv_draw_sw_blend_color_to_i1(dsc);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+/**
+ * Blend a single masked line by skipping the fully transparent spans and
+ * filling the fully opaque spans without mask
+ */
+static void blend_color_spans(lv_layer_t * layer, const lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    uint32_t px_size = lv_color_format_get_size(layer->color_format);
+    lv_draw_sw_blend_fill_dsc_t span_dsc = *dsc;
+
+    /*Layers with alpha channel get the color of the fully transparent pixels too
+     *(it matters e.g. when they are transformed), so those pixels can't be skipped*/
+    bool skip_transp = !lv_color_format_has_alpha(layer->color_format);
+    int32_t x = 0;
+    while(x < dsc->dest_w) {
+        lv_draw_sw_mask_res_t res;
+        int32_t len = get_mask_span(dsc->mask_buf + x, dsc->dest_w - x, &res);
+        if(res != LV_DRAW_SW_MASK_RES_TRANSP || !skip_transp) {
+            span_dsc.dest_buf = (uint8_t *)dsc->dest_buf + x * px_size;
+            span_dsc.dest_w = len;
+            /*With `opa < LV_OPA_MAX` the kernels mix `mask * opa / 256`, so keep the mask
+             *for the same result as before*/
+            if(res == LV_DRAW_SW_MASK_RES_FULL_COVER && dsc->opa >= LV_OPA_MAX) span_dsc.mask_buf = NULL;
+            else span_dsc.mask_buf = dsc->mask_buf + x;
+            span_dsc.relative_area.x1 = dsc->relative_area.x1 + x;
+            span_dsc.relative_area.x2 = span_dsc.relative_area.x1 + len - 1;
+            blend_color(layer, &span_dsc);
+        }
+        x += len;
+    }
+}
+
+static void blend_image(lv_layer_t * layer, lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(layer->color_format) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+            lv_draw_sw_blend_image_to_rgb565(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565A8
+        case LV_COLOR_FORMAT_RGB565A8:
+            lv_draw_sw_blend_image_to_rgb565a8(dsc, lv_draw_layer_go_to_xy_alpha(layer, dsc->relative_area.x1,
+                                                                                 dsc->relative_area.y1),
+                                               dsc->dest_stride / 2);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888:
+            lv_draw_sw_blend_image_to_argb8888(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+            lv_draw_sw_blend_image_to_rgb888(dsc, 3);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+            lv_draw_sw_blend_image_to_rgb888(dsc, 4);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+            lv_draw_sw_blend_image_to_l8(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88
+        case LV_COLOR_FORMAT_AL88:
+            lv_draw_sw_blend_image_to_al88(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_I1
+        case LV_COLOR_FORMAT_I1:
+            lv_draw_sw_blend_image_to_i1(dsc);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+/**
+ * Blend a single masked line of an image by skipping the fully transparent spans and
+ * copying the fully opaque spans without mask
+ */
+static void blend_image_spans(lv_layer_t * layer, const lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    uint32_t px_size = lv_color_format_get_size(layer->color_format);
+    uint32_t src_px_size = lv_color_format_get_size(dsc->src_color_format);
+    lv_draw_sw_blend_image_dsc_t span_dsc = *dsc;
+
+    /*The kernels mix the alpha channel and the mask as `alpha * mask / 256`,
+     *so the mask can be removed only if there is no alpha channel*/
+    bool cover_no_mask = dsc->opa >= LV_OPA_MAX && !lv_color_format_has_alpha(dsc->src_color_format);
+    bool skip_transp = !lv_color_format_has_alpha(layer->color_format);
+    int32_t x = 0;
+    while(x < dsc->dest_w) {
+        lv_draw_sw_mask_res_t res;
+        int32_t len = get_mask_span(dsc->mask_buf + x, dsc->dest_w - x, &res);
+        if(res != LV_DRAW_SW_MASK_RES_TRANSP || !skip_transp) {
+            span_dsc.dest_buf = (uint8_t *)dsc->dest_buf + x * px_size;
+            span_dsc.src_buf = (const uint8_t *)dsc->src_buf + x * src_px_size;
+            span_dsc.dest_w = len;
+            if(res == LV_DRAW_SW_MASK_RES_FULL_COVER && cover_no_mask) span_dsc.mask_buf = NULL;
+            else span_dsc.mask_buf = dsc->mask_buf + x;
+            span_dsc.relative_area.x1 = dsc->relative_area.x1 + x;
+            span_dsc.relative_area.x2 = span_dsc.relative_area.x1 + len - 1;
+            blend_image(layer, &span_dsc);
+        }
+        x += len;
+    }
+}
+
+/**
+ * Get a pixel of a layer which stores its pixels rotated by `layer->rotation`
+ * @param layer     pointer to a layer with rotated buffer
+ * @param x         X coordinate relative to the not rotated buffer area
+ * @param y         Y coordinate relative to the not rotated buffer area
+ * @param step_x    store the offset in bytes to the pixel at `x + 1` here
+ * @param step_y    store the offset in bytes to the pixel at `y + 1` here
+ * @return          pointer to the pixel in the rotated buffer
+ */
+static uint8_t * rotated_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y, int32_t * step_x, int32_t * step_y)
+{
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+    int32_t stride = layer->draw_buf->header.stride;
+    int32_t px_size = lv_color_format_get_size(layer->color_format);
+
+    switch(layer->rotation) {
+        case LV_DISPLAY_ROTATION_90:
+            *step_x = -stride;
+            *step_y = px_size;
+            return lv_draw_layer_go_to_xy(layer, y, w - 1 - x);
+        case LV_DISPLAY_ROTATION_180:
+            *step_x = -px_size;
+            *step_y = -stride;
+            return lv_draw_layer_go_to_xy(layer, w - 1 - x, h - 1 - y);
+        case LV_DISPLAY_ROTATION_270:
+        default:
+            *step_x = stride;
+            *step_y = -px_size;
+            return lv_draw_layer_go_to_xy(layer, h - 1 - y, x);
+    }
+}
+
+/**
+ * Copy a rectangle of pixels where the pixels and rows of the source and destination
+ * can be anywhere in the memory. Used to reorder the pixels of rotated buffers.
+ * @param dest          pointer to the first destination pixel
+ * @param dest_step_x   offset in bytes to the next destination pixel in a row
+ * @param dest_step_y   offset in bytes to the next destination row
+ * @param src           pointer to the first source pixel
+ * @param src_step_x    offset in bytes to the next source pixel in a row
+ * @param src_step_y    offset in bytes to the next source row
+ * @param w             number of pixels in a row
+ * @param h             number of rows
+ * @param px_size       size of a pixel in bytes
+ */
+static void copy_pixels(uint8_t * dest, int32_t dest_step_x, int32_t dest_step_y,
+                        const uint8_t * src, int32_t src_step_x, int32_t src_step_y,
+                        int32_t w, int32_t h, uint32_t px_size)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint8_t * d = dest + y * dest_step_y;
+        const uint8_t * s = src + y * src_step_y;
+        switch(px_size) {
+            case 2:
+                for(x = 0; x < w; x++) *(uint16_t *)&d[x * dest_step_x] = *(const uint16_t *)&s[x * src_step_x];
+                break;
+            case 3:
+                for(x = 0; x < w; x++) {
+                    d[x * dest_step_x] = s[x * src_step_x];
+                    d[x * dest_step_x + 1] = s[x * src_step_x + 1];
+                    d[x * dest_step_x + 2] = s[x * src_step_x + 2];
+                }
+                break;
+            case 4:
+                for(x = 0; x < w; x++) *(uint32_t *)&d[x * dest_step_x] = *(const uint32_t *)&s[x * src_step_x];
+                break;
+            default:
+                for(x = 0; x < w; x++) d[x * dest_step_x] = s[x * src_step_x];
+                break;
+        }
+    }
+}
+
+/**
+ * Fill an area on a layer which stores its pixels rotated by `layer->rotation`
+ * (see `lv_display_set_rotated_rendering()`).
+ * Without mask the rotated area is filled directly. Else the pixels are copied
+ * to a temporary buffer in chunks, blended there as usual and copied back to their rotated position.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the fill descriptor in the not rotated coordinates. `dest_buf` is ignored.
+ */
+static void blend_color_rotated(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_layer_t * layer = draw_unit->target_layer;
+    const lv_area_t * rel_area = &dsc->relative_area;
+    int32_t step_x;
+    int32_t step_y;
+
+    if(dsc->mask_buf == NULL) {
+        /*The rotated area is a rectangle too which can be filled directly.
+         *Find the corner which gets to the top left.*/
+        int32_t x = layer->rotation == LV_DISPLAY_ROTATION_270 ? rel_area->x1 : rel_area->x2;
+        int32_t y = layer->rotation == LV_DISPLAY_ROTATION_90 ? rel_area->y1 : rel_area->y2;
+        lv_draw_sw_blend_fill_dsc_t rot_dsc = *dsc;
+        rot_dsc.dest_buf = rotated_go_to_xy(layer, x, y, &step_x, &step_y);
+        rot_dsc.dest_stride = layer->draw_buf->header.stride;
+        if(layer->rotation != LV_DISPLAY_ROTATION_180) {
+            rot_dsc.dest_w = dsc->dest_h;
+            rot_dsc.dest_h = dsc->dest_w;
+        }
+        blend_color(layer, &rot_dsc);
+        return;
+    }
+
+    if(dsc->dest_h == 1 && layer->rotation != LV_DISPLAY_ROTATION_180) {
+        /*A line is a column in the rotated buffer. Fill it as a 1 pixel wide area
+         *from its top pixel and step on the mask accordingly.*/
+        lv_draw_sw_blend_fill_dsc_t rot_dsc = *dsc;
+        if(layer->rotation == LV_DISPLAY_ROTATION_90) {
+            rot_dsc.dest_buf = rotated_go_to_xy(layer, rel_area->x2, rel_area->y1, &step_x, &step_y);
+            rot_dsc.mask_buf = dsc->mask_buf + dsc->dest_w - 1;
+            rot_dsc.mask_stride = -1;
+        }
+        else {
+            rot_dsc.dest_buf = rotated_go_to_xy(layer, rel_area->x1, rel_area->y1, &step_x, &step_y);
+            rot_dsc.mask_stride = 1;
+        }
+        rot_dsc.dest_w = 1;
+        rot_dsc.dest_h = dsc->dest_w;
+        rot_dsc.dest_stride = layer->draw_buf->header.stride;
+        blend_color(layer, &rot_dsc);
+        return;
+    }
+
+    uint32_t px_size = lv_color_format_get_size(layer->color_format);
+    int32_t tmp_stride = dsc->dest_w * px_size;
+    int32_t chunk_h = LV_CLAMP(1, ROTATED_CHUNK_PX / dsc->dest_w, dsc->dest_h);
+    uint8_t * tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, tmp_stride * chunk_h);
+    if(tmp_buf == NULL) return;
+
+    lv_draw_sw_blend_fill_dsc_t chunk_dsc = *dsc;
+    chunk_dsc.dest_buf = tmp_buf;
+    chunk_dsc.dest_stride = tmp_stride;
+
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y += chunk_h) {
+        chunk_dsc.dest_h = LV_MIN(chunk_h, dsc->dest_h - y);
+        chunk_dsc.mask_buf = dsc->mask_buf + y * dsc->mask_stride;
+        chunk_dsc.relative_area.y1 = rel_area->y1 + y;
+        chunk_dsc.relative_area.y2 = chunk_dsc.relative_area.y1 + chunk_dsc.dest_h - 1;
+
+        uint8_t * rot_buf = rotated_go_to_xy(layer, rel_area->x1, chunk_dsc.relative_area.y1, &step_x, &step_y);
+        copy_pixels(tmp_buf, px_size, tmp_stride, rot_buf, step_x, step_y, dsc->dest_w, chunk_dsc.dest_h, px_size);
+
+        if(chunk_dsc.dest_h == 1 && chunk_dsc.dest_w >= SPAN_MIN_LEN * 2) blend_color_spans(layer, &chunk_dsc);
+        else blend_color(layer, &chunk_dsc);
+
+        copy_pixels(rot_buf, step_x, step_y, tmp_buf, px_size, tmp_stride, dsc->dest_w, chunk_dsc.dest_h, px_size);
+    }
+
+    lv_draw_sw_scratch_free(draw_unit, tmp_buf);
+}
+
+/**
+ * Blend an image to a layer which stores its pixels rotated by `layer->rotation`
+ * (see `lv_display_set_rotated_rendering()`).
+ * The pixels are blended to a temporary buffer in chunks and copied to their rotated position.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the image blend descriptor in the not rotated coordinates. `dest_buf` is ignored.
+ */
+static void blend_image_rotated(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_layer_t * layer = draw_unit->target_layer;
+    const lv_area_t * rel_area = &dsc->relative_area;
+    uint32_t px_size = lv_color_format_get_size(layer->color_format);
+    int32_t tmp_stride = dsc->dest_w * px_size;
+    int32_t chunk_h = LV_CLAMP(1, ROTATED_CHUNK_PX / dsc->dest_w, dsc->dest_h);
+    uint8_t * tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, tmp_stride * chunk_h);
+    if(tmp_buf == NULL) return;
+
+    /*Opaque images overwrite the pixels so there is no need to read them*/
+    bool read_dest = dsc->mask_buf || dsc->opa < LV_OPA_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+                     lv_color_format_has_alpha(dsc->src_color_format);
+    bool spans = lv_color_format_get_bpp(dsc->src_color_format) >= 8 &&
+                 dsc->src_color_format != LV_COLOR_FORMAT_RGB565A8;
+
+    lv_draw_sw_blend_image_dsc_t chunk_dsc = *dsc;
+    chunk_dsc.dest_buf = tmp_buf;
+    chunk_dsc.dest_stride = tmp_stride;
+
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y += chunk_h) {
+        chunk_dsc.dest_h = LV_MIN(chunk_h, dsc->dest_h - y);
+        chunk_dsc.src_buf = (const uint8_t *)dsc->src_buf + y * dsc->src_stride;
+        if(dsc->mask_buf) chunk_dsc.mask_buf = dsc->mask_buf + y * dsc->mask_stride;
+        chunk_dsc.relative_area.y1 = rel_area->y1 + y;
+        chunk_dsc.relative_area.y2 = chunk_dsc.relative_area.y1 + chunk_dsc.dest_h - 1;
+
+        int32_t step_x;
+        int32_t step_y;
+        uint8_t * rot_buf = rotated_go_to_xy(layer, rel_area->x1, chunk_dsc.relative_area.y1, &step_x, &step_y);
+        if(read_dest) {
+            copy_pixels(tmp_buf, px_size, tmp_stride, rot_buf, step_x, step_y, dsc->dest_w, chunk_dsc.dest_h, px_size);
+        }
+
+        if(spans && chunk_dsc.mask_buf && chunk_dsc.dest_h == 1 && chunk_dsc.dest_w >= SPAN_MIN_LEN * 2) {
+            blend_image_spans(layer, &chunk_dsc);
+        }
+        else {
+            blend_image(layer, &chunk_dsc);
+        }
+
+        copy_pixels(rot_buf, step_x, step_y, tmp_buf, px_size, tmp_stride, dsc->dest_w, chunk_dsc.dest_h, px_size);
+    }
+
+    lv_draw_sw_scratch_free(draw_unit, tmp_buf);
+}
+
+#endif
@@ -22,6 +22,8 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2
+    #include "sse2/lv_blend_sse2.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -34,6 +36,19 @@
  *      TYPEDEFS
  **********************/
 
+/*The variants of each blend mode. The kernel tables are indexed by it*/
+typedef enum {
+    BLEND_CASE_COVER,
+    BLEND_CASE_OPA,
+    BLEND_CASE_MASK,
+    BLEND_CASE_MASK_OPA,
+    BLEND_CASE_NUM,
+} blend_case_t;
+
+typedef void (*fill_kernel_t)(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+typedef void (*image_kernel_t)(lv_draw_sw_blend_image_dsc_t * dsc);
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -52,9 +67,11 @@
     static void /* LV_ATTRIBUTE_FAST_MEM */ l8_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 #endif
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ run_color_kernel(lv_draw_sw_blend_fill_dsc_t * dsc, blend_case_t blend_case);
+
 static void /* LV_ATTRIBUTE_FAST_MEM */ rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 
-#if LV_DRAW_SW_SUPPORT_RGB888
+#if LV_DRAW_SW_SUPPORT_RGB888 || LV_DRAW_SW_SUPPORT_XRGB8888
 static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
                                                            const uint8_t src_px_size);
 #endif
@@ -63,12 +80,27 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_imag
     static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 #endif
 
+static inline blend_case_t /* LV_ATTRIBUTE_FAST_MEM */ get_blend_case(const lv_opa_t * mask, lv_opa_t opa);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ run_image_kernel(const image_kernel_t kernels[][BLEND_CASE_NUM],
+                                                                lv_draw_sw_blend_image_dsc_t * dsc, blend_case_t blend_case);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ additive_565(uint16_t dest, uint32_t r, uint32_t g, uint32_t b);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ subtractive_565(uint16_t dest, uint32_t r, uint32_t g, uint32_t b);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ multiply_565(uint16_t dest, uint32_t r, uint32_t g, uint32_t b);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix);
+
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ l8_to_rgb565(const uint8_t c1);
 
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_16_mix(const uint8_t c1, uint16_t c2, uint8_t mix);
 
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix);
 
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ fill_row_u16(uint16_t * dest, uint16_t color16, int32_t w);
+
 static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
 
 /**********************
@@ -210,152 +242,26 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
  */
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
 {
-    int32_t w = dsc->dest_w;
-    int32_t h = dsc->dest_h;
-    uint16_t color16 = lv_color_to_u16(dsc->color);
-    lv_opa_t opa = dsc->opa;
-    const lv_opa_t * mask = dsc->mask_buf;
-    int32_t mask_stride = dsc->mask_stride;
-    uint16_t * dest_buf_u16 = dsc->dest_buf;
-    int32_t dest_stride = dsc->dest_stride;
-
-    int32_t x;
-    int32_t y;
-
-    LV_UNUSED(w);
-    LV_UNUSED(h);
-    LV_UNUSED(x);
-    LV_UNUSED(y);
-    LV_UNUSED(opa);
-    LV_UNUSED(mask);
-    LV_UNUSED(color16);
-    LV_UNUSED(mask_stride);
-    LV_UNUSED(dest_stride);
-    LV_UNUSED(dest_buf_u16);
-
-    /*Simple fill*/
-    if(mask == NULL && opa >= LV_OPA_MAX)  {
-        if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc)) {
-            for(y = 0; y < h; y++) {
-                uint16_t * dest_end_final = dest_buf_u16 + w;
-                uint32_t * dest_end_mid = (uint32_t *)((uint16_t *) dest_buf_u16 + ((w - 1) & ~(0xF)));
-                if((lv_uintptr_t)&dest_buf_u16[0] & 0x3) {
-                    dest_buf_u16[0] = color16;
-                    dest_buf_u16++;
-                }
-
-                uint32_t c32 = (uint32_t)color16 + ((uint32_t)color16 << 16);
-                uint32_t * dest32 = (uint32_t *)dest_buf_u16;
-                while(dest32 < dest_end_mid) {
-                    dest32[0] = c32;
-                    dest32[1] = c32;
-                    dest32[2] = c32;
-                    dest32[3] = c32;
-                    dest32[4] = c32;
-                    dest32[5] = c32;
-                    dest32[6] = c32;
-                    dest32[7] = c32;
-                    dest32 += 8;
-                }
-
-                dest_buf_u16 = (uint16_t *)dest32;
-
-                while(dest_buf_u16 < dest_end_final) {
-                    *dest_buf_u16 = color16;
-                    dest_buf_u16++;
-                }
-
-                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                dest_buf_u16 -= w;
-            }
-        }
-
-    }
-    /*Opacity only*/
-    else if(mask == NULL && opa < LV_OPA_MAX) {
-        if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc)) {
-            uint32_t last_dest32_color = dest_buf_u16[0] + 1; /*Set to value which is not equal to the first pixel*/
-            uint32_t last_res32_color = 0;
-
-            for(y = 0; y < h; y++) {
-                x = 0;
-                if((lv_uintptr_t)&dest_buf_u16[0] & 0x3) {
-                    dest_buf_u16[0] = lv_color_16_16_mix(color16, dest_buf_u16[0], opa);
-                    x = 1;
-                }
-
-                for(; x < w - 2; x += 2) {
-                    if(dest_buf_u16[x] != dest_buf_u16[x + 1]) {
-                        dest_buf_u16[x + 0] = lv_color_16_16_mix(color16, dest_buf_u16[x + 0], opa);
-                        dest_buf_u16[x + 1] = lv_color_16_16_mix(color16, dest_buf_u16[x + 1], opa);
-                    }
-                    else {
-                        volatile uint32_t * dest32 = (uint32_t *)&dest_buf_u16[x];
-                        if(last_dest32_color == *dest32) {
-                            *dest32 = last_res32_color;
-                        }
-                        else {
-                            last_dest32_color =  *dest32;
-
-                            dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x + 0], opa);
-                            dest_buf_u16[x + 1] = dest_buf_u16[x];
-
-                            last_res32_color = *dest32;
-                        }
-                    }
-                }
-
-                for(; x < w ; x++) {
-                    dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], opa);
-                }
-                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            }
-        }
+    blend_case_t blend_case = get_blend_case(dsc->mask_buf, dsc->opa);
 
+    lv_result_t accelerated;
+    switch(blend_case) {
+        case BLEND_CASE_COVER:
+            accelerated = LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc);
+            break;
+        case BLEND_CASE_OPA:
+            accelerated = LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc);
+            break;
+        case BLEND_CASE_MASK:
+            accelerated = LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc);
+            break;
+        default:
+            accelerated = LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc);
+            break;
     }
 
-    /*Masked with full opacity*/
-    else if(mask && opa >= LV_OPA_MAX) {
-        if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc)) {
-            for(y = 0; y < h; y++) {
-                x = 0;
-                if((lv_uintptr_t)(mask) & 0x1) {
-                    dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], mask[x]);
-                    x++;
-                }
-
-                for(; x <= w - 2; x += 2) {
-                    uint16_t mask16 = *((uint16_t *)&mask[x]);
-                    if(mask16 == 0xFFFF) {
-                        dest_buf_u16[x + 0] = color16;
-                        dest_buf_u16[x + 1] = color16;
-                    }
-                    else if(mask16 != 0) {
-                        dest_buf_u16[x + 0] = lv_color_16_16_mix(color16, dest_buf_u16[x + 0], mask[x + 0]);
-                        dest_buf_u16[x + 1] = lv_color_16_16_mix(color16, dest_buf_u16[x + 1], mask[x + 1]);
-                    }
-                }
-
-                for(; x < w ; x++) {
-                    dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], mask[x]);
-                }
-                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                mask += mask_stride;
-            }
-        }
-
-    }
-    /*Masked with opacity*/
-    else if(mask && opa < LV_OPA_MAX) {
-        if(LV_RESULT_INVALID == LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc)) {
-            for(y = 0; y < h; y++) {
-                for(x = 0; x < w; x++) {
-                    dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], LV_OPA_MIX2(mask[x], opa));
-                }
-                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                mask += mask_stride;
-            }
-        }
+    if(LV_RESULT_INVALID == accelerated) {
+        run_color_kernel(dsc, blend_case);
     }
 }
 
@@ -754,222 +660,414 @@ static void LV_ATTRIBUTE_FAST_MEM l8_image_blend(lv_draw_sw_blend_image_dsc_t *
 
 #endif
 
-static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+/*
+ * The kernels below are generated for every (source format, blend mode, opa/mask) combination.
+ * The combination is selected once per call via the `*_kernels` tables, so the inner loops
+ * contain no per-pixel branches on the opacity, the mask or the blend mode and the compiler can
+ * unroll or vectorize them freely.
+ */
+
+/*Get the mix value of a pixel. `src_px` is the current source pixel, `mask` the mask row*/
+#define MIX_OPA(src_px, mask, x, opa)               (opa)
+#define MIX_MASK(src_px, mask, x, opa)              ((mask)[x])
+#define MIX_MASK_OPA(src_px, mask, x, opa)          LV_OPA_MIX2((mask)[x], opa)
+#define MIX_ALPHA(src_px, mask, x, opa)             ((src_px)[3])
+#define MIX_ALPHA_OPA(src_px, mask, x, opa)         LV_OPA_MIX2((src_px)[3], opa)
+#define MIX_ALPHA_MASK(src_px, mask, x, opa)        LV_OPA_MIX2((src_px)[3], (mask)[x])
+#define MIX_ALPHA_MASK_OPA(src_px, mask, x, opa)    LV_OPA_MIX3((src_px)[3], (mask)[x], opa)
+
+/**
+ * Generate a color fill kernel
+ * @param name      name of the function
+ * @param get_mix   one of the `MIX_...` macros
+ */
+#define COLOR_KERNEL(name, get_mix)                                                     \
+    static void LV_ATTRIBUTE_FAST_MEM name(lv_draw_sw_blend_fill_dsc_t * dsc)           \
+    {                                                                                   \
+        int32_t w = dsc->dest_w;                                                        \
+        int32_t h = dsc->dest_h;                                                        \
+        lv_opa_t opa = dsc->opa;                                                        \
+        uint16_t color16 = lv_color_to_u16(dsc->color);                                 \
+        uint16_t * dest_buf_u16 = dsc->dest_buf;                                        \
+        const lv_opa_t * mask = dsc->mask_buf;                                          \
+        int32_t x;                                                                      \
+        int32_t y;                                                                      \
+        LV_UNUSED(opa);                                                                 \
+        for(y = 0; y < h; y++) {                                                        \
+            for(x = 0; x < w; x++) {                                                    \
+                dest_buf_u16[x] = color_16_16_mix(color16, dest_buf_u16[x],             \
+                                                  get_mix(NULL, mask, x, opa));         \
+            }                                                                           \
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);            \
+            if(mask) mask += dsc->mask_stride;                                          \
+        }                                                                               \
+    }
+
+/**
+ * Generate an image blending kernel
+ * @param name          name of the function
+ * @param src_px_size   size of a source pixel in bytes
+ * @param blend_px      function to blend a source pixel to an RGB565 pixel with a given mix
+ * @param get_mix       one of the `MIX_...` macros
+ */
+#define IMAGE_KERNEL(name, src_px_size, blend_px, get_mix)                                      \
+    static void LV_ATTRIBUTE_FAST_MEM name(lv_draw_sw_blend_image_dsc_t * dsc)                   \
+    {                                                                                           \
+        int32_t w = dsc->dest_w;                                                                \
+        int32_t h = dsc->dest_h;                                                                \
+        lv_opa_t opa = dsc->opa;                                                                \
+        uint16_t * dest_buf_u16 = dsc->dest_buf;                                                \
+        const uint8_t * src_buf_u8 = dsc->src_buf;                                              \
+        const lv_opa_t * mask = dsc->mask_buf;                                                  \
+        int32_t x;                                                                              \
+        int32_t y;                                                                              \
+        LV_UNUSED(opa);                                                                         \
+        for(y = 0; y < h; y++) {                                                                \
+            for(x = 0; x < w; x++) {                                                            \
+                const uint8_t * src_px = &src_buf_u8[x * (src_px_size)];                        \
+                dest_buf_u16[x] = blend_px(src_px, dest_buf_u16[x], get_mix(src_px, mask, x, opa)); \
+            }                                                                                   \
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);                    \
+            src_buf_u8 += dsc->src_stride;                                                      \
+            if(mask) mask += dsc->mask_stride;                                                  \
+        }                                                                                       \
+    }
+
+/*Generate the opa, mask and mask+opa kernels of a source without alpha channel*/
+#define IMAGE_KERNELS_NO_ALPHA(prefix, src_px_size, blend_px)                   \
+    IMAGE_KERNEL(prefix##_opa, src_px_size, blend_px, MIX_OPA)                  \
+    IMAGE_KERNEL(prefix##_mask, src_px_size, blend_px, MIX_MASK)                \
+    IMAGE_KERNEL(prefix##_mask_opa, src_px_size, blend_px, MIX_MASK_OPA)
+
+/*Generate the kernels of a blend mode of a source without alpha channel.
+ *Only normal blending can skip mixing if there is no opa and mask*/
+#define IMAGE_KERNELS_NO_ALPHA_MODE(prefix, src_px_size, blend_px)              \
+    IMAGE_KERNEL(prefix##_cover, src_px_size, blend_px, MIX_OPA)                \
+    IMAGE_KERNELS_NO_ALPHA(prefix, src_px_size, blend_px)
+
+/*Generate all kernels of a blend mode of a source with alpha channel*/
+#define IMAGE_KERNELS_ALPHA(prefix, blend_px)                                   \
+    IMAGE_KERNEL(prefix##_cover, 4, blend_px, MIX_ALPHA)                        \
+    IMAGE_KERNEL(prefix##_opa, 4, blend_px, MIX_ALPHA_OPA)                      \
+    IMAGE_KERNEL(prefix##_mask, 4, blend_px, MIX_ALPHA_MASK)                    \
+    IMAGE_KERNEL(prefix##_mask_opa, 4, blend_px, MIX_ALPHA_MASK_OPA)
+
+/*A row of a kernel table in `blend_case_t` order*/
+#define KERNEL_ROW(prefix) {prefix##_cover, prefix##_opa, prefix##_mask, prefix##_mask_opa}
+
+/**
+ * Simple fill. Uses `lv_memset` if both bytes of the color are the same (e.g. black or white),
+ * else writes 4 pixels at once from 8 byte aligned addresses.
+ */
+static void LV_ATTRIBUTE_FAST_MEM color_cover(lv_draw_sw_blend_fill_dsc_t * dsc)
 {
     int32_t w = dsc->dest_w;
     int32_t h = dsc->dest_h;
-    lv_opa_t opa = dsc->opa;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
     uint16_t * dest_buf_u16 = dsc->dest_buf;
     int32_t dest_stride = dsc->dest_stride;
-    const uint16_t * src_buf_u16 = dsc->src_buf;
-    int32_t src_stride = dsc->src_stride;
-    const lv_opa_t * mask_buf = dsc->mask_buf;
-    int32_t mask_stride = dsc->mask_stride;
-
-    int32_t x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)) {
-                uint32_t line_in_bytes = w * 2;
-                for(y = 0; y < h; y++) {
-                    lv_memcpy(dest_buf_u16, src_buf_u16, line_in_bytes);
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], opa);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                }
-            }
-        }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                    mask_buf += mask_stride;
-                }
-            }
-        }
-        else {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(x = 0; x < w; x++) {
-                        dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-                    mask_buf += mask_stride;
-                }
-            }
-        }
+    /*If there is no gap between the rows fill them as one long row*/
+    if(dest_stride == w * 2) {
+        w *= h;
+        h = 1;
     }
-    else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *) dest_buf_u16;
-            lv_color16_t * src_buf_c16 = (lv_color16_t *) src_buf_u16;
-            for(x = 0; x < w; x++) {
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        if(src_buf_u16[x] == 0x0000) continue;   /*Do not add pure black*/
-                        res = (LV_MIN(dest_buf_c16[x].red + src_buf_c16[x].red, 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[x].green + src_buf_c16[x].green, 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[x].blue + src_buf_c16[x].blue, 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        if(src_buf_u16[x] == 0x0000) continue;   /*Do not subtract pure black*/
-                        res = (LV_MAX(dest_buf_c16[x].red - src_buf_c16[x].red, 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[x].green - src_buf_c16[x].green, 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[x].blue - src_buf_c16[x].blue, 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        if(src_buf_u16[x] == 0xffff) continue;   /*Do not multiply with pure white (considered as 1)*/
-                        res = ((dest_buf_c16[x].red * src_buf_c16[x].red) >> 5) << 11;
-                        res += ((dest_buf_c16[x].green * src_buf_c16[x].green) >> 6) << 5;
-                        res += (dest_buf_c16[x].blue * src_buf_c16[x].blue) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
-
-                if(mask_buf == NULL) {
-                    dest_buf_u16[x] = lv_color_16_16_mix(res, dest_buf_u16[x], opa);
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[x] = lv_color_16_16_mix(res, dest_buf_u16[x], mask_buf[x]);
-                    else dest_buf_u16[x] = lv_color_16_16_mix(res, dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
-                }
-            }
 
+    if((color16 >> 8) == (color16 & 0xFF)) {
+        for(y = 0; y < h; y++) {
+            lv_memset(dest_buf_u16, (uint8_t)color16, w * 2);
             dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
-            if(mask_buf) mask_buf += mask_stride;
         }
+        return;
+    }
+
+    for(y = 0; y < h; y++) {
+        fill_row_u16(dest_buf_u16, color16, w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
     }
 }
 
-#if LV_DRAW_SW_SUPPORT_RGB888
+COLOR_KERNEL(color_opa, MIX_OPA)
+COLOR_KERNEL(color_mask, MIX_MASK)
+COLOR_KERNEL(color_mask_opa, MIX_MASK_OPA)
 
-static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc, const uint8_t src_px_size)
+static const fill_kernel_t color_kernels[BLEND_CASE_NUM] = KERNEL_ROW(color);
+
+static void LV_ATTRIBUTE_FAST_MEM run_color_kernel(lv_draw_sw_blend_fill_dsc_t * dsc, blend_case_t blend_case)
+{
+    color_kernels[blend_case](dsc);
+}
+
+/*The pixel blending functions of the image kernels. `mix` is always applied as the last step*/
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb565_normal_px(const uint8_t * src_px, uint16_t dest, lv_opa_t mix)
+{
+    return color_16_16_mix(*(const uint16_t *)src_px, dest, mix);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb565_additive_px(const uint8_t * src_px, uint16_t dest, lv_opa_t mix)
+{
+    uint16_t src = *(const uint16_t *)src_px;
+    return color_16_16_mix(additive_565(dest, src >> 11, (src >> 5) & 0x3F, src & 0x1F), dest, mix);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb565_subtractive_px(const uint8_t * src_px, uint16_t dest,
+                                                                   lv_opa_t mix)
+{
+    uint16_t src = *(const uint16_t *)src_px;
+    return color_16_16_mix(subtractive_565(dest, src >> 11, (src >> 5) & 0x3F, src & 0x1F), dest, mix);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb565_multiply_px(const uint8_t * src_px, uint16_t dest, lv_opa_t mix)
+{
+    uint16_t src = *(const uint16_t *)src_px;
+    uint16_t res = multiply_565(dest, src >> 11, (src >> 5) & 0x3F, src & 0x1F);
+    /*White doesn't change the destination (`multiply_565` would round it down)*/
+    res = src == 0xffff ? dest : res;
+    return color_16_16_mix(res, dest, mix);
+}
+
+/*Used by the kernels of RGB888, XRGB8888 and ARGB8888*/
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb888_convert_px(const uint8_t * src_px, uint16_t dest, lv_opa_t mix)
+{
+    LV_UNUSED(dest);
+    LV_UNUSED(mix);
+    return ((src_px[2] & 0xF8) << 8) + ((src_px[1] & 0xFC) << 3) + ((src_px[0] & 0xF8) >> 3);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb888_normal_px(const uint8_t * src_px, uint16_t dest, lv_opa_t mix)
+{
+    return lv_color_24_16_mix(src_px, dest, mix);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb888_additive_px(const uint8_t * src_px, uint16_t dest, lv_opa_t mix)
+{
+    return color_16_16_mix(additive_565(dest, src_px[2] >> 3, src_px[1] >> 2, src_px[0] >> 3), dest, mix);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb888_subtractive_px(const uint8_t * src_px, uint16_t dest,
+                                                                   lv_opa_t mix)
+{
+    return color_16_16_mix(subtractive_565(dest, src_px[2] >> 3, src_px[1] >> 2, src_px[0] >> 3), dest, mix);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM rgb888_multiply_px(const uint8_t * src_px, uint16_t dest, lv_opa_t mix)
+{
+    return color_16_16_mix(multiply_565(dest, src_px[2] >> 3, src_px[1] >> 2, src_px[0] >> 3), dest, mix);
+}
+
+/**
+ * Copy the rows of an RGB565 image
+ */
+static void LV_ATTRIBUTE_FAST_MEM rgb565_normal_cover(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t h = dsc->dest_h;
+    uint32_t line_in_bytes = dsc->dest_w * 2;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    int32_t y;
+
+    /*If there is no gap between the rows copy them at once*/
+    if(dsc->dest_stride == (int32_t)line_in_bytes && dsc->src_stride == (int32_t)line_in_bytes) {
+        line_in_bytes *= h;
+        h = 1;
+    }
+
+    for(y = 0; y < h; y++) {
+        lv_memcpy(dest_buf_u16, src_buf_u16, line_in_bytes);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+    }
+}
+
+/**
+ * Blend the rows of an RGB565 image with a mask, optionally with opacity too.
+ * RGB565A8 images and layers are blended this way with their alpha plane as mask.
+ * These are mostly fully transparent or fully opaque, so the mask is checked 4 pixels at once
+ * to skip or copy them without mixing.
+ * @param dsc       the image blend descriptor
+ * @param with_opa  false if `dsc->opa` can be ignored (it's `LV_OPA_COVER`)
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM rgb565_normal_masked(lv_draw_sw_blend_image_dsc_t * dsc, bool with_opa)
 {
     int32_t w = dsc->dest_w;
     int32_t h = dsc->dest_h;
     lv_opa_t opa = dsc->opa;
     uint16_t * dest_buf_u16 = dsc->dest_buf;
-    int32_t dest_stride = dsc->dest_stride;
-    const uint8_t * src_buf_u8 = dsc->src_buf;
-    int32_t src_stride = dsc->src_stride;
-    const lv_opa_t * mask_buf = dsc->mask_buf;
-    int32_t mask_stride = dsc->mask_stride;
-
-    int32_t dest_x;
-    int32_t src_x;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t x;
     int32_t y;
 
-    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x]  = ((src_buf_u8[src_x + 2] & 0xF8) << 8) +
-                                                ((src_buf_u8[src_x + 1] & 0xFC) << 3) +
-                                                ((src_buf_u8[src_x + 0] & 0xF8) >> 3);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                }
-            }
+#define MASKED_MIX(i) (with_opa ? LV_OPA_MIX2(mask[i], opa) : mask[i])
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w && ((lv_uintptr_t)&mask[x] & 0x3); x++) {
+            dest_buf_u16[x] = color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], MASKED_MIX(x));
         }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], opa);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                }
+
+        for(; x + 4 <= w; x += 4) {
+            uint32_t mask32 = *(const uint32_t *)&mask[x];
+            if(mask32 == 0) continue;
+
+            if(mask32 == 0xFFFFFFFF && !with_opa) {
+                dest_buf_u16[x] = src_buf_u16[x];
+                dest_buf_u16[x + 1] = src_buf_u16[x + 1];
+                dest_buf_u16[x + 2] = src_buf_u16[x + 2];
+                dest_buf_u16[x + 3] = src_buf_u16[x + 3];
+                continue;
             }
+
+            dest_buf_u16[x] = color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], MASKED_MIX(x));
+            dest_buf_u16[x + 1] = color_16_16_mix(src_buf_u16[x + 1], dest_buf_u16[x + 1], MASKED_MIX(x + 1));
+            dest_buf_u16[x + 2] = color_16_16_mix(src_buf_u16[x + 2], dest_buf_u16[x + 2], MASKED_MIX(x + 2));
+            dest_buf_u16[x + 3] = color_16_16_mix(src_buf_u16[x + 3], dest_buf_u16[x + 3], MASKED_MIX(x + 3));
         }
-        if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
-                }
-            }
+
+        for(; x < w; x++) {
+            dest_buf_u16[x] = color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], MASKED_MIX(x));
         }
-        if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, src_px_size)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
-                }
-            }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        mask += dsc->mask_stride;
+    }
+
+#undef MASKED_MIX
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_normal_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_normal_masked(dsc, false);
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_normal_mask_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_normal_masked(dsc, true);
+}
+
+IMAGE_KERNEL(rgb565_normal_opa, 2, rgb565_normal_px, MIX_OPA)
+IMAGE_KERNELS_NO_ALPHA_MODE(rgb565_additive, 2, rgb565_additive_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(rgb565_subtractive, 2, rgb565_subtractive_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(rgb565_multiply, 2, rgb565_multiply_px)
+
+/*Indexed by `lv_blend_mode_t` and `blend_case_t`*/
+static const image_kernel_t rgb565_kernels[][BLEND_CASE_NUM] = {
+    KERNEL_ROW(rgb565_normal),
+    KERNEL_ROW(rgb565_additive),
+    KERNEL_ROW(rgb565_subtractive),
+    KERNEL_ROW(rgb565_multiply),
+};
+
+#if LV_DRAW_SW_SUPPORT_RGB888
+IMAGE_KERNEL(rgb888_normal_cover, 3, rgb888_convert_px, MIX_OPA)
+IMAGE_KERNELS_NO_ALPHA(rgb888_normal, 3, rgb888_normal_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(rgb888_additive, 3, rgb888_additive_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(rgb888_subtractive, 3, rgb888_subtractive_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(rgb888_multiply, 3, rgb888_multiply_px)
+
+static const image_kernel_t rgb888_kernels[][BLEND_CASE_NUM] = {
+    KERNEL_ROW(rgb888_normal),
+    KERNEL_ROW(rgb888_additive),
+    KERNEL_ROW(rgb888_subtractive),
+    KERNEL_ROW(rgb888_multiply),
+};
+#endif
+
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+IMAGE_KERNEL(xrgb8888_normal_cover, 4, rgb888_convert_px, MIX_OPA)
+IMAGE_KERNELS_NO_ALPHA(xrgb8888_normal, 4, rgb888_normal_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(xrgb8888_additive, 4, rgb888_additive_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(xrgb8888_subtractive, 4, rgb888_subtractive_px)
+IMAGE_KERNELS_NO_ALPHA_MODE(xrgb8888_multiply, 4, rgb888_multiply_px)
+
+static const image_kernel_t xrgb8888_kernels[][BLEND_CASE_NUM] = {
+    KERNEL_ROW(xrgb8888_normal),
+    KERNEL_ROW(xrgb8888_additive),
+    KERNEL_ROW(xrgb8888_subtractive),
+    KERNEL_ROW(xrgb8888_multiply),
+};
+#endif
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+IMAGE_KERNELS_ALPHA(argb8888_normal, rgb888_normal_px)
+IMAGE_KERNELS_ALPHA(argb8888_additive, rgb888_additive_px)
+IMAGE_KERNELS_ALPHA(argb8888_subtractive, rgb888_subtractive_px)
+IMAGE_KERNELS_ALPHA(argb8888_multiply, rgb888_multiply_px)
+
+static const image_kernel_t argb8888_kernels[][BLEND_CASE_NUM] = {
+    KERNEL_ROW(argb8888_normal),
+    KERNEL_ROW(argb8888_additive),
+    KERNEL_ROW(argb8888_subtractive),
+    KERNEL_ROW(argb8888_multiply),
+};
+#endif
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_case_t blend_case = get_blend_case(dsc->mask_buf, dsc->opa);
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        lv_result_t accelerated;
+        switch(blend_case) {
+            case BLEND_CASE_COVER:
+                accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc);
+                break;
+            case BLEND_CASE_OPA:
+                accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc);
+                break;
+            case BLEND_CASE_MASK:
+                accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc);
+                break;
+            default:
+                accelerated = LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc);
+                break;
         }
+        if(LV_RESULT_OK == accelerated) return;
     }
-    else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *) dest_buf_u16;
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        res = (LV_MIN(dest_buf_c16[dest_x].red + (src_buf_u8[src_x + 2] >> 3), 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[dest_x].green + (src_buf_u8[src_x + 1] >> 2), 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[dest_x].blue + (src_buf_u8[src_x + 0] >> 3), 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        res = (LV_MAX(dest_buf_c16[dest_x].red - (src_buf_u8[src_x + 2] >> 3), 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[dest_x].green - (src_buf_u8[src_x + 1] >> 2), 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[dest_x].blue - (src_buf_u8[src_x + 0] >> 3), 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        res = ((dest_buf_c16[dest_x].red * (src_buf_u8[src_x + 2] >> 3)) >> 5) << 11;
-                        res += ((dest_buf_c16[dest_x].green * (src_buf_u8[src_x + 1] >> 2)) >> 6) << 5;
-                        res += (dest_buf_c16[dest_x].blue * (src_buf_u8[src_x + 0] >> 3)) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
 
-                if(mask_buf == NULL) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], opa);
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    else dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
-                }
-            }
-            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_u8 += src_stride;
-            if(mask_buf) mask_buf += mask_stride;
+    run_image_kernel(rgb565_kernels, dsc, blend_case);
+}
+
+#if LV_DRAW_SW_SUPPORT_RGB888 || LV_DRAW_SW_SUPPORT_XRGB8888
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc, const uint8_t src_px_size)
+{
+    blend_case_t blend_case = get_blend_case(dsc->mask_buf, dsc->opa);
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        lv_result_t accelerated;
+        switch(blend_case) {
+            case BLEND_CASE_COVER:
+                accelerated = LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, src_px_size);
+                break;
+            case BLEND_CASE_OPA:
+                accelerated = LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, src_px_size);
+                break;
+            case BLEND_CASE_MASK:
+                accelerated = LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, src_px_size);
+                break;
+            default:
+                accelerated = LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, src_px_size);
+                break;
         }
+        if(LV_RESULT_OK == accelerated) return;
+    }
 
+#if LV_DRAW_SW_SUPPORT_RGB888
+    if(src_px_size == 3) {
+        run_image_kernel(rgb888_kernels, dsc, blend_case);
+        return;
     }
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+    if(src_px_size == 4) {
+        run_image_kernel(xrgb8888_kernels, dsc, blend_case);
+        return;
+    }
+#endif
 }
 
 #endif
@@ -978,118 +1076,86 @@ static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_
 
 static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
 {
-    int32_t w = dsc->dest_w;
-    int32_t h = dsc->dest_h;
-    lv_opa_t opa = dsc->opa;
-    uint16_t * dest_buf_u16 = dsc->dest_buf;
-    int32_t dest_stride = dsc->dest_stride;
-    const uint8_t * src_buf_u8 = dsc->src_buf;
-    int32_t src_stride = dsc->src_stride;
-    const lv_opa_t * mask_buf = dsc->mask_buf;
-    int32_t mask_stride = dsc->mask_stride;
-
-    int32_t dest_x;
-    int32_t src_x;
-    int32_t y;
+    blend_case_t blend_case = get_blend_case(dsc->mask_buf, dsc->opa);
 
     if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
-        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], src_buf_u8[src_x + 3]);
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                }
-            }
-        }
-        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x], LV_OPA_MIX2(src_buf_u8[src_x + 3],
-                                                                                                                        opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                }
-            }
-        }
-        else if(mask_buf && opa >= LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
-                                                                  LV_OPA_MIX2(src_buf_u8[src_x + 3], mask_buf[dest_x]));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
-                }
-            }
-        }
-        else if(mask_buf && opa < LV_OPA_MAX) {
-            if(LV_RESULT_INVALID == LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)) {
-                for(y = 0; y < h; y++) {
-                    for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                        dest_buf_u16[dest_x] = lv_color_24_16_mix(&src_buf_u8[src_x], dest_buf_u16[dest_x],
-                                                                  LV_OPA_MIX3(src_buf_u8[src_x + 3], mask_buf[dest_x], opa));
-                    }
-                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-                    src_buf_u8 += src_stride;
-                    mask_buf += mask_stride;
-                }
-            }
+        lv_result_t accelerated;
+        switch(blend_case) {
+            case BLEND_CASE_COVER:
+                accelerated = LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc);
+                break;
+            case BLEND_CASE_OPA:
+                accelerated = LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc);
+                break;
+            case BLEND_CASE_MASK:
+                accelerated = LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc);
+                break;
+            default:
+                accelerated = LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc);
+                break;
         }
+        if(LV_RESULT_OK == accelerated) return;
     }
-    else {
-        uint16_t res = 0;
-        for(y = 0; y < h; y++) {
-            lv_color16_t * dest_buf_c16 = (lv_color16_t *) dest_buf_u16;
-            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
-                switch(dsc->blend_mode) {
-                    case LV_BLEND_MODE_ADDITIVE:
-                        res = (LV_MIN(dest_buf_c16[dest_x].red + (src_buf_u8[src_x + 2] >> 3), 31)) << 11;
-                        res += (LV_MIN(dest_buf_c16[dest_x].green + (src_buf_u8[src_x + 1] >> 2), 63)) << 5;
-                        res += LV_MIN(dest_buf_c16[dest_x].blue + (src_buf_u8[src_x + 0] >> 3), 31);
-                        break;
-                    case LV_BLEND_MODE_SUBTRACTIVE:
-                        res = (LV_MAX(dest_buf_c16[dest_x].red - (src_buf_u8[src_x + 2] >> 3), 0)) << 11;
-                        res += (LV_MAX(dest_buf_c16[dest_x].green - (src_buf_u8[src_x + 1] >> 2), 0)) << 5;
-                        res += LV_MAX(dest_buf_c16[dest_x].blue - (src_buf_u8[src_x + 0] >> 3), 0);
-                        break;
-                    case LV_BLEND_MODE_MULTIPLY:
-                        res = ((dest_buf_c16[dest_x].red * (src_buf_u8[src_x + 2] >> 3)) >> 5) << 11;
-                        res += ((dest_buf_c16[dest_x].green * (src_buf_u8[src_x + 1] >> 2)) >> 6) << 5;
-                        res += (dest_buf_c16[dest_x].blue * (src_buf_u8[src_x + 0] >> 3)) >> 5;
-                        break;
-                    default:
-                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
-                        return;
-                }
 
-                if(mask_buf == NULL && opa >= LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], src_buf_u8[src_x + 3]);
-                }
-                else if(mask_buf == NULL && opa < LV_OPA_MAX) {
-                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa, src_buf_u8[src_x + 3]));
-                }
-                else {
-                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
-                    else dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x], opa,
-                                                                                                              src_buf_u8[src_x + 3]));
-                }
-            }
+    run_image_kernel(argb8888_kernels, dsc, blend_case);
+}
 
-            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
-            src_buf_u8 += src_stride;
-            if(mask_buf) mask_buf += mask_stride;
-        }
+#endif
+
+static inline blend_case_t LV_ATTRIBUTE_FAST_MEM get_blend_case(const lv_opa_t * mask, lv_opa_t opa)
+{
+    if(mask == NULL) return opa >= LV_OPA_MAX ? BLEND_CASE_COVER : BLEND_CASE_OPA;
+    else return opa >= LV_OPA_MAX ? BLEND_CASE_MASK : BLEND_CASE_MASK_OPA;
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM run_image_kernel(const image_kernel_t kernels[][BLEND_CASE_NUM],
+                                                          lv_draw_sw_blend_image_dsc_t * dsc, blend_case_t blend_case)
+{
+    if(dsc->blend_mode > LV_BLEND_MODE_MULTIPLY) {
+        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
+        return;
     }
+
+    kernels[dsc->blend_mode][blend_case](dsc);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM additive_565(uint16_t dest, uint32_t r, uint32_t g, uint32_t b)
+{
+    r += dest >> 11;
+    g += (dest >> 5) & 0x3F;
+    b += dest & 0x1F;
+    return (LV_MIN(r, 31) << 11) + (LV_MIN(g, 63) << 5) + LV_MIN(b, 31);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM subtractive_565(uint16_t dest, uint32_t r, uint32_t g, uint32_t b)
+{
+    int32_t res_r = (int32_t)(dest >> 11) - (int32_t)r;
+    int32_t res_g = (int32_t)((dest >> 5) & 0x3F) - (int32_t)g;
+    int32_t res_b = (int32_t)(dest & 0x1F) - (int32_t)b;
+    return (LV_MAX(res_r, 0) << 11) + (LV_MAX(res_g, 0) << 5) + LV_MAX(res_b, 0);
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM multiply_565(uint16_t dest, uint32_t r, uint32_t g, uint32_t b)
+{
+    r = (r * (dest >> 11)) >> 5;
+    g = (g * ((dest >> 5) & 0x3F)) >> 6;
+    b = (b * (dest & 0x1F)) >> 5;
+    return (r << 11) + (g << 5) + b;
+}
+
+/**
+ * Same as `lv_color_16_16_mix` but without early returns so that it can be inlined in the kernels.
+ * The result is the same for every input.
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+    uint32_t mix32 = ((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix32) >> 5) + bg) & 0x7E0F81F;
+    return (uint16_t)((result >> 16) | result);
 }
 
-#endif
 
 static inline uint16_t LV_ATTRIBUTE_FAST_MEM l8_to_rgb565(const uint8_t c1)
 {
@@ -1116,19 +1182,16 @@ static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_8_16_mix(const uint8_t c1,
 
 static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix)
 {
-    if(mix == 0) {
-        return c2;
-    }
-    else if(mix == 255) {
-        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
-    }
-    else {
-        lv_opa_t mix_inv = 255 - mix;
+    lv_opa_t mix_inv = 255 - mix;
 
-        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
-               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
-               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
-    }
+    uint16_t full = ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    uint16_t mixed = ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+                     ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+                     (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+
+    /*Select instead of returning early to keep the loops of the kernels branch-free*/
+    uint16_t res = mix == 255 ? full : mixed;
+    return mix == 0 ? c2 : res;
 }
 
 #if LV_DRAW_SW_SUPPORT_I1
@@ -1140,6 +1203,56 @@ static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_bit(const uint8_t * buf, int32_t
 
 #endif
 
+/**
+ * Fill `w` RGB565 pixels with a color. The body is aligned to 8 bytes and written
+ * with 64 bit stores (4 pixels), the unaligned head and tail with 16 and 32 bit stores.
+ * @param dest      pointer to the first pixel
+ * @param color16   the color to write
+ * @param w         number of pixels
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM fill_row_u16(uint16_t * dest, uint16_t color16, int32_t w)
+{
+    uint32_t c32 = (uint32_t)color16 | ((uint32_t)color16 << 16);
+    uint64_t c64 = (uint64_t)c32 | ((uint64_t)c32 << 32);
+
+    if(w > 0 && ((lv_uintptr_t)dest & 0x2)) {
+        *dest = color16;
+        dest++;
+        w--;
+    }
+
+    if(w >= 2 && ((lv_uintptr_t)dest & 0x4)) {
+        *(uint32_t *)dest = c32;
+        dest += 2;
+        w -= 2;
+    }
+
+    uint64_t * dest64 = (uint64_t *)dest;
+    while(w >= 16) {
+        dest64[0] = c64;
+        dest64[1] = c64;
+        dest64[2] = c64;
+        dest64[3] = c64;
+        dest64 += 4;
+        w -= 16;
+    }
+
+    while(w >= 4) {
+        *dest64 = c64;
+        dest64++;
+        w -= 4;
+    }
+
+    dest = (uint16_t *)dest64;
+    if(w >= 2) {
+        *(uint32_t *)dest = c32;
+        dest += 2;
+        w -= 2;
+    }
+
+    if(w) *dest = color16;
+}
+
 static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
 {
     return (void *)((uint8_t *)buf + stride);
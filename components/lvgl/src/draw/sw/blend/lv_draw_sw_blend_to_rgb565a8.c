@@ -0,0 +1,486 @@
+/**
+ * @file lv_draw_sw_blend_to_rgb565a8.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_to_rgb565a8.h"
+#if LV_USE_DRAW_SW
+
+#if LV_DRAW_SW_SUPPORT_RGB565A8
+
+#include "lv_draw_sw_blend_private.h"
+#include "../../../misc/lv_math.h"
+#include "../../../misc/lv_color.h"
+#include "../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*The variants of each blend mode. The kernel tables are indexed by it*/
+typedef enum {
+    BLEND_CASE_COVER,
+    BLEND_CASE_OPA,
+    BLEND_CASE_MASK,
+    BLEND_CASE_MASK_OPA,
+    BLEND_CASE_NUM,
+} blend_case_t;
+
+/*The last alpha values mixed on a not fully opaque background and the result*/
+typedef struct {
+    lv_opa_t fg_opa;
+    lv_opa_t bg_opa;
+    lv_opa_t res_opa;
+    lv_opa_t ratio;
+} alpha_cache_t;
+
+typedef void (*fill_kernel_t)(lv_draw_sw_blend_fill_dsc_t * dsc, lv_opa_t * dest_alpha, int32_t alpha_stride);
+
+typedef void (*image_kernel_t)(lv_draw_sw_blend_image_dsc_t * dsc, lv_opa_t * dest_alpha, int32_t alpha_stride);
+
+/*The kernels of a source color format*/
+typedef struct {
+    image_kernel_t normal[BLEND_CASE_NUM];  /**< Normal blending in `blend_case_t` order*/
+    image_kernel_t mode;                    /**< Other blend modes*/
+} image_kernel_set_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ run_color_kernel(lv_draw_sw_blend_fill_dsc_t * dsc, lv_opa_t * dest_alpha,
+                                                         int32_t alpha_stride);
+
+static const image_kernel_set_t * get_image_kernels(lv_color_format_t cf);
+
+static inline blend_case_t /* LV_ATTRIBUTE_FAST_MEM */ get_blend_case(const lv_opa_t * mask, lv_opa_t opa);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_px(uint16_t * dest, lv_opa_t * dest_alpha, uint16_t color,
+                                                        lv_opa_t opa, alpha_cache_t * cache);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ blend_mode_px(lv_blend_mode_t mode, uint16_t src, uint16_t dest);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix);
+
+static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/*Get the mix value of a pixel. `alpha` is the alpha of the source pixel, `mask` the mask row*/
+#define MIX_OPA(alpha, mask, x, opa)                (opa)
+#define MIX_MASK(alpha, mask, x, opa)               ((mask)[x])
+#define MIX_MASK_OPA(alpha, mask, x, opa)           LV_OPA_MIX2((mask)[x], opa)
+#define MIX_ALPHA(alpha, mask, x, opa)              (alpha)
+#define MIX_ALPHA_OPA(alpha, mask, x, opa)          LV_OPA_MIX2(alpha, opa)
+#define MIX_ALPHA_MASK(alpha, mask, x, opa)         LV_OPA_MIX2(alpha, (mask)[x])
+#define MIX_ALPHA_MASK_OPA(alpha, mask, x, opa)     LV_OPA_MIX3(alpha, (mask)[x], opa)
+
+/*Read a source pixel as RGB565*/
+#define READ_RGB565(src_px)     (*(const uint16_t *)(src_px))
+#define READ_RGB888(src_px)     ((((src_px)[2] & 0xF8) << 8) + (((src_px)[1] & 0xFC) << 3) + ((src_px)[0] >> 3))
+#define READ_L8(src_px)         ((((src_px)[0] & 0xF8) << 8) + (((src_px)[0] & 0xFC) << 3) + ((src_px)[0] >> 3))
+
+/**
+ * Generate a color fill kernel
+ * @param name      name of the function
+ * @param get_mix   one of the `MIX_...` macros without alpha
+ */
+#define COLOR_KERNEL(name, get_mix)                                                                         \
+    static void LV_ATTRIBUTE_FAST_MEM name(lv_draw_sw_blend_fill_dsc_t * dsc, lv_opa_t * dest_alpha,        \
+                                           int32_t alpha_stride)                                            \
+    {                                                                                                       \
+        int32_t w = dsc->dest_w;                                                                            \
+        int32_t h = dsc->dest_h;                                                                            \
+        lv_opa_t opa = dsc->opa;                                                                            \
+        uint16_t color16 = lv_color_to_u16(dsc->color);                                                     \
+        uint16_t * dest_buf_u16 = dsc->dest_buf;                                                            \
+        const lv_opa_t * mask = dsc->mask_buf;                                                              \
+        alpha_cache_t cache = {0};                                                                          \
+        int32_t x;                                                                                          \
+        int32_t y;                                                                                          \
+        LV_UNUSED(opa);                                                                                     \
+        for(y = 0; y < h; y++) {                                                                            \
+            for(x = 0; x < w; x++) {                                                                        \
+                blend_px(&dest_buf_u16[x], &dest_alpha[x], color16, get_mix(0, mask, x, opa), &cache);      \
+            }                                                                                               \
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);                                \
+            dest_alpha += alpha_stride;                                                                     \
+            if(mask) mask += dsc->mask_stride;                                                              \
+        }                                                                                                   \
+    }
+
+/**
+ * Generate an image blending kernel for normal blending
+ * @param name          name of the function
+ * @param src_px_size   size of a source pixel in bytes
+ * @param read_px       one of the `READ_...` macros
+ * @param alpha_ofs     offset of the alpha channel in the source pixel (ignored by sources without alpha)
+ * @param get_mix       one of the `MIX_...` macros
+ */
+#define IMAGE_KERNEL(name, src_px_size, read_px, alpha_ofs, get_mix)                                        \
+    static void LV_ATTRIBUTE_FAST_MEM name(lv_draw_sw_blend_image_dsc_t * dsc, lv_opa_t * dest_alpha,       \
+                                           int32_t alpha_stride)                                            \
+    {                                                                                                       \
+        int32_t w = dsc->dest_w;                                                                            \
+        int32_t h = dsc->dest_h;                                                                            \
+        lv_opa_t opa = dsc->opa;                                                                            \
+        uint16_t * dest_buf_u16 = dsc->dest_buf;                                                            \
+        const uint8_t * src_buf_u8 = dsc->src_buf;                                                          \
+        const lv_opa_t * mask = dsc->mask_buf;                                                              \
+        alpha_cache_t cache = {0};                                                                          \
+        int32_t x;                                                                                          \
+        int32_t y;                                                                                          \
+        LV_UNUSED(opa);                                                                                     \
+        for(y = 0; y < h; y++) {                                                                            \
+            for(x = 0; x < w; x++) {                                                                        \
+                const uint8_t * src_px = &src_buf_u8[x * (src_px_size)];                                    \
+                blend_px(&dest_buf_u16[x], &dest_alpha[x], read_px(src_px),                                 \
+                         get_mix(src_px[alpha_ofs], mask, x, opa), &cache);                                 \
+            }                                                                                               \
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);                                \
+            dest_alpha += alpha_stride;                                                                     \
+            src_buf_u8 += dsc->src_stride;                                                                  \
+            if(mask) mask += dsc->mask_stride;                                                              \
+        }                                                                                                   \
+    }
+
+/**
+ * Generate an image blending kernel for the additive, subtractive and multiply blend modes.
+ * These are rarely used so a single kernel handles all of them and all opa/mask cases.
+ * @param name          name of the function
+ * @param src_px_size   size of a source pixel in bytes
+ * @param read_px       one of the `READ_...` macros
+ * @param alpha_ofs     offset of the alpha channel in the source pixel or -1 if there is no alpha channel
+ */
+#define IMAGE_MODE_KERNEL(name, src_px_size, read_px, alpha_ofs)                                            \
+    static void LV_ATTRIBUTE_FAST_MEM name(lv_draw_sw_blend_image_dsc_t * dsc, lv_opa_t * dest_alpha,       \
+                                           int32_t alpha_stride)                                            \
+    {                                                                                                       \
+        int32_t w = dsc->dest_w;                                                                            \
+        int32_t h = dsc->dest_h;                                                                            \
+        lv_opa_t opa = dsc->opa;                                                                            \
+        uint16_t * dest_buf_u16 = dsc->dest_buf;                                                            \
+        const uint8_t * src_buf_u8 = dsc->src_buf;                                                          \
+        const lv_opa_t * mask = dsc->mask_buf;                                                              \
+        alpha_cache_t cache = {0};                                                                          \
+        int32_t x;                                                                                          \
+        int32_t y;                                                                                          \
+        for(y = 0; y < h; y++) {                                                                            \
+            for(x = 0; x < w; x++) {                                                                        \
+                const uint8_t * src_px = &src_buf_u8[x * (src_px_size)];                                    \
+                lv_opa_t mix = (alpha_ofs) < 0 ? LV_OPA_COVER : src_px[(alpha_ofs) < 0 ? 0 : (alpha_ofs)];  \
+                if(mask) mix = mix == LV_OPA_COVER ? mask[x] : LV_OPA_MIX2(mix, mask[x]);                   \
+                if(opa < LV_OPA_MAX) mix = LV_OPA_MIX2(mix, opa);                                           \
+                uint16_t res = blend_mode_px(dsc->blend_mode, read_px(src_px), dest_buf_u16[x]);            \
+                blend_px(&dest_buf_u16[x], &dest_alpha[x], res, mix, &cache);                               \
+            }                                                                                               \
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);                                \
+            dest_alpha += alpha_stride;                                                                     \
+            src_buf_u8 += dsc->src_stride;                                                                  \
+            if(mask) mask += dsc->mask_stride;                                                              \
+        }                                                                                                   \
+    }
+
+/*Generate the opa, mask and mask+opa kernels of a source without alpha channel*/
+#define IMAGE_KERNELS_NO_ALPHA(prefix, src_px_size, read_px)                    \
+    IMAGE_KERNEL(prefix##_opa, src_px_size, read_px, 0, MIX_OPA)                \
+    IMAGE_KERNEL(prefix##_mask, src_px_size, read_px, 0, MIX_MASK)              \
+    IMAGE_KERNEL(prefix##_mask_opa, src_px_size, read_px, 0, MIX_MASK_OPA)      \
+    IMAGE_MODE_KERNEL(prefix##_mode, src_px_size, read_px, -1)
+
+/*Generate all kernels of a source with alpha channel*/
+#define IMAGE_KERNELS_ALPHA(prefix, src_px_size, read_px, alpha_ofs)                    \
+    IMAGE_KERNEL(prefix##_cover, src_px_size, read_px, alpha_ofs, MIX_ALPHA)            \
+    IMAGE_KERNEL(prefix##_opa, src_px_size, read_px, alpha_ofs, MIX_ALPHA_OPA)          \
+    IMAGE_KERNEL(prefix##_mask, src_px_size, read_px, alpha_ofs, MIX_ALPHA_MASK)        \
+    IMAGE_KERNEL(prefix##_mask_opa, src_px_size, read_px, alpha_ofs, MIX_ALPHA_MASK_OPA) \
+    IMAGE_MODE_KERNEL(prefix##_mode, src_px_size, read_px, alpha_ofs)
+
+/*A row of a kernel table in `blend_case_t` order*/
+#define KERNEL_ROW(prefix) {prefix##_cover, prefix##_opa, prefix##_mask, prefix##_mask_opa}
+
+/*The `image_kernel_set_t` of a source format*/
+#define KERNEL_SET(prefix) {KERNEL_ROW(prefix), prefix##_mode}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565a8(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                              lv_opa_t * dest_alpha, int32_t alpha_stride)
+{
+    run_color_kernel(dsc, dest_alpha, alpha_stride);
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb565a8(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              lv_opa_t * dest_alpha, int32_t alpha_stride)
+{
+    const image_kernel_set_t * kernels = get_image_kernels(dsc->src_color_format);
+    if(kernels == NULL) {
+        LV_LOG_WARN("Not supported source color format");
+        return;
+    }
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        kernels->normal[get_blend_case(dsc->mask_buf, dsc->opa)](dsc, dest_alpha, alpha_stride);
+    }
+    else if(dsc->blend_mode <= LV_BLEND_MODE_MULTIPLY) {
+        kernels->mode(dsc, dest_alpha, alpha_stride);
+    }
+    else {
+        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Simple fill: set the color and make the pixels fully opaque
+ */
+static void LV_ATTRIBUTE_FAST_MEM color_cover(lv_draw_sw_blend_fill_dsc_t * dsc, lv_opa_t * dest_alpha,
+                                              int32_t alpha_stride)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) dest_buf_u16[x] = color16;
+        lv_memset(dest_alpha, LV_OPA_COVER, w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        dest_alpha += alpha_stride;
+    }
+}
+
+COLOR_KERNEL(color_opa, MIX_OPA)
+COLOR_KERNEL(color_mask, MIX_MASK)
+COLOR_KERNEL(color_mask_opa, MIX_MASK_OPA)
+
+static const fill_kernel_t color_kernels[BLEND_CASE_NUM] = KERNEL_ROW(color);
+
+static void LV_ATTRIBUTE_FAST_MEM run_color_kernel(lv_draw_sw_blend_fill_dsc_t * dsc, lv_opa_t * dest_alpha,
+                                                   int32_t alpha_stride)
+{
+    color_kernels[get_blend_case(dsc->mask_buf, dsc->opa)](dsc, dest_alpha, alpha_stride);
+}
+
+/**
+ * Copy the rows of an RGB565 image and make the pixels fully opaque
+ */
+static void LV_ATTRIBUTE_FAST_MEM rgb565_cover(lv_draw_sw_blend_image_dsc_t * dsc, lv_opa_t * dest_alpha,
+                                               int32_t alpha_stride)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        lv_memcpy(dest_buf_u16, src_buf_u16, w * 2);
+        lv_memset(dest_alpha, LV_OPA_COVER, w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        dest_alpha += alpha_stride;
+    }
+}
+
+IMAGE_KERNELS_NO_ALPHA(rgb565, 2, READ_RGB565)
+
+#if LV_DRAW_SW_SUPPORT_RGB888
+    IMAGE_KERNEL(rgb888_cover, 3, READ_RGB888, 0, MIX_OPA)
+    IMAGE_KERNELS_NO_ALPHA(rgb888, 3, READ_RGB888)
+#endif
+
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+    IMAGE_KERNEL(xrgb8888_cover, 4, READ_RGB888, 0, MIX_OPA)
+    IMAGE_KERNELS_NO_ALPHA(xrgb8888, 4, READ_RGB888)
+#endif
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+    IMAGE_KERNELS_ALPHA(argb8888, 4, READ_RGB888, 3)
+#endif
+
+#if LV_DRAW_SW_SUPPORT_L8
+    IMAGE_KERNEL(l8_cover, 1, READ_L8, 0, MIX_OPA)
+    IMAGE_KERNELS_NO_ALPHA(l8, 1, READ_L8)
+#endif
+
+#if LV_DRAW_SW_SUPPORT_AL88
+    IMAGE_KERNELS_ALPHA(al88, 2, READ_L8, 1)
+#endif
+
+static const image_kernel_set_t rgb565_kernels = KERNEL_SET(rgb565);
+
+#if LV_DRAW_SW_SUPPORT_RGB888
+    static const image_kernel_set_t rgb888_kernels = KERNEL_SET(rgb888);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+    static const image_kernel_set_t xrgb8888_kernels = KERNEL_SET(xrgb8888);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+    static const image_kernel_set_t argb8888_kernels = KERNEL_SET(argb8888);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_L8
+    static const image_kernel_set_t l8_kernels = KERNEL_SET(l8);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_AL88
+    static const image_kernel_set_t al88_kernels = KERNEL_SET(al88);
+#endif
+
+/**
+ * Get the kernels of a source color format
+ * @param cf    the color format of the source image
+ * @return      the kernels or NULL if the color format is not supported
+ */
+static const image_kernel_set_t * get_image_kernels(lv_color_format_t cf)
+{
+    switch(cf) {
+        case LV_COLOR_FORMAT_RGB565:
+            return &rgb565_kernels;
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+            return &rgb888_kernels;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+            return &xrgb8888_kernels;
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888:
+            return &argb8888_kernels;
+#endif
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+            return &l8_kernels;
+#endif
+#if LV_DRAW_SW_SUPPORT_AL88
+        case LV_COLOR_FORMAT_AL88:
+            return &al88_kernels;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+static inline blend_case_t LV_ATTRIBUTE_FAST_MEM get_blend_case(const lv_opa_t * mask, lv_opa_t opa)
+{
+    if(mask == NULL) return opa >= LV_OPA_MAX ? BLEND_CASE_COVER : BLEND_CASE_OPA;
+    else return opa >= LV_OPA_MAX ? BLEND_CASE_MASK : BLEND_CASE_MASK_OPA;
+}
+
+/**
+ * Blend a color to a pixel the same way as it's done on ARGB8888 buffers
+ * @param dest          pointer to the RGB565 destination pixel
+ * @param dest_alpha    pointer to the alpha value of the destination pixel
+ * @param color         the color to blend
+ * @param opa           the opacity of `color`
+ * @param cache         the result of the last blending on a not fully opaque background
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM blend_px(uint16_t * dest, lv_opa_t * dest_alpha, uint16_t color,
+                                                  lv_opa_t opa, alpha_cache_t * cache)
+{
+    lv_opa_t bg_opa = *dest_alpha;
+
+    /*Opaque foreground or transparent background: just overwrite*/
+    if(opa >= LV_OPA_MAX || bg_opa <= LV_OPA_MIN) {
+        *dest = color;
+        *dest_alpha = opa;
+    }
+    else if(opa <= LV_OPA_MIN) {
+        return;
+    }
+    else if(bg_opa == LV_OPA_COVER) {
+        *dest = color_16_16_mix(color, *dest, opa);
+    }
+    else {
+        /*Both have alpha. The ratio and the result alpha depend only on the alpha values.
+         *https://en.wikipedia.org/wiki/Alpha_compositing#Analytical_derivation_of_the_over_operator*/
+        if(opa != cache->fg_opa || bg_opa != cache->bg_opa) {
+            cache->fg_opa = opa;
+            cache->bg_opa = bg_opa;
+            cache->res_opa = 255 - LV_OPA_MIX2(255 - opa, 255 - bg_opa);
+            cache->ratio = (uint32_t)((uint32_t)opa * 255) / cache->res_opa;
+        }
+
+        *dest = color_16_16_mix(color, *dest, cache->ratio);
+        *dest_alpha = cache->res_opa;
+    }
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM blend_mode_px(lv_blend_mode_t mode, uint16_t src, uint16_t dest)
+{
+    int32_t r = src >> 11;
+    int32_t g = (src >> 5) & 0x3F;
+    int32_t b = src & 0x1F;
+    int32_t dest_r = dest >> 11;
+    int32_t dest_g = (dest >> 5) & 0x3F;
+    int32_t dest_b = dest & 0x1F;
+
+    switch(mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+            r = LV_MIN(dest_r + r, 31);
+            g = LV_MIN(dest_g + g, 63);
+            b = LV_MIN(dest_b + b, 31);
+            break;
+        case LV_BLEND_MODE_SUBTRACTIVE:
+            r = LV_MAX(dest_r - r, 0);
+            g = LV_MAX(dest_g - g, 0);
+            b = LV_MAX(dest_b - b, 0);
+            break;
+        case LV_BLEND_MODE_MULTIPLY:
+            /*White doesn't change the destination*/
+            if(src == 0xffff) return dest;
+            r = (r * dest_r) >> 5;
+            g = (g * dest_g) >> 6;
+            b = (b * dest_b) >> 5;
+            break;
+        default:
+            return src;
+    }
+
+    return (uint16_t)((r << 11) + (g << 5) + b);
+}
+
+/**
+ * Same as `lv_color_16_16_mix` but without early returns so that it can be inlined in the kernels
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+    uint32_t mix32 = ((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix32) >> 5) + bg) & 0x7E0F81F;
+    return (uint16_t)((result >> 16) | result);
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_RGB565A8*/
+
+#endif /*LV_USE_DRAW_SW*/
@@ -0,0 +1,61 @@
+/**
+ * @file lv_draw_sw_blend_to_rgb565a8.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_TO_RGB565A8_H
+#define LV_DRAW_SW_BLEND_TO_RGB565A8_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_draw_sw.h"
+#if LV_USE_DRAW_SW
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Fill an area of an RGB565A8 buffer with a color.
+ * `dsc->dest_buf` points to the RGB565 pixels, the alpha values are stored in a separate plane.
+ * @param dsc           the fill descriptor
+ * @param dest_alpha    pointer to the alpha value of the first pixel of `dsc->dest_buf`
+ * @param alpha_stride  the stride of the alpha plane in bytes
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color_to_rgb565a8(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                                    lv_opa_t * dest_alpha, int32_t alpha_stride);
+
+/**
+ * Blend an image to an RGB565A8 buffer.
+ * `dsc->dest_buf` points to the RGB565 pixels, the alpha values are stored in a separate plane.
+ * @param dsc           the image blend descriptor
+ * @param dest_alpha    pointer to the alpha value of the first pixel of `dsc->dest_buf`
+ * @param alpha_stride  the stride of the alpha plane in bytes
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image_to_rgb565a8(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                    lv_opa_t * dest_alpha, int32_t alpha_stride);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_TO_RGB565A8_H*/
@@ -0,0 +1,1292 @@
+/**
+ * @file lv_blend_sse2.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_blend_sse2.h"
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2
+
+#if !defined(__SSE2__) && !defined(_M_X64) && !(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #error "LV_DRAW_SW_ASM_SSE2 requires a compiler targeting SSE2"
+#endif
+
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+
+#include <emmintrin.h>
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static inline void fill_u16(uint16_t * dest, uint16_t color, int32_t w);
+static inline void fill_u32(uint32_t * dest, uint32_t color, int32_t w);
+static inline void copy_bytes(void * dest, const void * src, int32_t len);
+
+static inline __m128i load_mask8(const lv_opa_t * mask);
+static inline __m128i load_mask4(const lv_opa_t * mask);
+static inline __m128i opa_mix2(__m128i a, __m128i b);
+static inline __m128i opa_mix3(__m128i a, __m128i b, __m128i c);
+static inline __m128i select_si128(__m128i cond, __m128i a, __m128i b);
+
+static inline __m128i mix_16_16_x4(__m128i fg, __m128i bg, __m128i mix);
+static inline __m128i mix_16_16_x8(__m128i fg, __m128i bg, __m128i mix);
+static inline __m128i mix_24_16_x8(__m128i r, __m128i g, __m128i b, __m128i bg, __m128i mix);
+static inline __m128i rgb_to_rgb565_x8(__m128i r, __m128i g, __m128i b);
+
+static inline __m128i load_px4(const uint8_t * src, uint32_t px_size);
+static inline void load_rgb_x8(const uint8_t * src, uint32_t px_size, __m128i * r, __m128i * g, __m128i * b,
+                               __m128i * a);
+static inline __m128i rgb565_to_argb8888_x4(const uint16_t * src, __m128i alpha);
+
+static inline void blend_argb8888_x4(uint32_t * dest, __m128i fg);
+static inline __m128i mix32_x4(__m128i fg, __m128i bg);
+
+static inline lv_opa_t get_mix(const lv_opa_t * mask, int32_t x, lv_opa_t opa);
+static inline uint16_t color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix);
+static inline lv_color32_t color_32_32_mix(lv_color32_t fg, lv_color32_t bg);
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+static void color_blend_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc);
+static void rgb565_blend_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc);
+static void rgb888_blend_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+static void argb8888_blend_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc);
+static void color_blend_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc);
+static void rgb565_blend_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc);
+static void rgb888_blend_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+static void argb8888_blend_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static void rotate_x8_u8(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                         int32_t dst_stride, bool ccw);
+static void rotate_x8_u16(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                          int32_t dst_stride, bool ccw);
+static void rotate_x4_u32(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                          int32_t dst_stride, bool ccw);
+static void rotate_edges(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                         int32_t dst_stride, uint32_t px_size, bool ccw, int32_t x_start, int32_t y_start);
+static inline void transpose_u8_8x8(__m128i r[8]);
+static inline void transpose_u16_8x8(__m128i r[8]);
+static inline void transpose_u32_4x4(__m128i r[4]);
+static inline __m128i reverse_u16_x8(__m128i v);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_color_blend_to_rgb565_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        fill_u16(dest_buf_u16, color16, dsc->dest_w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_with_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_with_mask_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        copy_bytes(dest_buf_u16, src_buf_u16, dsc->dest_w * 2);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x + 8 <= w; x += 8) {
+            __m128i r, g, b;
+            load_rgb_x8(&src_buf_u8[x * src_px_size], src_px_size, &r, &g, &b, NULL);
+            _mm_storeu_si128((__m128i *)&dest_buf_u16[x], rgb_to_rgb565_x8(r, g, b));
+        }
+        for(; x < w; x++) {
+            const uint8_t * px = &src_buf_u8[x * src_px_size];
+            dest_buf_u16[x] = ((px[2] & 0xF8) << 8) + ((px[1] & 0xFC) << 3) + ((px[0] & 0xF8) >> 3);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    rgb888_blend_to_rgb565(dsc, src_px_size);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    rgb888_blend_to_rgb565(dsc, src_px_size);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                               uint32_t src_px_size)
+{
+    rgb888_blend_to_rgb565(dsc, src_px_size);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_rgb565(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        fill_u32(dest_buf_u32, color32, dsc->dest_w);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_with_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_with_mask_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    int32_t y;
+
+    /*XRGB8888 is copied as it is, the X byte included*/
+    if(src_px_size == 4) {
+        for(y = 0; y < dsc->dest_h; y++) {
+            copy_bytes(dest_buf_u32, src_buf_u8, w * 4);
+            dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+            src_buf_u8 += dsc->src_stride;
+        }
+        return LV_RESULT_OK;
+    }
+
+    const __m128i alpha = _mm_set1_epi32((int32_t)0xFF000000);
+    int32_t x;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i px = _mm_or_si128(load_px4(&src_buf_u8[x * 3], 3), alpha);
+            _mm_storeu_si128((__m128i *)&dest_buf_u32[x], px);
+        }
+        for(; x < w; x++) {
+            const uint8_t * px = &src_buf_u8[x * 3];
+            dest_buf_u32[x] = 0xFF000000 | ((uint32_t)px[2] << 16) | ((uint32_t)px[1] << 8) | px[0];
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    rgb888_blend_to_argb8888(dsc, src_px_size);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t src_px_size)
+{
+    rgb888_blend_to_argb8888(dsc, src_px_size);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                 uint32_t src_px_size)
+{
+    rgb888_blend_to_argb8888(dsc, src_px_size);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_blend_to_argb8888(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate90_argb8888_sse2(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
+                                      int32_t src_stride, int32_t dst_stride)
+{
+    rotate_x4_u32((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride, false);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate180_argb8888_sse2(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
+                                       int32_t src_stride, int32_t dst_stride)
+{
+    int32_t y;
+    for(y = 0; y < src_height; y++) {
+        const uint32_t * s = (const uint32_t *)((const uint8_t *)src + y * src_stride);
+        uint32_t * d = (uint32_t *)((uint8_t *)dst + (src_height - y - 1) * dst_stride) + src_width;
+        int32_t x = 0;
+        for(; x < src_width - 3; x += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(s + x));
+            _mm_storeu_si128((__m128i *)(d - x - 4), _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+        }
+        for(; x < src_width; x++) {
+            d[-x - 1] = s[x];
+        }
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate270_argb8888_sse2(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
+                                       int32_t src_stride, int32_t dst_stride)
+{
+    rotate_x4_u32((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride, true);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate90_rgb565_sse2(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
+                                    int32_t src_stride, int32_t dst_stride)
+{
+    rotate_x8_u16((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride, false);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate180_rgb565_sse2(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
+                                     int32_t src_stride, int32_t dst_stride)
+{
+    int32_t y;
+    for(y = 0; y < src_height; y++) {
+        const uint16_t * s = (const uint16_t *)((const uint8_t *)src + y * src_stride);
+        uint16_t * d = (uint16_t *)((uint8_t *)dst + (src_height - y - 1) * dst_stride) + src_width;
+        int32_t x = 0;
+        for(; x < src_width - 7; x += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(s + x));
+            _mm_storeu_si128((__m128i *)(d - x - 8), reverse_u16_x8(v));
+        }
+        for(; x < src_width; x++) {
+            d[-x - 1] = s[x];
+        }
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate270_rgb565_sse2(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
+                                     int32_t src_stride, int32_t dst_stride)
+{
+    rotate_x8_u16((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride, true);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate90_l8_sse2(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                int32_t src_stride, int32_t dst_stride)
+{
+    rotate_x8_u8(src, dst, src_width, src_height, src_stride, dst_stride, false);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate180_l8_sse2(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                 int32_t src_stride, int32_t dst_stride)
+{
+    int32_t y;
+    for(y = 0; y < src_height; y++) {
+        const uint8_t * s = src + y * src_stride;
+        uint8_t * d = dst + (src_height - y - 1) * dst_stride + src_width;
+        int32_t x = 0;
+        for(; x < src_width - 15; x += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(s + x));
+            /*Swap the bytes of the 16 bit words and reverse the words*/
+            v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+            _mm_storeu_si128((__m128i *)(d - x - 16), reverse_u16_x8(v));
+        }
+        for(; x < src_width; x++) {
+            d[-x - 1] = s[x];
+        }
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rotate270_l8_sse2(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                 int32_t src_stride, int32_t dst_stride)
+{
+    rotate_x8_u8(src, dst, src_width, src_height, src_stride, dst_stride, true);
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*
+ * The blending functions below handle the opacity, mask, and mask with opacity cases together.
+ * The mix ratio is computed the same way as in the C implementation:
+ * - no mask: `opa`
+ * - mask and `opa >= LV_OPA_MAX`: `mask[x]`
+ * - mask and `opa < LV_OPA_MAX`: `LV_OPA_MIX2(mask[x], opa)`
+ */
+
+static void color_blend_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi8((char)0xFF);
+    const __m128i color = _mm_set1_epi16((int16_t)color16);
+    const __m128i opa_v = _mm_set1_epi16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 8 <= w; x += 8) {
+            __m128i mix = opa_v;
+            if(mask) {
+                __m128i mask8 = _mm_loadl_epi64((const __m128i *)&mask[x]);
+                if((_mm_movemask_epi8(_mm_cmpeq_epi8(mask8, zero)) & 0xFF) == 0xFF) continue;
+                if(opa >= LV_OPA_MAX && (_mm_movemask_epi8(_mm_cmpeq_epi8(mask8, full)) & 0xFF) == 0xFF) {
+                    _mm_storeu_si128((__m128i *)&dest_buf_u16[x], color);
+                    continue;
+                }
+                mix = _mm_unpacklo_epi8(mask8, zero);
+                if(opa < LV_OPA_MAX) mix = opa_mix2(mix, opa_v);
+            }
+            __m128i dest = _mm_loadu_si128((const __m128i *)&dest_buf_u16[x]);
+            _mm_storeu_si128((__m128i *)&dest_buf_u16[x], mix_16_16_x8(color, dest, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], get_mix(mask, x, opa));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void rgb565_blend_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+
+    const __m128i opa_v = _mm_set1_epi16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 8 <= w; x += 8) {
+            __m128i mix = opa_v;
+            if(mask) {
+                mix = load_mask8(&mask[x]);
+                if(opa < LV_OPA_MAX) mix = opa_mix2(mix, opa_v);
+            }
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u16[x]);
+            __m128i dest = _mm_loadu_si128((const __m128i *)&dest_buf_u16[x]);
+            _mm_storeu_si128((__m128i *)&dest_buf_u16[x], mix_16_16_x8(src, dest, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], get_mix(mask, x, opa));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void rgb888_blend_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+
+    const __m128i opa_v = _mm_set1_epi16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 8 <= w; x += 8) {
+            __m128i mix = opa_v;
+            if(mask) {
+                mix = load_mask8(&mask[x]);
+                if(opa < LV_OPA_MAX) mix = opa_mix2(mix, opa_v);
+            }
+            __m128i r, g, b;
+            load_rgb_x8(&src_buf_u8[x * src_px_size], src_px_size, &r, &g, &b, NULL);
+            __m128i dest = _mm_loadu_si128((const __m128i *)&dest_buf_u16[x]);
+            _mm_storeu_si128((__m128i *)&dest_buf_u16[x], mix_24_16_x8(r, g, b, dest, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = color_24_16_mix(&src_buf_u8[x * src_px_size], dest_buf_u16[x], get_mix(mask, x, opa));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+/*
+ * The mix ratio is the source alpha mixed with the opacity and the mask:
+ * `LV_OPA_MIX2(a, opa)`, `LV_OPA_MIX2(a, mask[x])` or `LV_OPA_MIX3(a, mask[x], opa)`
+ */
+static void argb8888_blend_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opa_v = _mm_set1_epi16(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 8 <= w; x += 8) {
+            __m128i r, g, b, mix;
+            load_rgb_x8(&src_buf_u8[x * 4], 4, &r, &g, &b, &mix);
+            if(mask) {
+                if(opa < LV_OPA_MAX) mix = opa_mix3(mix, load_mask8(&mask[x]), opa_v);
+                else mix = opa_mix2(mix, load_mask8(&mask[x]));
+            }
+            else if(opa < LV_OPA_MAX) {
+                mix = opa_mix2(mix, opa_v);
+            }
+
+            /*Skip the fully transparent parts quickly*/
+            if(_mm_movemask_epi8(_mm_cmpeq_epi16(mix, zero)) == 0xFFFF) continue;
+
+            __m128i dest = _mm_loadu_si128((const __m128i *)&dest_buf_u16[x]);
+            _mm_storeu_si128((__m128i *)&dest_buf_u16[x], mix_24_16_x8(r, g, b, dest, mix));
+        }
+        for(; x < w; x++) {
+            const uint8_t * px = &src_buf_u8[x * 4];
+            lv_opa_t mix;
+            if(mask == NULL) mix = opa >= LV_OPA_MAX ? px[3] : LV_OPA_MIX2(px[3], opa);
+            else if(opa >= LV_OPA_MAX) mix = LV_OPA_MIX2(px[3], mask[x]);
+            else mix = LV_OPA_MIX3(px[3], mask[x], opa);
+            dest_buf_u16[x] = color_24_16_mix(px, dest_buf_u16[x], mix);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void color_blend_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    uint32_t color_rgb = lv_color_to_u32(dsc->color) & 0x00FFFFFF;
+
+    const __m128i color = _mm_set1_epi32((int32_t)color_rgb);
+    const __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i alpha = opa_v;
+            if(mask) {
+                alpha = load_mask4(&mask[x]);
+                if(opa < LV_OPA_MAX) alpha = opa_mix2(alpha, opa_v);
+            }
+            blend_argb8888_x4(&dest_buf_u32[x], _mm_or_si128(color, _mm_slli_epi32(alpha, 24)));
+        }
+        for(; x < w; x++) {
+            lv_color32_t * dest = (lv_color32_t *)&dest_buf_u32[x];
+            lv_color32_t fg = lv_color_to_32(dsc->color, get_mix(mask, x, opa));
+            *dest = color_32_32_mix(fg, *dest);
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void rgb565_blend_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+
+    const __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i alpha = opa_v;
+            if(mask) {
+                alpha = load_mask4(&mask[x]);
+                if(opa < LV_OPA_MAX) alpha = opa_mix2(alpha, opa_v);
+            }
+            blend_argb8888_x4(&dest_buf_u32[x], rgb565_to_argb8888_x4(&src_buf_u16[x], alpha));
+        }
+        for(; x < w; x++) {
+            lv_color32_t * dest = (lv_color32_t *)&dest_buf_u32[x];
+            const lv_color16_t * src = (const lv_color16_t *)&src_buf_u16[x];
+            lv_color32_t fg;
+            fg.red = (src->red * 2106) >> 8;
+            fg.green = (src->green * 1037) >> 8;
+            fg.blue = (src->blue * 2106) >> 8;
+            fg.alpha = get_mix(mask, x, opa);
+            *dest = color_32_32_mix(fg, *dest);
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void rgb888_blend_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i alpha = opa_v;
+            if(mask) {
+                alpha = load_mask4(&mask[x]);
+                if(opa < LV_OPA_MAX) alpha = opa_mix2(alpha, opa_v);
+            }
+            __m128i fg = _mm_and_si128(load_px4(&src_buf_u8[x * src_px_size], src_px_size), rgb_mask);
+            blend_argb8888_x4(&dest_buf_u32[x], _mm_or_si128(fg, _mm_slli_epi32(alpha, 24)));
+        }
+        for(; x < w; x++) {
+            lv_color32_t * dest = (lv_color32_t *)&dest_buf_u32[x];
+            const uint8_t * src = &src_buf_u8[x * src_px_size];
+            lv_color32_t fg;
+            fg.red = src[2];
+            fg.green = src[1];
+            fg.blue = src[0];
+            fg.alpha = get_mix(mask, x, opa);
+            *dest = color_32_32_mix(fg, *dest);
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void argb8888_blend_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u32[x]);
+            if(mask || opa < LV_OPA_MAX) {
+                __m128i alpha = _mm_srli_epi32(src, 24);
+                if(mask == NULL) alpha = opa_mix2(alpha, opa_v);
+                else if(opa >= LV_OPA_MAX) alpha = opa_mix2(alpha, load_mask4(&mask[x]));
+                else alpha = opa_mix3(alpha, load_mask4(&mask[x]), opa_v);
+                src = _mm_or_si128(_mm_and_si128(src, rgb_mask), _mm_slli_epi32(alpha, 24));
+            }
+            blend_argb8888_x4(&dest_buf_u32[x], src);
+        }
+        for(; x < w; x++) {
+            lv_color32_t * dest = (lv_color32_t *)&dest_buf_u32[x];
+            lv_color32_t fg = ((const lv_color32_t *)src_buf_u32)[x];
+            if(mask == NULL) {
+                if(opa < LV_OPA_MAX) fg.alpha = LV_OPA_MIX2(fg.alpha, opa);
+            }
+            else if(opa >= LV_OPA_MAX) fg.alpha = LV_OPA_MIX2(fg.alpha, mask[x]);
+            else fg.alpha = LV_OPA_MIX3(fg.alpha, opa, mask[x]);
+            *dest = color_32_32_mix(fg, *dest);
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static inline void fill_u16(uint16_t * dest, uint16_t color, int32_t w)
+{
+    int32_t x = 0;
+#if defined(__AVX2__)
+    const __m256i color256 = _mm256_set1_epi16((int16_t)color);
+    for(; x + 16 <= w; x += 16) {
+        _mm256_storeu_si256((__m256i *)&dest[x], color256);
+    }
+#endif
+    const __m128i color128 = _mm_set1_epi16((int16_t)color);
+    for(; x + 8 <= w; x += 8) {
+        _mm_storeu_si128((__m128i *)&dest[x], color128);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+static inline void fill_u32(uint32_t * dest, uint32_t color, int32_t w)
+{
+    int32_t x = 0;
+#if defined(__AVX2__)
+    const __m256i color256 = _mm256_set1_epi32((int32_t)color);
+    for(; x + 8 <= w; x += 8) {
+        _mm256_storeu_si256((__m256i *)&dest[x], color256);
+    }
+#endif
+    const __m128i color128 = _mm_set1_epi32((int32_t)color);
+    for(; x + 4 <= w; x += 4) {
+        _mm_storeu_si128((__m128i *)&dest[x], color128);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+static inline void copy_bytes(void * dest, const void * src, int32_t len)
+{
+    uint8_t * d = dest;
+    const uint8_t * s = src;
+    int32_t i = 0;
+#if defined(__AVX2__)
+    for(; i + 32 <= len; i += 32) {
+        _mm256_storeu_si256((__m256i *)&d[i], _mm256_loadu_si256((const __m256i *)&s[i]));
+    }
+#endif
+    for(; i + 16 <= len; i += 16) {
+        _mm_storeu_si128((__m128i *)&d[i], _mm_loadu_si128((const __m128i *)&s[i]));
+    }
+    for(; i < len; i++) {
+        d[i] = s[i];
+    }
+}
+
+/**
+ * Load 8 mask values into 16 bit lanes
+ */
+static inline __m128i load_mask8(const lv_opa_t * mask)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)mask), _mm_setzero_si128());
+}
+
+/**
+ * Load 4 mask values into 32 bit lanes. Reads exactly 4 bytes as the mask rows are not padded.
+ */
+static inline __m128i load_mask4(const lv_opa_t * mask)
+{
+    uint32_t m = mask[0] | ((uint32_t)mask[1] << 8) | ((uint32_t)mask[2] << 16) | ((uint32_t)mask[3] << 24);
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int32_t)m), zero), zero);
+}
+
+/**
+ * `LV_OPA_MIX2` on 16 bit lanes (or 32 bit lanes with zero upper halves)
+ */
+static inline __m128i opa_mix2(__m128i a, __m128i b)
+{
+    return _mm_srli_epi16(_mm_mullo_epi16(a, b), 8);
+}
+
+/**
+ * `LV_OPA_MIX3` on 16 bit lanes (or 32 bit lanes with zero upper halves).
+ * `a * b` fits into 16 bit and the high half of `a * b * c` is just `(a * b * c) >> 16`
+ */
+static inline __m128i opa_mix3(__m128i a, __m128i b, __m128i c)
+{
+    return _mm_mulhi_epu16(_mm_mullo_epi16(a, b), c);
+}
+
+static inline __m128i select_si128(__m128i cond, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(cond, a), _mm_andnot_si128(cond, b));
+}
+
+/**
+ * The same as `lv_color_16_16_mix` on 4 colors stored in 32 bit lanes.
+ * The packed 32 bit arithmetic is emulated exactly, the result is in the lower 16 bits of the lanes.
+ */
+static inline __m128i mix_16_16_x4(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i rb_g_mask = _mm_set1_epi32(0x7E0F81F);
+    __m128i m = _mm_srli_epi32(_mm_add_epi32(mix, _mm_set1_epi32(4)), 3);
+    m = _mm_or_si128(m, _mm_slli_epi32(m, 16));
+    fg = _mm_and_si128(_mm_or_si128(fg, _mm_slli_epi32(fg, 16)), rb_g_mask);
+    bg = _mm_and_si128(_mm_or_si128(bg, _mm_slli_epi32(bg, 16)), rb_g_mask);
+
+    /*SSE2 has no 32 bit multiplication, but `m` is only 6 bit so the lower 32 bits of `diff * m`
+     *can be assembled from 16 bit multiplications*/
+    __m128i diff = _mm_sub_epi32(fg, bg);
+    __m128i prod = _mm_add_epi32(_mm_mullo_epi16(diff, m), _mm_slli_epi32(_mm_mulhi_epu16(diff, m), 16));
+
+    __m128i res = _mm_and_si128(_mm_add_epi32(_mm_srli_epi32(prod, 5), bg), rb_g_mask);
+    return _mm_or_si128(res, _mm_srli_epi32(res, 16));
+}
+
+/**
+ * The same as `lv_color_16_16_mix` on 8 colors and mix ratios stored in 16 bit lanes
+ */
+static inline __m128i mix_16_16_x8(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = mix_16_16_x4(_mm_unpacklo_epi16(fg, zero), _mm_unpacklo_epi16(bg, zero),
+                              _mm_unpacklo_epi16(mix, zero));
+    __m128i hi = mix_16_16_x4(_mm_unpackhi_epi16(fg, zero), _mm_unpackhi_epi16(bg, zero),
+                              _mm_unpackhi_epi16(mix, zero));
+
+    /*Sign extend the lower 16 bits so that the saturating pack keeps them as they are*/
+    lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+    hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+    return _mm_packs_epi32(lo, hi);
+}
+
+/**
+ * The same as `lv_color_24_16_mix` on 8 pixels stored in 16 bit lanes
+ */
+static inline __m128i mix_24_16_x8(__m128i r, __m128i g, __m128i b, __m128i bg, __m128i mix)
+{
+    const __m128i mix_inv = _mm_sub_epi16(_mm_set1_epi16(255), mix);
+    __m128i bg_r = _mm_srli_epi16(bg, 11);
+    __m128i bg_g = _mm_and_si128(_mm_srli_epi16(bg, 5), _mm_set1_epi16(0x3F));
+    __m128i bg_b = _mm_and_si128(bg, _mm_set1_epi16(0x1F));
+
+    /*The largest sum is 63 * 255 so everything fits into 16 bit*/
+    __m128i res_r = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(r, 3), mix), _mm_mullo_epi16(bg_r, mix_inv));
+    __m128i res_g = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(g, 2), mix), _mm_mullo_epi16(bg_g, mix_inv));
+    __m128i res_b = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(b, 3), mix), _mm_mullo_epi16(bg_b, mix_inv));
+
+    __m128i res = _mm_and_si128(_mm_slli_epi16(res_r, 3), _mm_set1_epi16((int16_t)0xF800));
+    res = _mm_or_si128(res, _mm_and_si128(_mm_srli_epi16(res_g, 3), _mm_set1_epi16(0x07E0)));
+    res = _mm_or_si128(res, _mm_srli_epi16(res_b, 8));
+
+    /*Fully covering and fully transparent pixels are not mixed*/
+    res = select_si128(_mm_cmpeq_epi16(mix, _mm_set1_epi16(255)), rgb_to_rgb565_x8(r, g, b), res);
+    return select_si128(_mm_cmpeq_epi16(mix, _mm_setzero_si128()), bg, res);
+}
+
+static inline __m128i rgb_to_rgb565_x8(__m128i r, __m128i g, __m128i b)
+{
+    __m128i res = _mm_slli_epi16(_mm_and_si128(r, _mm_set1_epi16(0xF8)), 8);
+    res = _mm_or_si128(res, _mm_slli_epi16(_mm_and_si128(g, _mm_set1_epi16(0xFC)), 3));
+    return _mm_or_si128(res, _mm_srli_epi16(b, 3));
+}
+
+/**
+ * Load 4 RGB888 or XRGB8888 pixels as XRGB8888 into 32 bit lanes.
+ * The X byte is undefined for RGB888.
+ */
+static inline __m128i load_px4(const uint8_t * src, uint32_t px_size)
+{
+    if(px_size == 4) return _mm_loadu_si128((const __m128i *)src);
+
+    /*Read byte by byte to not read after the end of the line*/
+    return _mm_set_epi32(src[9] | (src[10] << 8) | (src[11] << 16),
+                         src[6] | (src[7] << 8) | (src[8] << 16),
+                         src[3] | (src[4] << 8) | (src[5] << 16),
+                         src[0] | (src[1] << 8) | (src[2] << 16));
+}
+
+/**
+ * Load 8 RGB888, XRGB8888 or ARGB8888 pixels and split them into 16 bit lanes per channel
+ */
+static inline void load_rgb_x8(const uint8_t * src, uint32_t px_size, __m128i * r, __m128i * g, __m128i * b,
+                               __m128i * a)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    __m128i lo = load_px4(src, px_size);
+    __m128i hi = load_px4(src + 4 * px_size, px_size);
+
+    *b = _mm_packs_epi32(_mm_and_si128(lo, byte_mask), _mm_and_si128(hi, byte_mask));
+    *g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 8), byte_mask), _mm_and_si128(_mm_srli_epi32(hi, 8), byte_mask));
+    *r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 16), byte_mask),
+                         _mm_and_si128(_mm_srli_epi32(hi, 16), byte_mask));
+    if(a) *a = _mm_packs_epi32(_mm_srli_epi32(lo, 24), _mm_srli_epi32(hi, 24));
+}
+
+/**
+ * Convert 4 RGB565 pixels to ARGB8888 the same way as the C implementation does
+ * @param src       pointer to 4 RGB565 pixels
+ * @param alpha     alpha values in 32 bit lanes
+ */
+static inline __m128i rgb565_to_argb8888_x4(const uint16_t * src, __m128i alpha)
+{
+    __m128i px = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)src), _mm_setzero_si128());
+    __m128i r = _mm_srli_epi32(px, 11);
+    __m128i g = _mm_and_si128(_mm_srli_epi32(px, 5), _mm_set1_epi32(0x3F));
+    __m128i b = _mm_and_si128(px, _mm_set1_epi32(0x1F));
+
+    /*The products fit into 16 bit*/
+    r = _mm_srli_epi16(_mm_mullo_epi16(r, _mm_set1_epi32(2106)), 8);
+    g = _mm_srli_epi16(_mm_mullo_epi16(g, _mm_set1_epi32(1037)), 8);
+    b = _mm_srli_epi16(_mm_mullo_epi16(b, _mm_set1_epi32(2106)), 8);
+
+    px = _mm_or_si128(b, _mm_slli_epi32(g, 8));
+    px = _mm_or_si128(px, _mm_slli_epi32(r, 16));
+    return _mm_or_si128(px, _mm_slli_epi32(alpha, 24));
+}
+
+/**
+ * Blend 4 ARGB8888 pixels onto ARGB8888 `dest` the same way as `lv_color_32_32_mix` does.
+ * The common cases (opaque or transparent foreground, transparent or opaque background)
+ * are vectorized, if both colors are semi-transparent the pixels are mixed one by one.
+ */
+static inline void blend_argb8888_x4(uint32_t * dest, __m128i fg)
+{
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+    __m128i fg_a = _mm_srli_epi32(fg, 24);
+    __m128i bg_a = _mm_srli_epi32(bg, 24);
+
+    __m128i take_fg = _mm_or_si128(_mm_cmpgt_epi32(fg_a, _mm_set1_epi32(LV_OPA_MAX - 1)),
+                                   _mm_cmplt_epi32(bg_a, _mm_set1_epi32(LV_OPA_MIN + 1)));
+    int take_fg_bits = _mm_movemask_epi8(take_fg);
+    if(take_fg_bits == 0xFFFF) {
+        _mm_storeu_si128((__m128i *)dest, fg);
+        return;
+    }
+
+    __m128i take_bg = _mm_andnot_si128(take_fg, _mm_cmplt_epi32(fg_a, _mm_set1_epi32(LV_OPA_MIN + 1)));
+    int take_bg_bits = _mm_movemask_epi8(take_bg);
+    if(take_bg_bits == 0xFFFF) return;
+
+    __m128i bg_opaque = _mm_cmpeq_epi32(bg_a, _mm_set1_epi32(0xFF));
+    if((take_fg_bits | take_bg_bits | _mm_movemask_epi8(bg_opaque)) != 0xFFFF) {
+        lv_color32_t fg_c32[4];
+        lv_color32_t * dest_c32 = (lv_color32_t *)dest;
+        _mm_storeu_si128((__m128i *)fg_c32, fg);
+        dest_c32[0] = color_32_32_mix(fg_c32[0], dest_c32[0]);
+        dest_c32[1] = color_32_32_mix(fg_c32[1], dest_c32[1]);
+        dest_c32[2] = color_32_32_mix(fg_c32[2], dest_c32[2]);
+        dest_c32[3] = color_32_32_mix(fg_c32[3], dest_c32[3]);
+        return;
+    }
+
+    __m128i res = mix32_x4(fg, bg);
+    res = select_si128(take_bg, bg, res);
+    res = select_si128(take_fg, fg, res);
+    _mm_storeu_si128((__m128i *)dest, res);
+}
+
+/**
+ * The same as `lv_color_mix32` with opaque background on 4 pixels
+ */
+static inline __m128i mix32_x4(__m128i fg, __m128i bg)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi16(255);
+
+    __m128i fg_lo = _mm_unpacklo_epi8(fg, zero);
+    __m128i bg_lo = _mm_unpacklo_epi8(bg, zero);
+    __m128i a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(fg_lo, 0xFF), 0xFF);
+    __m128i res_lo = _mm_add_epi16(_mm_mullo_epi16(fg_lo, a_lo), _mm_mullo_epi16(bg_lo, _mm_sub_epi16(c255, a_lo)));
+
+    __m128i fg_hi = _mm_unpackhi_epi8(fg, zero);
+    __m128i bg_hi = _mm_unpackhi_epi8(bg, zero);
+    __m128i a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(fg_hi, 0xFF), 0xFF);
+    __m128i res_hi = _mm_add_epi16(_mm_mullo_epi16(fg_hi, a_hi), _mm_mullo_epi16(bg_hi, _mm_sub_epi16(c255, a_hi)));
+
+    __m128i res = _mm_packus_epi16(_mm_srli_epi16(res_lo, 8), _mm_srli_epi16(res_hi, 8));
+    return _mm_or_si128(res, _mm_set1_epi32((int32_t)0xFF000000));
+}
+
+static inline lv_opa_t get_mix(const lv_opa_t * mask, int32_t x, lv_opa_t opa)
+{
+    if(mask == NULL) return opa;
+    if(opa >= LV_OPA_MAX) return mask[x];
+    return LV_OPA_MIX2(mask[x], opa);
+}
+
+static inline uint16_t color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 0) {
+        return c2;
+    }
+    else if(mix == 255) {
+        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+/**
+ * `lv_color_32_32_mix` of the C implementation without the result cache
+ */
+static inline lv_color32_t color_32_32_mix(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+/*
+ * The 90° and 270° rotations load a block of rows, transpose it in registers and
+ * store the columns as rows of the destination:
+ * - 90°: the column `x` goes to the row `w - 1 - x` from top to bottom
+ * - 270°: the column `x` goes to the row `x` from bottom to top,
+ *   so the rows are loaded in reverse order before the transpose
+ */
+
+static void rotate_x8_u8(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                         int32_t dst_stride, bool ccw)
+{
+    int32_t w8 = w & ~7;
+    int32_t h8 = h & ~7;
+    int32_t x, y, i;
+    __m128i r[8];
+    for(y = 0; y < h8; y += 8) {
+        for(x = 0; x < w8; x += 8) {
+            for(i = 0; i < 8; i++) {
+                int32_t sy = ccw ? y + 7 - i : y + i;
+                r[i] = _mm_loadl_epi64((const __m128i *)(src + sy * src_stride + x));
+            }
+            transpose_u8_8x8(r);
+            for(i = 0; i < 8; i++) {
+                uint8_t * d = ccw ? dst + (x + i) * dst_stride + (h - y - 8) : dst + (w - x - i - 1) * dst_stride + y;
+                _mm_storel_epi64((__m128i *)d, r[i]);
+            }
+        }
+    }
+
+    rotate_edges(src, dst, w, h, src_stride, dst_stride, 1, ccw, w8, h8);
+}
+
+static void rotate_x8_u16(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                          int32_t dst_stride, bool ccw)
+{
+    int32_t w8 = w & ~7;
+    int32_t h8 = h & ~7;
+    int32_t x, y, i;
+    __m128i r[8];
+    for(y = 0; y < h8; y += 8) {
+        for(x = 0; x < w8; x += 8) {
+            for(i = 0; i < 8; i++) {
+                int32_t sy = ccw ? y + 7 - i : y + i;
+                r[i] = _mm_loadu_si128((const __m128i *)(src + sy * src_stride + x * 2));
+            }
+            transpose_u16_8x8(r);
+            for(i = 0; i < 8; i++) {
+                uint8_t * d = ccw ? dst + (x + i) * dst_stride + (h - y - 8) * 2
+                              : dst + (w - x - i - 1) * dst_stride + y * 2;
+                _mm_storeu_si128((__m128i *)d, r[i]);
+            }
+        }
+    }
+
+    rotate_edges(src, dst, w, h, src_stride, dst_stride, 2, ccw, w8, h8);
+}
+
+static void rotate_x4_u32(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                          int32_t dst_stride, bool ccw)
+{
+    int32_t w4 = w & ~3;
+    int32_t h4 = h & ~3;
+    int32_t x, y, i;
+    __m128i r[4];
+    for(y = 0; y < h4; y += 4) {
+        for(x = 0; x < w4; x += 4) {
+            for(i = 0; i < 4; i++) {
+                int32_t sy = ccw ? y + 3 - i : y + i;
+                r[i] = _mm_loadu_si128((const __m128i *)(src + sy * src_stride + x * 4));
+            }
+            transpose_u32_4x4(r);
+            for(i = 0; i < 4; i++) {
+                uint8_t * d = ccw ? dst + (x + i) * dst_stride + (h - y - 4) * 4
+                              : dst + (w - x - i - 1) * dst_stride + y * 4;
+                _mm_storeu_si128((__m128i *)d, r[i]);
+            }
+        }
+    }
+
+    rotate_edges(src, dst, w, h, src_stride, dst_stride, 4, ccw, w4, h4);
+}
+
+/**
+ * Rotate the pixels right of `x_start` and below `y_start` one by one
+ */
+static void rotate_edges(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                         int32_t dst_stride, uint32_t px_size, bool ccw, int32_t x_start, int32_t y_start)
+{
+    int32_t x, y;
+    for(y = 0; y < h; y++) {
+        for(x = y < y_start ? x_start : 0; x < w; x++) {
+            const uint8_t * s = src + y * src_stride + x * px_size;
+            uint8_t * d = ccw ? dst + x * dst_stride + (h - y - 1) * px_size
+                          : dst + (w - x - 1) * dst_stride + y * px_size;
+            if(px_size == 1) *d = *s;
+            else if(px_size == 2) *(uint16_t *)d = *(const uint16_t *)s;
+            else *(uint32_t *)d = *(const uint32_t *)s;
+        }
+    }
+}
+
+static inline void transpose_u8_8x8(__m128i r[8])
+{
+    __m128i a0 = _mm_unpacklo_epi8(r[0], r[1]);
+    __m128i a1 = _mm_unpacklo_epi8(r[2], r[3]);
+    __m128i a2 = _mm_unpacklo_epi8(r[4], r[5]);
+    __m128i a3 = _mm_unpacklo_epi8(r[6], r[7]);
+
+    __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+
+    /*Each register holds 2 columns*/
+    __m128i c0 = _mm_unpacklo_epi32(b0, b2);
+    __m128i c1 = _mm_unpackhi_epi32(b0, b2);
+    __m128i c2 = _mm_unpacklo_epi32(b1, b3);
+    __m128i c3 = _mm_unpackhi_epi32(b1, b3);
+
+    r[0] = c0;
+    r[1] = _mm_unpackhi_epi64(c0, c0);
+    r[2] = c1;
+    r[3] = _mm_unpackhi_epi64(c1, c1);
+    r[4] = c2;
+    r[5] = _mm_unpackhi_epi64(c2, c2);
+    r[6] = c3;
+    r[7] = _mm_unpackhi_epi64(c3, c3);
+}
+
+static inline void transpose_u16_8x8(__m128i r[8])
+{
+    __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+    __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+    __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+    __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+    __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+    __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+    __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+    __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+    __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+    __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+    __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+    __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+    __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+    __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+    __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+    __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+    r[0] = _mm_unpacklo_epi64(b0, b4);
+    r[1] = _mm_unpackhi_epi64(b0, b4);
+    r[2] = _mm_unpacklo_epi64(b1, b5);
+    r[3] = _mm_unpackhi_epi64(b1, b5);
+    r[4] = _mm_unpacklo_epi64(b2, b6);
+    r[5] = _mm_unpackhi_epi64(b2, b6);
+    r[6] = _mm_unpacklo_epi64(b3, b7);
+    r[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+static inline void transpose_u32_4x4(__m128i r[4])
+{
+    __m128i a0 = _mm_unpacklo_epi32(r[0], r[1]);
+    __m128i a1 = _mm_unpackhi_epi32(r[0], r[1]);
+    __m128i a2 = _mm_unpacklo_epi32(r[2], r[3]);
+    __m128i a3 = _mm_unpackhi_epi32(r[2], r[3]);
+
+    r[0] = _mm_unpacklo_epi64(a0, a2);
+    r[1] = _mm_unpackhi_epi64(a0, a2);
+    r[2] = _mm_unpacklo_epi64(a1, a3);
+    r[3] = _mm_unpackhi_epi64(a1, a3);
+}
+
+static inline __m128i reverse_u16_x8(__m128i v)
+{
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2*/
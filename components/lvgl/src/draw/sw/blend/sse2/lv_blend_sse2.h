@@ -0,0 +1,355 @@
+/**
+ * @file lv_blend_sse2.h
+ *
+ */
+
+#ifndef LV_BLEND_SSE2_H
+#define LV_BLEND_SSE2_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#ifdef LV_DRAW_SW_SSE2_CUSTOM_INCLUDE
+#include LV_DRAW_SW_SSE2_CUSTOM_INCLUDE
+#endif
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2
+
+#include "../../../../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    lv_color_blend_to_rgb565_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    lv_color_blend_to_rgb565_with_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    lv_color_blend_to_rgb565_with_mask_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_rgb565_mix_mask_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_with_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_with_mask_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_with_opa_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_with_mask_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_mix_mask_opa_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_with_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_with_mask_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(dsc) \
+    lv_color_blend_to_argb8888_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(dsc) \
+    lv_color_blend_to_argb8888_with_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(dsc) \
+    lv_color_blend_to_argb8888_with_mask_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_argb8888_mix_mask_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_with_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_with_mask_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_mix_mask_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_with_opa_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_with_mask_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_mix_mask_opa_sse2(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_with_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_with_mask_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_sse2(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE90_ARGB8888
+#define LV_DRAW_SW_ROTATE90_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate90_argb8888_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE90_RGB565
+#define LV_DRAW_SW_ROTATE90_RGB565(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate90_rgb565_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE90_L8
+#define LV_DRAW_SW_ROTATE90_L8(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate90_l8_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE180_ARGB8888
+#define LV_DRAW_SW_ROTATE180_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate180_argb8888_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE180_RGB565
+#define LV_DRAW_SW_ROTATE180_RGB565(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate180_rgb565_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE180_L8
+#define LV_DRAW_SW_ROTATE180_L8(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate180_l8_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE270_ARGB8888
+#define LV_DRAW_SW_ROTATE270_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate270_argb8888_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE270_RGB565
+#define LV_DRAW_SW_ROTATE270_RGB565(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate270_rgb565_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+#ifndef LV_DRAW_SW_ROTATE270_L8
+#define LV_DRAW_SW_ROTATE270_L8(src, dst, src_width, src_height, src_stride, dst_stride)  \
+    lv_rotate270_l8_sse2(src, dst, src_width, src_height, src_stride, dst_stride)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/* All the functions below produce the exact same result as the C implementation
+ * in `lv_draw_sw_blend_to_rgb565.c` and `lv_draw_sw_blend_to_argb8888.c`.
+ * If compiled with AVX2 enabled the opaque fills and copies use 256 bit stores.*/
+
+lv_result_t lv_color_blend_to_rgb565_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_rgb565_with_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_rgb565_with_mask_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                               uint32_t src_px_size);
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_with_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_with_mask_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                 uint32_t src_px_size);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/* The rotations transpose 8x8 (L8, RGB565) or 4x4 (ARGB8888) pixel blocks in registers
+ * and copy the remaining edges pixel by pixel. The strides are in bytes.*/
+
+lv_result_t lv_rotate90_argb8888_sse2(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
+                                      int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate180_argb8888_sse2(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
+                                       int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate270_argb8888_sse2(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
+                                       int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate90_rgb565_sse2(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
+                                    int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate180_rgb565_sse2(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
+                                     int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate270_rgb565_sse2(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
+                                     int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate90_l8_sse2(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate180_l8_sse2(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                 int32_t src_stride, int32_t dst_stride);
+
+lv_result_t lv_rotate270_l8_sse2(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                 int32_t src_stride, int32_t dst_stride);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_SSE2_H*/
@@ -7,11 +7,13 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_sw_private.h"
+#include "lv_draw_sw_gradient_private.h"
 #include "../lv_draw_private.h"
 #if LV_USE_DRAW_SW
 
 #include "../../core/lv_refr.h"
 #include "../../display/lv_display_private.h"
+#include "../../misc/lv_area_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
 
@@ -25,6 +27,8 @@
 
 #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "arm2d/lv_draw_sw_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2
+    #include "blend/sse2/lv_blend_sse2.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -38,6 +42,13 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*Keep the scratch buffers aligned for any pixel format*/
+#define SCRATCH_ALIGN(x)    (((x) + 7) & ~7)
+
+/*The 90° and 270° rotations copy the image in square tiles so that the rows of
+ *the destination and the columns of the source stay in the cache*/
+#define ROTATE_TILE_SIZE    16
+
 #ifndef LV_DRAW_SW_RGB565_SWAP
     #define LV_DRAW_SW_RGB565_SWAP(...) LV_RESULT_INVALID
 #endif
@@ -102,6 +113,9 @@
 #endif
 
 static void execute_drawing(lv_draw_sw_unit_t * u);
+static void execute_drawing_unrotated(lv_draw_sw_unit_t * u, lv_draw_task_t * t);
+static void draw_unrotated_only(lv_draw_sw_unit_t * u, lv_draw_task_t * t);
+static void scratch_prepare(lv_draw_sw_unit_t * u);
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
@@ -123,7 +137,8 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
                             int32_t dst_stride);
 static void rotate180_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
                              int32_t dest_stride);
-static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                             int32_t src_stride,
                              int32_t dst_stride);
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB565
@@ -166,15 +181,18 @@ void lv_draw_sw_init(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+    lv_draw_sw_box_shadow_cache_init();
 #endif
 
+    lv_gradient_cache_init();
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
         draw_sw_unit->base_unit.dispatch_cb = dispatch;
         draw_sw_unit->base_unit.evaluate_cb = evaluate;
         draw_sw_unit->idx = i;
-        draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
+        draw_sw_unit->base_unit.delete_cb = lv_draw_sw_delete;
 
 #if LV_USE_OS
         lv_thread_init(&draw_sw_unit->thread, LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE, draw_sw_unit);
@@ -194,14 +212,18 @@ void lv_draw_sw_deinit(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
+    lv_draw_sw_box_shadow_cache_deinit();
 #endif
+
+    lv_gradient_cache_deinit();
 }
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
 {
-#if LV_USE_OS
     lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
+    int32_t res = 0;
 
+#if LV_USE_OS
     LV_LOG_INFO("cancel software rendering thread");
     draw_sw_unit->exit_status = true;
 
@@ -209,11 +231,97 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_sync_signal(&draw_sw_unit->sync);
     }
 
-    return lv_thread_delete(&draw_sw_unit->thread);
-#else
-    LV_UNUSED(draw_unit);
-    return 0;
+    res = lv_thread_delete(&draw_sw_unit->thread);
 #endif
+
+    lv_free(draw_sw_unit->scratch_buf);
+    draw_sw_unit->scratch_buf = NULL;
+    draw_sw_unit->scratch_size = 0;
+
+    return res;
+}
+
+void * lv_draw_sw_scratch_alloc(lv_draw_unit_t * draw_unit, uint32_t size)
+{
+    /*Other draw units can call the software renderer too*/
+    if(draw_unit == NULL || draw_unit->dispatch_cb != dispatch) return lv_malloc(size);
+
+    lv_draw_sw_unit_t * u = (lv_draw_sw_unit_t *) draw_unit;
+    uint32_t new_used = u->scratch_used + SCRATCH_ALIGN(size);
+    if(new_used > u->scratch_required) u->scratch_required = new_used;
+
+    if(new_used > u->scratch_size) {
+        /*It will be enlarged before the next task*/
+        return lv_malloc(size);
+    }
+
+    void * buf = u->scratch_buf + u->scratch_used;
+    u->scratch_used = new_used;
+    return buf;
+}
+
+void lv_draw_sw_scratch_free(lv_draw_unit_t * draw_unit, void * buf)
+{
+    if(buf == NULL) return;
+
+    if(draw_unit && draw_unit->dispatch_cb == dispatch) {
+        lv_draw_sw_unit_t * u = (lv_draw_sw_unit_t *) draw_unit;
+        uint8_t * buf8 = buf;
+        if(buf8 >= u->scratch_buf && buf8 < u->scratch_buf + u->scratch_size) {
+            /*Everything allocated after `buf` must be already released*/
+            LV_ASSERT((uint32_t)(buf8 - u->scratch_buf) < u->scratch_used);
+            u->scratch_used = buf8 - u->scratch_buf;
+            return;
+        }
+    }
+
+    lv_free(buf);
+}
+
+void lv_draw_sw_scratch_shrink(void)
+{
+    lv_draw_unit_t * draw_unit = _draw_info.unit_head;
+    while(draw_unit) {
+        if(draw_unit->dispatch_cb == dispatch) {
+            lv_draw_sw_unit_t * u = (lv_draw_sw_unit_t *) draw_unit;
+            LV_ASSERT(u->scratch_used == 0);
+            if(u->scratch_size > 0 && u->scratch_required > u->scratch_size / 2) {
+                /*Still needed*/
+                u->scratch_low_cnt = 0;
+                u->scratch_low_required = 0;
+            }
+            else {
+                u->scratch_low_required = LV_MAX(u->scratch_low_required, u->scratch_required);
+                u->scratch_low_cnt++;
+                if(u->scratch_low_cnt >= LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT) {
+                    if(u->scratch_low_required == 0) {
+                        lv_free(u->scratch_buf);
+                        u->scratch_buf = NULL;
+                        u->scratch_size = 0;
+                    }
+                    else if(u->scratch_low_required < u->scratch_size) {
+                        /*If it fails the larger buffer remains valid*/
+                        uint8_t * buf = lv_realloc(u->scratch_buf, u->scratch_low_required);
+                        if(buf) {
+                            u->scratch_buf = buf;
+                            u->scratch_size = u->scratch_low_required;
+                        }
+                    }
+                    u->scratch_low_cnt = 0;
+                    u->scratch_low_required = 0;
+                }
+            }
+            u->scratch_required = 0;
+        }
+        draw_unit = draw_unit->next;
+    }
+}
+
+lv_draw_sw_unit_t * lv_draw_sw_get_sw_unit(lv_draw_unit_t * draw_unit)
+{
+    if(draw_unit == NULL || draw_unit->dispatch_cb != dispatch) return NULL;
+
+    return (lv_draw_sw_unit_t *)draw_unit;
 }
 
 void lv_draw_sw_rgb565_swap(void * buf, uint32_t buf_size_px)
@@ -496,9 +604,25 @@ static void render_thread_cb(void * ptr)
 }
 #endif
 
+static void scratch_prepare(lv_draw_sw_unit_t * u)
+{
+    LV_ASSERT(u->scratch_used == 0);
+    u->scratch_used = 0;
+
+    /*A previous task needed more memory than the scratch buffer so it used the heap.
+     *Enlarge the scratch buffer to avoid it next time.*/
+    if(u->scratch_required <= u->scratch_size) return;
+
+    lv_free(u->scratch_buf);
+    u->scratch_buf = lv_malloc(u->scratch_required);
+    u->scratch_size = u->scratch_buf ? u->scratch_required : 0;
+}
+
 static void execute_drawing(lv_draw_sw_unit_t * u)
 {
     LV_PROFILER_BEGIN;
+    scratch_prepare(u);
+
     /*Render the draw task*/
     lv_draw_task_t * t = u->task_act;
     switch(t->type) {
@@ -523,6 +647,9 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
         case LV_DRAW_TASK_TYPE_LINE:
             lv_draw_sw_line((lv_draw_unit_t *)u, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            lv_draw_sw_polyline((lv_draw_unit_t *)u, t->draw_dsc);
+            break;
         case LV_DRAW_TASK_TYPE_TRIANGLE:
             lv_draw_sw_triangle((lv_draw_unit_t *)u, t->draw_dsc);
             break;
@@ -530,13 +657,12 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
             lv_draw_sw_layer((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
             break;
         case LV_DRAW_TASK_TYPE_MASK_RECTANGLE:
-            lv_draw_sw_mask_rect((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
-            break;
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
         case LV_DRAW_TASK_TYPE_VECTOR:
-            lv_draw_sw_vector((lv_draw_unit_t *)u, t->draw_dsc);
-            break;
 #endif
+            if(u->base_unit.target_layer->rotation == LV_DISPLAY_ROTATION_0) draw_unrotated_only(u, t);
+            else execute_drawing_unrotated(u, t);
+            break;
         default:
             break;
     }
@@ -587,25 +713,95 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
     LV_PROFILER_END;
 }
 
+/**
+ * Draw a task which can't write the pixels of rotated layers (see `lv_display_set_rotated_rendering()`).
+ * The pixels of the clip area are copied to a not rotated temporary layer, the task is drawn there
+ * and the result is copied back to the rotated positions.
+ * @param u     pointer to a software draw unit whose target layer is rotated
+ * @param t     the task to draw
+ */
+static void execute_drawing_unrotated(lv_draw_sw_unit_t * u, lv_draw_task_t * t)
+{
+    lv_draw_unit_t * draw_unit = (lv_draw_unit_t *)u;
+    lv_layer_t * layer = draw_unit->target_layer;
+    const lv_area_t * clip_area = draw_unit->clip_area;
+
+    lv_area_t area;
+    if(!lv_area_intersect(&area, clip_area, &layer->buf_area)) return;
+
+    lv_color_format_t cf = layer->color_format;
+    int32_t w = lv_area_get_width(&area);
+    int32_t h = lv_area_get_height(&area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint8_t * buf = lv_draw_sw_scratch_alloc(draw_unit, stride * h + LV_DRAW_BUF_ALIGN);
+    if(buf == NULL) return;
+
+    lv_draw_buf_t tmp_buf;
+    lv_draw_buf_init(&tmp_buf, w, h, cf, stride, lv_draw_buf_align(buf, cf), stride * h);
+
+    lv_layer_t tmp_layer;
+    lv_memzero(&tmp_layer, sizeof(tmp_layer));
+    tmp_layer.draw_buf = &tmp_buf;
+    tmp_layer.color_format = cf;
+    tmp_layer.buf_area = area;
+    tmp_layer._clip_area = area;
+    tmp_layer.phy_clip_area = area;
+
+    lv_draw_sw_rotated_layer_copy(layer, &area, tmp_buf.data, stride, false);
+
+    draw_unit->target_layer = &tmp_layer;
+    draw_unit->clip_area = &area;
+    draw_unrotated_only(u, t);
+    draw_unit->target_layer = layer;
+    draw_unit->clip_area = clip_area;
+
+    lv_draw_sw_rotated_layer_copy(layer, &area, tmp_buf.data, stride, true);
+
+    lv_draw_sw_scratch_free(draw_unit, buf);
+}
+
+/**
+ * Draw the tasks which support only not rotated layers
+ * @param u     pointer to a software draw unit
+ * @param t     a rectangle mask or vector graphics task
+ */
+static void draw_unrotated_only(lv_draw_sw_unit_t * u, lv_draw_task_t * t)
+{
+    if(t->type == LV_DRAW_TASK_TYPE_MASK_RECTANGLE) {
+        lv_draw_sw_mask_rect((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
+    }
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    else if(t->type == LV_DRAW_TASK_TYPE_VECTOR) {
+        lv_draw_sw_vector((lv_draw_unit_t *)u, t->draw_dsc);
+    }
+#endif
+}
+
 #if LV_DRAW_SW_SUPPORT_ARGB8888
 
 static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
                                int32_t src_stride,
                                int32_t dst_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE90_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint32_t * s = src + ty * src_stride + x;
+                uint32_t * d = dst + x * dst_stride + (src_height - ty - 1);
+                for(int32_t y = 0; y < th; ++y) {
+                    d[-y] = *s;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -613,18 +809,18 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
 static void rotate180_argb8888(const uint32_t * src, uint32_t * dst, int32_t width, int32_t height, int32_t src_stride,
                                int32_t dest_stride)
 {
-    LV_UNUSED(dest_stride);
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_ARGB8888(src, dst, width, height, src_stride, dest_stride)) {
         return ;
     }
 
     src_stride /= sizeof(uint32_t);
+    dest_stride /= sizeof(uint32_t);
 
     for(int32_t y = 0; y < height; ++y) {
-        int32_t dstIndex = (height - y - 1) * src_stride;
-        int32_t srcIndex = y * src_stride;
+        const uint32_t * s = src + y * src_stride;
+        uint32_t * d = dst + (height - y - 1) * dest_stride + width - 1;
         for(int32_t x = 0; x < width; ++x) {
-            dst[dstIndex + width - x - 1] = src[srcIndex + x];
+            d[-x] = s[x];
         }
     }
 }
@@ -632,19 +828,25 @@ static void rotate180_argb8888(const uint32_t * src, uint32_t * dst, int32_t wid
 static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
                               int32_t src_stride, int32_t dst_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE90_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint32_t * s = src + ty * src_stride + x;
+                uint32_t * d = dst + (src_width - x - 1) * dst_stride + ty;
+                for(int32_t y = 0; y < th; ++y) {
+                    d[y] = *s;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -661,13 +863,21 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        for(int32_t y = 0; y < src_height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint8_t * s = src + ty * src_stride + x * 3;
+                uint8_t * d = dst + (src_width - x - 1) * dst_stride + ty * 3;
+                for(int32_t y = 0; y < th; ++y) {
+                    d[0] = s[0];    /*Red*/
+                    d[1] = s[1];    /*Green*/
+                    d[2] = s[2];    /*Blue*/
+                    d += 3;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -675,35 +885,44 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
 static void rotate180_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
                              int32_t dest_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_RGB888(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_RGB888(src, dst, width, height, src_stride, dest_stride)) {
         return ;
     }
 
     for(int32_t y = 0; y < height; ++y) {
+        const uint8_t * s = src + y * src_stride;
+        uint8_t * d = dst + (height - y - 1) * dest_stride + (width - 1) * 3;
         for(int32_t x = 0; x < width; ++x) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = (height - y - 1) * dest_stride + (width - x - 1) * 3;
-            dst[dstIndex] = src[srcIndex];
-            dst[dstIndex + 1] = src[srcIndex + 1];
-            dst[dstIndex + 2] = src[srcIndex + 2];
+            d[-x * 3] = s[x * 3];
+            d[-x * 3 + 1] = s[x * 3 + 1];
+            d[-x * 3 + 2] = s[x * 3 + 2];
         }
     }
 }
 
-static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
+static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                             int32_t src_stride,
                              int32_t dst_stride)
 {
     if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_RGB888(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = x * dst_stride + (height - y - 1) * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint8_t * s = src + ty * src_stride + x * 3;
+                uint8_t * d = dst + x * dst_stride + (src_height - ty - 1) * 3;
+                for(int32_t y = 0; y < th; ++y) {
+                    d[0] = s[0];    /*Red*/
+                    d[1] = s[1];    /*Green*/
+                    d[2] = s[2];    /*Blue*/
+                    d -= 3;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -716,19 +935,25 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
                              int32_t src_stride,
                              int32_t dst_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE90_RGB565(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_RGB565(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint16_t * s = src + ty * src_stride + x;
+                uint16_t * d = dst + x * dst_stride + (src_height - ty - 1);
+                for(int32_t y = 0; y < th; ++y) {
+                    d[-y] = *s;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -736,7 +961,7 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
 static void rotate180_rgb565(const uint16_t * src, uint16_t * dst, int32_t width, int32_t height, int32_t src_stride,
                              int32_t dest_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_RGB565(src, dst, width, height, src_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_RGB565(src, dst, width, height, src_stride, dest_stride)) {
         return ;
     }
 
@@ -744,10 +969,10 @@ static void rotate180_rgb565(const uint16_t * src, uint16_t * dst, int32_t width
     dest_stride /= sizeof(uint16_t);
 
     for(int32_t y = 0; y < height; ++y) {
-        int32_t dstIndex = (height - y - 1) * dest_stride;
-        int32_t srcIndex = y * src_stride;
+        const uint16_t * s = src + y * src_stride;
+        uint16_t * d = dst + (height - y - 1) * dest_stride + width - 1;
         for(int32_t x = 0; x < width; ++x) {
-            dst[dstIndex + width - x - 1] = src[srcIndex + x];
+            d[-x] = s[x];
         }
     }
 }
@@ -756,19 +981,25 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_wi
                             int32_t src_stride,
                             int32_t dst_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_RGB565(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE90_RGB565(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint16_t * s = src + ty * src_stride + x;
+                uint16_t * d = dst + (src_width - x - 1) * dst_stride + ty;
+                for(int32_t y = 0; y < th; ++y) {
+                    d[y] = *s;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -782,16 +1013,22 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
                         int32_t src_stride,
                         int32_t dst_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_L8(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE90_L8(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint8_t * s = src + ty * src_stride + x;
+                uint8_t * d = dst + (src_width - x - 1) * dst_stride + ty;
+                for(int32_t y = 0; y < th; ++y) {
+                    d[y] = *s;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -799,15 +1036,15 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
 static void rotate180_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
                          int32_t dest_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_L8(src, dst, width, height, src_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_L8(src, dst, width, height, src_stride, dest_stride)) {
         return ;
     }
 
     for(int32_t y = 0; y < height; ++y) {
-        int32_t dstIndex = (height - y - 1) * dest_stride;
-        int32_t srcIndex = y * src_stride;
+        const uint8_t * s = src + y * src_stride;
+        uint8_t * d = dst + (height - y - 1) * dest_stride + width - 1;
         for(int32_t x = 0; x < width; ++x) {
-            dst[dstIndex + width - x - 1] = src[srcIndex + x];
+            d[-x] = s[x];
         }
     }
 }
@@ -816,16 +1053,22 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
                          int32_t src_stride,
                          int32_t dst_stride)
 {
-    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE90_L8(src, dst, src_width, src_height, src_stride, dst_stride)) {
+    if(LV_RESULT_OK == LV_DRAW_SW_ROTATE270_L8(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t th = LV_MIN(ROTATE_TILE_SIZE, src_height - ty);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t tx_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = tx; x < tx_end; ++x) {
+                const uint8_t * s = src + ty * src_stride + x;
+                uint8_t * d = dst + x * dst_stride + (src_height - ty - 1);
+                for(int32_t y = 0; y < th; ++y) {
+                    d[-y] = *s;
+                    s += src_stride;
+                }
+            }
         }
     }
 }
@@ -103,6 +103,13 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
  */
 void lv_draw_sw_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw a polyline with SW render.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the draw descriptor with `points` and `point_cnt` set
+ */
+void lv_draw_sw_polyline(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
+
 /**
  * Blend a layer with SW render
  * @param draw_unit     pointer to a draw unit
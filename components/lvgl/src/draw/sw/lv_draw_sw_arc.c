@@ -0,0 +1,660 @@
+/**
+ * @file lv_draw_sw_arc.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_area_private.h"
+#include "lv_draw_sw_mask_private.h"
+#include "blend/lv_draw_sw_blend_private.h"
+#include "../lv_image_decoder_private.h"
+#include "lv_draw_sw_private.h"
+#if LV_USE_DRAW_SW
+#if LV_DRAW_SW_COMPLEX
+
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_log.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_draw_private.h"
+
+static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_area, const lv_area_t * circle_area,
+                       lv_opa_t * mask_buf,  int32_t width);
+static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, lv_area_t * res_area);
+static lv_opa_t * create_circle_mask(lv_draw_unit_t * draw_unit, int32_t width);
+static void draw_arc_analytic(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords,
+                              const lv_area_t * clipped_area, int32_t start_angle, int32_t end_angle, int32_t width);
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
+#define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
+
+/*Larger arcs are drawn with masks as their distances from the angle lines would overflow in 1/65536 pixel units*/
+#define ANALYTIC_RADIUS_MAX 1024
+
+/*Farther than this from a line (in 1/65536 pixels) a pixel is fully covered or transparent*/
+#define HALF_PLANE_AA_DIST 32512
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Parameters of an arc drawn without angle masks*/
+typedef struct {
+    int32_t cx;             /*Center of the arc*/
+    int32_t cy;
+    int32_t start_nx;       /*Normal of the start angle's line*/
+    int32_t start_ny;
+    int32_t end_nx;         /*Normal of the end angle's line*/
+    int32_t end_ny;
+    bool wide;              /*The arc is larger than 180°*/
+    lv_draw_sw_mask_radius_param_t * mask_out;  /*The outer circle*/
+    lv_draw_sw_mask_radius_param_t * mask_in;   /*The inner circle or NULL if there is no hole*/
+} arc_analytic_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords)
+{
+#if LV_DRAW_SW_COMPLEX
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->width == 0) return;
+    if(dsc->start_angle == dsc->end_angle) return;
+
+    int32_t width = dsc->width;
+    if(width > dsc->radius) width = dsc->radius;
+
+    lv_area_t area_out = *coords;
+    lv_area_t clipped_area;
+    if(!lv_area_intersect(&clipped_area, &area_out, draw_unit->clip_area)) return;
+
+    /*Draw a full ring*/
+    if(dsc->img_src == NULL &&
+       (dsc->start_angle + 360 == dsc->end_angle || dsc->start_angle == dsc->end_angle + 360)) {
+        lv_draw_border_dsc_t cir_dsc;
+        lv_draw_border_dsc_init(&cir_dsc);
+        cir_dsc.opa = dsc->opa;
+        cir_dsc.color = dsc->color;
+        cir_dsc.width = width;
+        cir_dsc.radius = LV_RADIUS_CIRCLE;
+        cir_dsc.side = LV_BORDER_SIDE_FULL;
+        lv_draw_sw_border(draw_unit, &cir_dsc, &area_out);
+        return;
+    }
+
+    int32_t start_angle = (int32_t)dsc->start_angle;
+    int32_t end_angle = (int32_t)dsc->end_angle;
+    while(start_angle >= 360) start_angle -= 360;
+    while(end_angle >= 360) end_angle -= 360;
+
+    /*Calculate the coverage directly if there is no image*/
+    if(dsc->img_src == NULL && dsc->radius <= ANALYTIC_RADIUS_MAX) {
+        draw_arc_analytic(draw_unit, dsc, &area_out, &clipped_area, start_angle, end_angle, width);
+        return;
+    }
+
+    lv_area_t area_in;
+    lv_area_copy(&area_in, &area_out);
+    area_in.x1 += dsc->width;
+    area_in.y1 += dsc->width;
+    area_in.x2 -= dsc->width;
+    area_in.y2 -= dsc->width;
+
+    void * mask_list[4] = {0};
+    /*Create an angle mask*/
+    lv_draw_sw_mask_angle_param_t mask_angle_param;
+    lv_draw_sw_mask_angle_init(&mask_angle_param, dsc->center.x, dsc->center.y, start_angle, end_angle);
+    mask_list[0] = &mask_angle_param;
+
+    /*Create an outer mask*/
+    lv_draw_sw_mask_radius_param_t mask_out_param;
+    lv_draw_sw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
+    mask_list[1] = &mask_out_param;
+
+    /*Create inner the mask*/
+    lv_draw_sw_mask_radius_param_t mask_in_param;
+    bool mask_in_param_valid = false;
+    if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
+        lv_draw_sw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
+        mask_list[2] = &mask_in_param;
+        mask_in_param_valid = true;
+    }
+
+    int32_t blend_h = lv_area_get_height(&clipped_area);
+    int32_t blend_w = lv_area_get_width(&clipped_area);
+    int32_t h;
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, blend_w);
+
+    lv_area_t blend_area = clipped_area;
+    lv_area_t img_area;
+    lv_draw_sw_blend_dsc_t blend_dsc = {0};
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+
+    const uint8_t * img_mask = NULL;
+    lv_image_decoder_dsc_t decoder_dsc;
+    if(dsc->img_src == NULL) {
+        blend_dsc.color = dsc->color;
+    }
+    else {
+        lv_result_t res = lv_image_decoder_open(&decoder_dsc, dsc->img_src, NULL);
+        if(res == LV_RESULT_INVALID || decoder_dsc.decoded == NULL) {
+            LV_LOG_WARN("Can't decode the background image");
+            blend_dsc.color = dsc->color;
+        }
+        else {
+            img_area.x1 = 0;
+            img_area.y1 = 0;
+            img_area.x2 = decoder_dsc.decoded->header.w - 1;
+            img_area.y2 = decoder_dsc.decoded->header.h - 1;
+            int32_t ofs = decoder_dsc.decoded->header.w / 2;
+            lv_area_move(&img_area, dsc->center.x - ofs, dsc->center.y - ofs);
+            blend_dsc.src_area = &img_area;
+            blend_dsc.src_buf = decoder_dsc.decoded->data;
+            blend_dsc.src_stride = decoder_dsc.decoded->header.stride;
+            blend_dsc.src_color_format = decoder_dsc.decoded->header.cf;
+            if(blend_dsc.src_color_format == LV_COLOR_FORMAT_RGB565A8) {
+                blend_dsc.src_color_format = LV_COLOR_FORMAT_RGB565;
+                img_mask = (uint8_t *)blend_dsc.src_buf + blend_dsc.src_stride * lv_area_get_height(blend_dsc.src_area);
+            }
+        }
+    }
+
+    lv_opa_t * circle_mask = NULL;
+    lv_area_t round_area_1;
+    lv_area_t round_area_2;
+    if(dsc->rounded) {
+        circle_mask = create_circle_mask(draw_unit, width);
+        get_rounded_area(start_angle, dsc->radius, width, &round_area_1);
+        lv_area_move(&round_area_1, dsc->center.x, dsc->center.y);
+        get_rounded_area(end_angle, dsc->radius, width, &round_area_2);
+        lv_area_move(&round_area_2, dsc->center.x, dsc->center.y);
+
+    }
+
+    blend_area.y2 = blend_area.y1;
+    for(h = 0; h < blend_h; h++) {
+        lv_memset(mask_buf, 0xff, blend_w);
+        blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w);
+
+        if(dsc->rounded) {
+            if(blend_area.y1 >= round_area_1.y1 && blend_area.y1 <= round_area_1.y2) {
+                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                    lv_memzero(mask_buf, blend_w);
+                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+                }
+                add_circle(circle_mask, &blend_area, &round_area_1, mask_buf, width);
+            }
+            if(blend_area.y1 >= round_area_2.y1 && blend_area.y1 <= round_area_2.y2) {
+                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                    lv_memzero(mask_buf, blend_w);
+                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+                }
+                add_circle(circle_mask, &blend_area, &round_area_2, mask_buf, width);
+            }
+        }
+
+        /*If it was an RGB565A8 image use consider its A8 part on the mask*/
+        if(img_mask && blend_dsc.mask_res != LV_DRAW_SW_MASK_RES_TRANSP) {
+            const uint8_t * img_mask_tmp = img_mask;
+            img_mask_tmp += blend_dsc.src_stride / 2 * (blend_area.y1 - blend_dsc.src_area->y1);
+            img_mask_tmp += blend_area.x1 - blend_dsc.src_area->x1;
+
+            int32_t i;
+            for(i = 0; i < blend_w; i++) {
+                mask_buf[i] = LV_OPA_MIX2(mask_buf[i], img_mask_tmp[i]);
+            }
+            if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) {
+                blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+            }
+        }
+
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+
+        blend_area.y1 ++;
+        blend_area.y2 ++;
+    }
+
+    lv_draw_sw_mask_free_param(&mask_angle_param);
+    lv_draw_sw_mask_free_param(&mask_out_param);
+    if(mask_in_param_valid) {
+        lv_draw_sw_mask_free_param(&mask_in_param);
+    }
+
+    if(circle_mask) lv_draw_sw_scratch_free(draw_unit, circle_mask);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
+    if(dsc->img_src) lv_image_decoder_close(&decoder_dsc);
+#else
+    LV_LOG_WARN("Can't draw arc with LV_DRAW_SW_COMPLEX == 0");
+    LV_UNUSED(center);
+    LV_UNUSED(radius);
+    LV_UNUSED(start_angle);
+    LV_UNUSED(end_angle);
+    LV_UNUSED(layer);
+    LV_UNUSED(dsc);
+#endif /*LV_DRAW_SW_COMPLEX*/
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_area, const lv_area_t * circle_area,
+                       lv_opa_t * mask_buf,  int32_t width)
+{
+    lv_area_t circle_common_area;
+    if(lv_area_intersect(&circle_common_area, circle_area, blend_area)) {
+        const lv_opa_t * circle_mask_tmp = circle_mask + width * (circle_common_area.y1 - circle_area->y1);
+        circle_mask_tmp += circle_common_area.x1 - circle_area->x1;
+
+        lv_opa_t * mask_buf_tmp = mask_buf + circle_common_area.x1 - blend_area->x1;
+
+        uint32_t x;
+        uint32_t w = lv_area_get_width(&circle_common_area);
+        for(x = 0; x < w; x++) {
+            uint32_t res = mask_buf_tmp[x] + circle_mask_tmp[x];
+            mask_buf_tmp[x] = res > 255 ? 255 : res;
+        }
+    }
+
+}
+
+static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, lv_area_t * res_area)
+{
+    int32_t thick_half = thickness / 2;
+    uint8_t thick_corr = (thickness & 0x01) ? 0 : 1;
+
+    int32_t cir_x;
+    int32_t cir_y;
+
+    cir_x = ((radius - thick_half) * lv_trigo_cos(angle)) >> (LV_TRIGO_SHIFT - 8);
+    cir_y = ((radius - thick_half) * lv_trigo_sin(angle)) >> (LV_TRIGO_SHIFT - 8);
+
+    /*The center of the pixel need to be calculated so apply 1/2 px offset*/
+    if(cir_x > 0) {
+        cir_x = (cir_x - 128) >> 8;
+        res_area->x1 = cir_x - thick_half + thick_corr;
+        res_area->x2 = cir_x + thick_half;
+    }
+    else {
+        cir_x = (cir_x + 128) >> 8;
+        res_area->x1 = cir_x - thick_half;
+        res_area->x2 = cir_x + thick_half - thick_corr;
+    }
+
+    if(cir_y > 0) {
+        cir_y = (cir_y - 128) >> 8;
+        res_area->y1 = cir_y - thick_half + thick_corr;
+        res_area->y2 = cir_y + thick_half;
+    }
+    else {
+        cir_y = (cir_y + 128) >> 8;
+        res_area->y1 = cir_y - thick_half;
+        res_area->y2 = cir_y + thick_half - thick_corr;
+    }
+}
+
+/**
+ * Create an A8 mask of a circle to draw the rounded ends
+ * @param draw_unit     pointer to a draw unit
+ * @param width         diameter of the circle
+ * @return              `width * width` mask, free it with `lv_draw_sw_scratch_free()`
+ */
+static lv_opa_t * create_circle_mask(lv_draw_unit_t * draw_unit, int32_t width)
+{
+    lv_opa_t * circle_mask = lv_draw_sw_scratch_alloc(draw_unit, width * width);
+    lv_memset(circle_mask, 0xff, width * width);
+    lv_area_t circle_area = {0, 0, width - 1, width - 1};
+    lv_draw_sw_mask_radius_param_t circle_mask_param;
+    lv_draw_sw_mask_radius_init(&circle_mask_param, &circle_area, width / 2, false);
+    void * circle_mask_list[2] = {&circle_mask_param, NULL};
+
+    lv_opa_t * circle_mask_tmp = circle_mask;
+    int32_t h;
+    for(h = 0; h < width; h++) {
+        lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(circle_mask_list, circle_mask_tmp, 0, h, width);
+        if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
+            lv_memzero(circle_mask_tmp, width);
+        }
+
+        circle_mask_tmp += width;
+    }
+    lv_draw_sw_mask_free_param(&circle_mask_param);
+
+    return circle_mask;
+}
+
+/**
+ * Get the normal of an angle's line pointing toward the arc.
+ * The line's direction is rounded the same way as in `lv_draw_sw_mask_line_angle_init()`
+ * to get the same edges as with the angle masks.
+ * @param angle     the angle in degrees [0..360)
+ * @param start     true: it's the start angle, false: it's the end angle
+ * @param nx        store the x component of the normal here in 1/32768 units
+ * @param ny        store the y component of the normal here in 1/32768 units
+ */
+static void get_angle_normal(int32_t angle, bool start, int32_t * nx, int32_t * ny)
+{
+    int32_t line_angle = angle > 180 ? angle - 180 : angle;
+    int32_t dx = lv_trigo_sin(line_angle + 90) >> 5;
+    int32_t dy = lv_trigo_sin(line_angle) >> 5;
+    int32_t len = lv_sqrt32((uint32_t)(dx * dx + dy * dy));
+    *nx = -dy * 32768 / len;
+    *ny = dx * 32768 / len;
+
+    /*The arc is on the left of the start angle and on the right of the end angle*/
+    int32_t angle_sin = lv_trigo_sin(angle);
+    int32_t angle_cos = lv_trigo_cos(angle);
+    int32_t dot = -angle_sin * (*nx / 2) + angle_cos * (*ny / 2);
+    if(!start) dot = -dot;
+    if(dot < 0) {
+        *nx = -*nx;
+        *ny = -*ny;
+    }
+}
+
+/**
+ * Get the coverage of a pixel next to a line
+ * @param dist      signed distance of the pixel's center from the line in 1/65536 pixels
+ * @return          the coverage of the positive side of the line
+ */
+static inline lv_opa_t get_half_plane_opa(int32_t dist)
+{
+    int32_t v = (dist + 32768) >> 8;
+    return (lv_opa_t)LV_CLAMP(0, v, 255);
+}
+
+/**
+ * Get the pixels of a row whose distance from a line is at least `limit`
+ * @param dist      distance of the first pixel's center from the line in 1/65536 pixels
+ * @param step      change of the distance from pixel to pixel
+ * @param limit     the minimal distance in 1/65536 pixels
+ * @param len       number of pixels in the row
+ * @param span      store the result here as [span[0], span[1])
+ */
+static void get_line_span(int32_t dist, int32_t step, int32_t limit, int32_t len, int32_t span[2])
+{
+    int32_t x1 = 0;
+    int32_t x2 = len;
+    if(step > 0) {
+        if(dist < limit) x1 = (limit - dist + step - 1) / step;
+    }
+    else if(step < 0) {
+        x2 = dist < limit ? 0 : (dist - limit) / -step + 1;
+    }
+    else if(dist < limit) {
+        x2 = 0;
+    }
+
+    span[1] = LV_CLAMP(0, x2, len);
+    span[0] = LV_CLAMP(0, x1, span[1]);
+}
+
+/**
+ * Get the pixels of a row which are visible and not fully covered by a line's half plane
+ * @param dist      distance of the first pixel's center from the line in 1/65536 pixels
+ * @param step      change of the distance from pixel to pixel
+ * @param len       number of pixels in the row
+ * @param visible   store the pixels with any coverage here as [visible[0], visible[1])
+ * @param partial   store the pixels with partial coverage here as [partial[0], partial[1])
+ */
+static void get_line_spans(int32_t dist, int32_t step, int32_t len, int32_t visible[2], int32_t partial[2])
+{
+    int32_t full[2];
+    get_line_span(dist, step, -HALF_PLANE_AA_DIST, len, visible);
+    get_line_span(dist, step, HALF_PLANE_AA_DIST, len, full);
+
+    /*The fully covered pixels are on the same side as the visible ones*/
+    if(step > 0) {
+        partial[0] = visible[0];
+        partial[1] = full[0];
+    }
+    else {
+        partial[0] = full[1];
+        partial[1] = visible[1];
+    }
+}
+
+/**
+ * Apply the start and end angles on a part of the row
+ * @param a             the arc's parameters
+ * @param mask_buf      the coverage of the row
+ * @param start_dist    distance of the row's first pixel from the start line
+ * @param end_dist      distance of the row's first pixel from the end line
+ * @param x1            the first pixel to process
+ * @param x2            the pixel after the last one to process
+ */
+static void apply_arc_angles(const arc_analytic_t * a, lv_opa_t * mask_buf, int32_t start_dist, int32_t end_dist,
+                             int32_t x1, int32_t x2)
+{
+    start_dist += x1 * 2 * a->start_nx;
+    end_dist += x1 * 2 * a->end_nx;
+    int32_t x;
+    for(x = x1; x < x2; x++) {
+        if(mask_buf[x] != LV_OPA_TRANSP) {
+            lv_opa_t start_opa = get_half_plane_opa(start_dist);
+            lv_opa_t end_opa = get_half_plane_opa(end_dist);
+            lv_opa_t angle_opa = a->wide ? LV_MAX(start_opa, end_opa) : LV_MIN(start_opa, end_opa);
+            if(angle_opa < LV_OPA_COVER) mask_buf[x] = LV_OPA_MIX2(mask_buf[x], angle_opa);
+        }
+
+        start_dist += 2 * a->start_nx;
+        end_dist += 2 * a->end_nx;
+    }
+}
+
+/**
+ * Calculate the coverage of a row of the arc. Only the pixels close to the angles' lines are processed
+ * one by one, the rest is filled by the radius masks.
+ * @param a         the arc's parameters
+ * @param mask_buf  store the coverage here
+ * @param x         x coordinate of the row's first pixel
+ * @param y         y coordinate of the row
+ * @param len       number of pixels in the row
+ * @param span      store the pixels which might be visible here as [span[0], span[1])
+ */
+static void get_arc_row_opa(const arc_analytic_t * a, lv_opa_t * mask_buf, int32_t x, int32_t y, int32_t len,
+                            int32_t span[2])
+{
+    /*Use half pixel units to address the pixel centers with integers*/
+    int32_t px = 2 * (x - a->cx) + 1;
+    int32_t py = 2 * (y - a->cy) + 1;
+    int32_t start_dist = px * a->start_nx + py * a->start_ny;
+    int32_t end_dist = px * a->end_nx + py * a->end_ny;
+
+    int32_t start_vis[2];
+    int32_t start_partial[2];
+    int32_t end_vis[2];
+    int32_t end_partial[2];
+    get_line_spans(start_dist, 2 * a->start_nx, len, start_vis, start_partial);
+    get_line_spans(end_dist, 2 * a->end_nx, len, end_vis, end_partial);
+
+    /*The pixels between the visible parts of the two half planes are hidden on wide arcs*/
+    int32_t gap[2] = {0, 0};
+    if(a->wide) {
+        if(start_vis[0] == start_vis[1]) lv_memcpy(span, end_vis, sizeof(end_vis));
+        else if(end_vis[0] == end_vis[1]) lv_memcpy(span, start_vis, sizeof(start_vis));
+        else {
+            span[0] = LV_MIN(start_vis[0], end_vis[0]);
+            span[1] = LV_MAX(start_vis[1], end_vis[1]);
+            gap[0] = LV_MIN(start_vis[1], end_vis[1]);
+            gap[1] = LV_MAX(start_vis[0], end_vis[0]);
+        }
+    }
+    else {
+        span[0] = LV_MAX(start_vis[0], end_vis[0]);
+        span[1] = LV_MIN(start_vis[1], end_vis[1]);
+    }
+    if(span[0] >= span[1]) {
+        span[0] = span[1] = 0;
+        return;
+    }
+
+    int32_t span_len = span[1] - span[0];
+    lv_memset(&mask_buf[span[0]], 0xff, span_len);
+    lv_draw_sw_mask_res_t res = a->mask_out->dsc.cb(&mask_buf[span[0]], x + span[0], y, span_len, a->mask_out);
+    if(res != LV_DRAW_SW_MASK_RES_TRANSP && a->mask_in) {
+        res = a->mask_in->dsc.cb(&mask_buf[span[0]], x + span[0], y, span_len, a->mask_in);
+    }
+    if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
+        span[0] = span[1] = 0;
+        return;
+    }
+
+    if(gap[0] < gap[1]) lv_memzero(&mask_buf[gap[0]], gap[1] - gap[0]);
+
+    /*Don't process the pixels twice where the partial parts overlap*/
+    apply_arc_angles(a, mask_buf, start_dist, end_dist, LV_MAX(start_partial[0], span[0]),
+                     LV_MIN(start_partial[1], span[1]));
+    apply_arc_angles(a, mask_buf, start_dist, end_dist, LV_MAX(end_partial[0], span[0]),
+                     LV_MIN3(end_partial[1], span[1], start_partial[0]));
+    apply_arc_angles(a, mask_buf, start_dist, end_dist, LV_MAX3(end_partial[0], span[0], start_partial[1]),
+                     LV_MIN(end_partial[1], span[1]));
+}
+
+/**
+ * Draw a colored arc without the angle mask and the generic mask pipeline.
+ * The edges of the circles are read from the same precomputed circle tables as the radius masks use,
+ * so they are the same as with masks. The start and end angles are applied directly
+ * from the distances of the pixels from the angles' lines.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the arc's descriptor
+ * @param coords        the outer circle's area
+ * @param clipped_area  the area to draw
+ * @param start_angle   the start angle normalized to [0..360)
+ * @param end_angle     the end angle normalized to [0..360)
+ * @param width         width of the arc limited to the radius
+ */
+static void draw_arc_analytic(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords,
+                              const lv_area_t * clipped_area, int32_t start_angle, int32_t end_angle, int32_t width)
+{
+    /*Up to 180° the arc is on the positive side of both lines, else on the positive side of any of them.*/
+    arc_analytic_t a;
+    get_angle_normal(start_angle, true, &a.start_nx, &a.start_ny);
+    get_angle_normal(end_angle, false, &a.end_nx, &a.end_ny);
+    int32_t delta = end_angle - start_angle;
+    if(delta < 0) delta += 360;
+    a.wide = delta > 180;
+    a.cx = dsc->center.x;
+    a.cy = dsc->center.y;
+
+    /*Skip the rows and columns where the angles surely hide the arc. Add 1 pixel for the anti-aliasing.*/
+    lv_area_t arc_area;
+    lv_draw_arc_get_area(a.cx, a.cy, (uint16_t)dsc->radius, start_angle, end_angle, width, dsc->rounded, &arc_area);
+    lv_area_increase(&arc_area, 1, 1);
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, clipped_area, &arc_area)) return;
+    clipped_area = &draw_area;
+
+    lv_draw_sw_mask_radius_param_t mask_out_param;
+    lv_draw_sw_mask_radius_init(&mask_out_param, coords, LV_RADIUS_CIRCLE, false);
+    a.mask_out = &mask_out_param;
+
+    lv_area_t area_in = *coords;
+    lv_area_increase(&area_in, -dsc->width, -dsc->width);
+    lv_draw_sw_mask_radius_param_t mask_in_param;
+    a.mask_in = NULL;
+    if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
+        lv_draw_sw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
+        a.mask_in = &mask_in_param;
+    }
+
+    lv_opa_t * circle_mask = NULL;
+    lv_area_t round_area[2];
+    if(dsc->rounded) {
+        circle_mask = create_circle_mask(draw_unit, width);
+        get_rounded_area(start_angle, dsc->radius, width, &round_area[0]);
+        lv_area_move(&round_area[0], a.cx, a.cy);
+        get_rounded_area(end_angle, dsc->radius, width, &round_area[1]);
+        lv_area_move(&round_area[1], a.cx, a.cy);
+    }
+
+    int32_t blend_w = lv_area_get_width(clipped_area);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, blend_w);
+
+    lv_area_t blend_area;
+    lv_draw_sw_blend_dsc_t blend_dsc = {0};
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.color = dsc->color;
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+
+    int32_t y;
+    for(y = clipped_area->y1; y <= clipped_area->y2; y++) {
+        int32_t span[2];
+        get_arc_row_opa(&a, mask_buf, clipped_area->x1, y, blend_w, span);
+
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        if(dsc->rounded) {
+            int32_t i;
+            for(i = 0; i < 2; i++) {
+                if(y < round_area[i].y1 || y > round_area[i].y2) continue;
+
+                /*Add the rounded end to the row and clear the pixels which were out of the span so far*/
+                int32_t round_x1 = LV_MAX(round_area[i].x1 - clipped_area->x1, 0);
+                int32_t round_x2 = LV_MIN(round_area[i].x2 - clipped_area->x1 + 1, blend_w);
+                if(round_x1 >= round_x2) continue;
+                if(span[0] == span[1]) {
+                    span[0] = round_x1;
+                    span[1] = round_x1;
+                }
+                if(round_x1 < span[0]) lv_memzero(&mask_buf[round_x1], span[0] - round_x1);
+                if(round_x2 > span[1]) lv_memzero(&mask_buf[span[1]], round_x2 - span[1]);
+                span[0] = LV_MIN(span[0], round_x1);
+                span[1] = LV_MAX(span[1], round_x2);
+
+                blend_area.x1 = clipped_area->x1 + span[0];
+                blend_area.x2 = clipped_area->x1 + span[1] - 1;
+                add_circle(circle_mask, &blend_area, &round_area[i], &mask_buf[span[0]], width);
+            }
+        }
+
+        if(span[0] == span[1]) continue;
+
+        blend_area.x1 = clipped_area->x1 + span[0];
+        blend_area.x2 = clipped_area->x1 + span[1] - 1;
+        blend_dsc.mask_buf = &mask_buf[span[0]];
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+    }
+
+    lv_draw_sw_mask_free_param(&mask_out_param);
+    if(a.mask_in) lv_draw_sw_mask_free_param(&mask_in_param);
+    if(circle_mask) lv_draw_sw_scratch_free(draw_unit, circle_mask);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
+}
+
+#else /*LV_DRAW_SW_COMPLEX*/
+
+void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(dsc);
+    LV_UNUSED(coords);
+
+    LV_LOG_WARN("LV_DRAW_SW_COMPLEX needs to be enabled");
+}
+
+#endif /*LV_DRAW_SW_COMPLEX*/
+#endif /*LV_USE_DRAW_SW*/
@@ -9,7 +9,7 @@
 #include "../../misc/lv_area_private.h"
 #include "lv_draw_sw_mask_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 #if LV_USE_DRAW_SW
 
 #if LV_DRAW_SW_COMPLEX
@@ -20,6 +20,7 @@
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
 #include "../../stdlib/lv_string.h"
+#include "../../misc/cache/lv_cache.h"
 #include "../lv_draw_mask.h"
 
 /*********************
@@ -28,20 +29,44 @@
 #define SHADOW_UPSCALE_SHIFT    6
 #define SHADOW_ENHANCE          1
 
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    #define shadow_cache LV_GLOBAL_DEFAULT()->sw_shadow_cache
+#if defined(LV_DRAW_SW_SHADOW_CACHE_BYTES) && LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    #define shadow_cache_p (LV_GLOBAL_DEFAULT()->sw_shadow_cache)
+    #define CACHE_NAME  "SW_SHADOW"
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+
+/*The corner depends only on these parameters, the position of the shadow doesn't matter*/
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    int32_t sw;         /*Shadow width*/
+    int32_t r;          /*Clamped radius*/
+    int32_t w;          /*Width of the blurred area, clamped to the size affecting the corner*/
+    int32_t h;          /*Height of the blurred area, clamped to the size affecting the corner*/
+    lv_opa_t * buf;
+} shadow_cache_data_t;
+
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+static lv_opa_t * create_corner(int32_t w, int32_t h, int32_t sw, int32_t r);
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data);
+    static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                          const shadow_cache_data_t * rhs);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -97,31 +122,36 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
-
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
+    /*The other corners of the blurred rectangle are out of the corner buffer above this size
+     *so larger rectangles have the same corners*/
+    int32_t core_w = LV_MIN(lv_area_get_width(&core_area), corner_size + r_sh);
+    int32_t core_h = LV_MIN(lv_area_get_height(&core_area), corner_size + r_sh);
+
+    /*The corner is only read, so it can be used directly from the cache*/
+    lv_opa_t * sh_buf = NULL;
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    lv_cache_entry_t * cache_entry = NULL;
+    if(shadow_cache_p && lv_cache_is_enabled(shadow_cache_p)) {
+        shadow_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.sw = dsc->width;
+        search_key.r = r_sh;
+        search_key.w = core_w;
+        search_key.h = core_h;
+        search_key.slot.size = corner_size * corner_size * 2;
+
+        cache_entry = lv_cache_acquire_or_create(shadow_cache_p, &search_key, NULL);
+        if(cache_entry) {
+            shadow_cache_data_t * cached = lv_cache_entry_get_data(cache_entry);
+            sh_buf = cached->buf;
         }
     }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+#endif /*LV_DRAW_SW_SHADOW_CACHE_BYTES*/
+
+    /*Not cached: too large or all the cached corners are in use*/
+    if(sh_buf == NULL) sh_buf = create_corner(core_w, core_h, dsc->width, r_sh);
+    if(sh_buf == NULL) return;
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
@@ -135,7 +165,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
         masks[0] = &mask_rout_param;
     }
 
-    lv_opa_t * mask_buf = lv_malloc(lv_area_get_width(&shadow_area));
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, lv_area_get_width(&shadow_area));
     lv_area_t blend_area;
     lv_area_t clip_area_sub;
     lv_opa_t * sh_buf_tmp;
@@ -379,22 +409,8 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
         }
     }
 
-    /*Mirror the shadow corner buffer horizontally*/
-    sh_buf_tmp = sh_buf ;
-    for(y = 0; y < corner_size; y++) {
-        int32_t x;
-        lv_opa_t * start = sh_buf_tmp;
-        lv_opa_t * end = sh_buf_tmp + corner_size - 1;
-        for(x = 0; x < corner_size / 2; x++) {
-            lv_opa_t tmp = *start;
-            *start = *end;
-            *end = tmp;
-
-            start++;
-            end--;
-        }
-        sh_buf_tmp += corner_size;
-    }
+    /*The horizontally mirrored corner is stored after the right corner*/
+    lv_opa_t * sh_buf_left = sh_buf + corner_size * corner_size;
 
     /*Left side*/
     blend_area.x1 = shadow_area.x1;
@@ -409,7 +425,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     if(lv_area_intersect(&clip_area_sub, &blend_area, draw_unit->clip_area) &&
        !lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
         int32_t w = lv_area_get_width(&clip_area_sub);
-        sh_buf_tmp = sh_buf;
+        sh_buf_tmp = sh_buf_left;
         sh_buf_tmp += (corner_size - 1) * corner_size;
         sh_buf_tmp += clip_area_sub.x1 - blend_area.x1;
 
@@ -448,7 +464,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     if(lv_area_intersect(&clip_area_sub, &blend_area, draw_unit->clip_area) &&
        !lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
         int32_t w = lv_area_get_width(&clip_area_sub);
-        sh_buf_tmp = sh_buf;
+        sh_buf_tmp = sh_buf_left;
         sh_buf_tmp += (clip_area_sub.y1 - blend_area.y1) * corner_size;
         sh_buf_tmp += clip_area_sub.x1 - blend_area.x1;
 
@@ -493,7 +509,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     if(lv_area_intersect(&clip_area_sub, &blend_area, draw_unit->clip_area) &&
        !lv_area_is_in(&clip_area_sub, &bg_area, r_bg)) {
         int32_t w = lv_area_get_width(&clip_area_sub);
-        sh_buf_tmp = sh_buf;
+        sh_buf_tmp = sh_buf_left;
         sh_buf_tmp += (blend_area.y2 - clip_area_sub.y2) * corner_size;
         sh_buf_tmp += clip_area_sub.x1 - blend_area.x1;
 
@@ -552,14 +568,113 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    if(cache_entry) lv_cache_release(shadow_cache_p, cache_entry, NULL);
+    else lv_free(sh_buf);
+#else
     lv_free(sh_buf);
-    lv_free(mask_buf);
+#endif
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
+}
+
+void lv_draw_sw_box_shadow_cache_init(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    if(shadow_cache_p != NULL) return;
+
+    shadow_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(shadow_cache_data_t), LV_DRAW_SW_SHADOW_CACHE_BYTES, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) shadow_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) shadow_cache_free_cb,
+    });
+
+    if(shadow_cache_p) lv_cache_set_name(shadow_cache_p, CACHE_NAME);
+#endif
+}
+
+void lv_draw_sw_box_shadow_cache_deinit(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    if(shadow_cache_p == NULL) return;
+
+    lv_cache_destroy(shadow_cache_p, NULL);
+    shadow_cache_p = NULL;
+#endif
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Allocate and calculate a blurred corner
+ * @param w     width of the blurred rectangle
+ * @param h     height of the blurred rectangle
+ * @param sw    shadow width
+ * @param r     radius
+ * @return      `(sw + r)^2` opacity values of the right corner followed by the
+ *              horizontally mirrored left corner. Free it with `lv_free`
+ */
+static lv_opa_t * create_corner(int32_t w, int32_t h, int32_t sw, int32_t r)
+{
+    int32_t size = sw + r;
+
+    /*The calculation needs `uint16_t`s, the result is `lv_opa_t`s so
+     *the second half can store the mirrored corner*/
+    uint16_t * buf = lv_malloc(size * size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return NULL;
+
+    lv_area_t core_area;
+    lv_area_set(&core_area, 0, 0, w - 1, h - 1);
+    shadow_draw_corner_buf(&core_area, buf, sw, r);
+
+    lv_opa_t * res = (lv_opa_t *)buf;
+    lv_opa_t * mirrored = res + size * size;
+    int32_t y;
+    for(y = 0; y < size; y++) {
+        int32_t x;
+        for(x = 0; x < size; x++) {
+            mirrored[x] = res[size - 1 - x];
+        }
+        res += size;
+        mirrored += size;
+    }
+
+    return (lv_opa_t *)buf;
+}
+
+#if LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+
+static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    data->buf = create_corner(data->w, data->h, data->sw, data->r);
+    return data->buf != NULL;
+}
+
+static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(data->buf);
+}
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                      const shadow_cache_data_t * rhs)
+{
+    if(lhs->sw != rhs->sw) return lhs->sw > rhs->sw ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+
+    return 0;
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_BYTES*/
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
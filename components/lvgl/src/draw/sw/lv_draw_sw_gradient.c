@@ -12,6 +12,9 @@
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../stdlib/lv_string.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
@@ -26,10 +29,30 @@
     #define ALIGN(X)    (((X) + 3) & ~3)
 #endif
 
+#define CACHE_NAME  "SW_GRADIENT"
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->sw_grad_cache)
+
+/*Size of the color map of complex gradients*/
+#define COMPLEX_MAP_SIZE    256
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+
+/*The color map depends only on the stops and the size, not on the direction*/
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    lv_gradient_stop_t stops[LV_GRADIENT_MAX_STOPS];
+    uint8_t stops_count;
+    int32_t size;
+    lv_grad_t * grad;
+} grad_cache_data_t;
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 typedef struct {
@@ -73,7 +96,15 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 typedef lv_result_t (*op_cache_t)(lv_grad_t * c, void * ctx);
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static lv_grad_t * allocate_item(int32_t size);
+static lv_grad_t * create_map(const lv_grad_dsc_t * g, int32_t size);
+static lv_grad_t * get_shared_map(const lv_grad_dsc_t * g, int32_t size);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data);
+    static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs);
+#endif
 
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
@@ -89,24 +120,14 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static size_t get_item_size(int32_t size)
 {
-    int32_t size;
-    switch(g->dir) {
-        case LV_GRAD_DIR_HOR:
-        case LV_GRAD_DIR_LINEAR:
-        case LV_GRAD_DIR_RADIAL:
-        case LV_GRAD_DIR_CONICAL:
-            size = w;
-            break;
-        case LV_GRAD_DIR_VER:
-            size = h;
-            break;
-        default:
-            size = 64;
-    }
+    return ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
 
-    size_t req_size = ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+static lv_grad_t * allocate_item(int32_t size)
+{
+    size_t req_size = get_item_size(size);
     lv_grad_t * item  = lv_malloc(req_size);
     LV_ASSERT_MALLOC(item);
     if(item == NULL) return NULL;
@@ -115,9 +136,60 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->cache_entry = NULL;
     return item;
 }
 
+static lv_grad_t * create_map(const lv_grad_dsc_t * g, int32_t size)
+{
+    lv_grad_t * item = allocate_item(size);
+    if(item == NULL) {
+        LV_LOG_WARN("Failed to allocate item for the gradient");
+        return item;
+    }
+
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+    return item;
+}
+
+/**
+ * Get a color map which is only read. It's taken from the cache if possible.
+ * @param g         the gradient descriptor
+ * @param size      number of elements of the map
+ * @return          the color map, release it with `lv_gradient_cleanup`
+ */
+static lv_grad_t * get_shared_map(const lv_grad_dsc_t * g, int32_t size)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad_cache_p == NULL || !lv_cache_is_enabled(grad_cache_p)) return create_map(g, size);
+
+    /*The cache would log an error on every draw for maps which can never fit*/
+    size_t item_size = get_item_size(size);
+    if(item_size > lv_cache_get_max_size(grad_cache_p, NULL)) return create_map(g, size);
+
+    grad_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    lv_memcpy(search_key.stops, g->stops, sizeof(lv_gradient_stop_t) * g->stops_count);
+    search_key.stops_count = g->stops_count;
+    search_key.size = size;
+    search_key.slot.size = item_size;
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(grad_cache_p, &search_key, (void *)g);
+    if(entry == NULL) {
+        /*E.g. all the cached maps are in use*/
+        return create_map(g, size);
+    }
+
+    grad_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->grad;
+#else
+    return create_map(g, size);
+#endif
+}
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
@@ -137,28 +209,94 @@ static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
 
 #endif
 
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+
+static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data)
+{
+    const lv_grad_dsc_t * g = user_data;
+    data->grad = create_map(g, data->size);
+    if(data->grad == NULL) return false;
+
+    /*Let `lv_gradient_cleanup` know that it needs to be released*/
+    data->grad->cache_entry = lv_cache_entry_get_entry(data, sizeof(grad_cache_data_t));
+    return true;
+}
+
+static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(data->grad);
+}
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs)
+{
+    if(lhs->size != rhs->size) {
+        return lhs->size > rhs->size ? 1 : -1;
+    }
+
+    if(lhs->stops_count != rhs->stops_count) {
+        return lhs->stops_count > rhs->stops_count ? 1 : -1;
+    }
+
+    int cmp_res = lv_memcmp(lhs->stops, rhs->stops, sizeof(lv_gradient_stop_t) * lhs->stops_count);
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+
+    return 0;
+}
+
+#endif
+
 /**********************
  *     FUNCTIONS
  **********************/
 
+void lv_gradient_cache_init(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad_cache_p != NULL) return;
+
+    grad_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(grad_cache_data_t), LV_DRAW_SW_GRADIENT_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) grad_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) grad_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) grad_cache_free_cb,
+    });
+
+    if(grad_cache_p) lv_cache_set_name(grad_cache_p, CACHE_NAME);
+#endif
+}
+
+void lv_gradient_cache_deinit(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad_cache_p == NULL) return;
+
+    lv_cache_destroy(grad_cache_p, NULL);
+    grad_cache_p = NULL;
+#endif
+}
+
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 1: Search cache for the given key */
-    lv_grad_t * item = allocate_item(g, w, h);
-    if(item == NULL) {
-        LV_LOG_WARN("Failed to allocate item for the gradient");
-        return item;
-    }
-
-    /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    switch(g->dir) {
+        case LV_GRAD_DIR_HOR:
+            return get_shared_map(g, w);
+        case LV_GRAD_DIR_VER:
+            return get_shared_map(g, h);
+        case LV_GRAD_DIR_LINEAR:
+        case LV_GRAD_DIR_RADIAL:
+        case LV_GRAD_DIR_CONICAL:
+            /*The pixels of the lines are rendered into the returned buffer, so it can't be shared*/
+            return create_map(g, w);
+        default:
+            return create_map(g, 64);
     }
-    return item;
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_gradient_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
@@ -216,6 +354,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_gradient_color_calculate(const lv_grad_dsc_t * dsc
 
 void lv_gradient_cleanup(lv_grad_t * grad)
 {
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad->cache_entry) {
+        lv_cache_release(grad_cache_p, grad->cache_entry, NULL);
+        return;
+    }
+#endif
+
     lv_free(grad);
 }
 
@@ -305,7 +450,7 @@ void lv_gradient_radial_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     LV_ASSERT(r_end != 0);
 
     /* Create gradient color map */
-    state->cgrad = lv_gradient_get(dsc, 256, 0);
+    state->cgrad = get_shared_map(dsc, COMPLEX_MAP_SIZE);
 
     state->x0 = start.x;
     state->y0 = start.y;
@@ -474,7 +619,7 @@ void lv_gradient_linear_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_gradient_get(dsc, 256, 0);
+    state->cgrad = get_shared_map(dsc, COMPLEX_MAP_SIZE);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -501,7 +646,7 @@ void lv_gradient_linear_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_gradient_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -548,7 +693,7 @@ void lv_gradient_conical_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_gradient_get(dsc, 256, 0);
+    state->cgrad = get_shared_map(dsc, COMPLEX_MAP_SIZE);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -573,7 +718,7 @@ void lv_gradient_conical_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_gradient_cleanup(state->cgrad);
     lv_free(state);
 }
 
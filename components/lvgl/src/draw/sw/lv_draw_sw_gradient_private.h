@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw_sw_gradient.h"
+#include "../../misc/cache/lv_cache_private.h"
 
 #if LV_USE_DRAW_SW
 
@@ -30,6 +31,7 @@ struct lv_grad_t {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * cache_entry;     /**< Set if the map is owned by the gradient cache*/
 };
 
 
@@ -37,6 +39,16 @@ struct lv_grad_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the gradient color maps
+ */
+void lv_gradient_cache_init(void);
+
+/**
+ * Free the cache of the gradient color maps
+ */
+void lv_gradient_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
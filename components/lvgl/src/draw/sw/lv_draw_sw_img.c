@@ -11,7 +11,7 @@
 #include "../lv_image_decoder_private.h"
 #include "../lv_draw_image_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 #if LV_USE_DRAW_SW
 
 #include "../../display/lv_display.h"
@@ -311,13 +311,13 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
             uint32_t buf_stride = blend_w * 3;
             buf_h = MAX_BUF_SIZE / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
-            tmp_buf = lv_malloc(buf_stride * buf_h);
+            tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, buf_stride * buf_h);
         }
         else {
             uint32_t buf_stride = blend_w * lv_color_format_get_size(cf_final);
             buf_h = MAX_BUF_SIZE / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
-            tmp_buf = lv_malloc(buf_stride * buf_h);
+            tmp_buf = lv_draw_sw_scratch_alloc(draw_unit, buf_stride * buf_h);
         }
         LV_ASSERT_MALLOC(tmp_buf);
 
@@ -458,7 +458,7 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
             }
         }
 
-        lv_free(tmp_buf);
+        lv_draw_sw_scratch_free(draw_unit, tmp_buf);
     }
 }
 
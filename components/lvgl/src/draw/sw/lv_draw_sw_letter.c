@@ -0,0 +1,295 @@
+/**
+ * @file lv_draw_sw_letter.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "blend/lv_draw_sw_blend_private.h"
+#include "../lv_draw_label_private.h"
+#include "lv_draw_sw_private.h"
+#include "lv_draw_sw.h"
+#if LV_USE_DRAW_SW
+
+#include "../../display/lv_display.h"
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_assert.h"
+#include "../../misc/lv_area_private.h"
+#include "../../misc/lv_style.h"
+#include "../../font/lv_font.h"
+#include "../../core/lv_refr_private.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Larger glyphs are blended one by one as the setup cost of blending is negligible for them*/
+#define GLYPH_RUN_MAX_LINE_HEIGHT   32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_DRAW_SW_GLYPH_RUN
+/**
+ * A8 coverage of the glyphs of a text line. The glyphs are copied next to each other
+ * and blended at once when the line, the color or the opacity changes,
+ * a glyph would overlap an earlier one, or something else needs to be drawn.
+ * As every pixel is blended only once with the same coverage the result is the same
+ * as blending the glyphs one by one.
+ */
+typedef struct lv_draw_sw_glyph_run_t {
+    uint8_t * buf;          /**< Coverage of `area`, `lv_area_get_width(&area)` bytes per row*/
+    lv_area_t area;         /**< The clip area's columns and the line's rows*/
+    int32_t line_height;    /**< Number of rows in `buf`*/
+    int32_t x1;             /**< First used column. The run is empty if `x1 > x2`*/
+    int32_t x2;             /**< Last used column*/
+    lv_color_t color;
+    lv_opa_t opa;
+} lv_draw_sw_glyph_run_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                                                       lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area);
+
+#if LV_DRAW_SW_GLYPH_RUN
+static void glyph_run_flush(lv_draw_unit_t * draw_unit, lv_draw_sw_glyph_run_t * run);
+static bool glyph_run_add(lv_draw_unit_t * draw_unit, lv_draw_sw_glyph_run_t * run,
+                          const lv_draw_glyph_dsc_t * glyph_draw_dsc);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_label(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords)
+{
+    if(dsc->opa <= LV_OPA_MIN) return;
+
+    LV_PROFILER_BEGIN;
+#if LV_DRAW_SW_GLYPH_RUN
+    lv_draw_sw_unit_t * u = lv_draw_sw_get_sw_unit(draw_unit);
+    int32_t line_height = lv_font_get_line_height(dsc->font);
+    if(u && line_height <= GLYPH_RUN_MAX_LINE_HEIGHT) {
+        /*The glyphs can be out of `coords` so use the columns of the clip area*/
+        lv_draw_sw_glyph_run_t run;
+        run.area.x1 = draw_unit->clip_area->x1;
+        run.area.x2 = draw_unit->clip_area->x2;
+        run.area.y1 = LV_COORD_MIN;
+        run.area.y2 = LV_COORD_MIN;
+        run.line_height = line_height;
+        run.x1 = 0;
+        run.x2 = -1;
+
+        uint32_t buf_size = lv_area_get_width(&run.area) * line_height;
+        run.buf = lv_draw_sw_scratch_alloc(draw_unit, buf_size);
+        if(run.buf) {
+            lv_memzero(run.buf, buf_size);
+            u->glyph_run = &run;
+            lv_draw_label_iterate_characters(draw_unit, dsc, coords, draw_letter_cb);
+            glyph_run_flush(draw_unit, &run);
+            u->glyph_run = NULL;
+            lv_draw_sw_scratch_free(draw_unit, run.buf);
+            LV_PROFILER_END;
+            return;
+        }
+    }
+#endif
+
+    lv_draw_label_iterate_characters(draw_unit, dsc, coords, draw_letter_cb);
+    LV_PROFILER_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                                                 lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area)
+{
+#if LV_DRAW_SW_GLYPH_RUN
+    lv_draw_sw_unit_t * u = lv_draw_sw_get_sw_unit(draw_unit);
+    lv_draw_sw_glyph_run_t * run = u ? u->glyph_run : NULL;
+    if(run) {
+        /*Add the glyph to the run if possible, else draw everything in order*/
+        if(glyph_draw_dsc && fill_draw_dsc == NULL && glyph_run_add(draw_unit, run, glyph_draw_dsc)) return;
+        glyph_run_flush(draw_unit, run);
+    }
+#endif
+
+    if(glyph_draw_dsc) {
+        switch(glyph_draw_dsc->format) {
+            case LV_FONT_GLYPH_FORMAT_NONE: {
+#if LV_USE_FONT_PLACEHOLDER
+                    /* Draw a placeholder rectangle*/
+                    lv_draw_border_dsc_t border_draw_dsc;
+                    lv_draw_border_dsc_init(&border_draw_dsc);
+                    border_draw_dsc.opa = glyph_draw_dsc->opa;
+                    border_draw_dsc.color = glyph_draw_dsc->color;
+                    border_draw_dsc.width = 1;
+                    lv_draw_sw_border(draw_unit, &border_draw_dsc, glyph_draw_dsc->bg_coords);
+#endif
+                }
+                break;
+            case LV_FONT_GLYPH_FORMAT_A1:
+            case LV_FONT_GLYPH_FORMAT_A2:
+            case LV_FONT_GLYPH_FORMAT_A4:
+            case LV_FONT_GLYPH_FORMAT_A8: {
+                    lv_area_t mask_area = *glyph_draw_dsc->letter_coords;
+                    mask_area.x2 = mask_area.x1 + lv_draw_buf_width_to_stride(lv_area_get_width(&mask_area), LV_COLOR_FORMAT_A8) - 1;
+                    lv_draw_sw_blend_dsc_t blend_dsc;
+                    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+                    blend_dsc.color = glyph_draw_dsc->color;
+                    blend_dsc.opa = glyph_draw_dsc->opa;
+                    lv_draw_buf_t * draw_buf = glyph_draw_dsc->glyph_data;
+                    blend_dsc.mask_buf = draw_buf->data;
+                    blend_dsc.mask_area = &mask_area;
+                    blend_dsc.mask_stride = draw_buf->header.stride;
+                    blend_dsc.blend_area = glyph_draw_dsc->letter_coords;
+                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+                    lv_draw_sw_blend(draw_unit, &blend_dsc);
+                }
+                break;
+            case LV_FONT_GLYPH_FORMAT_IMAGE: {
+#if LV_USE_IMGFONT
+                    lv_draw_image_dsc_t img_dsc;
+                    lv_draw_image_dsc_init(&img_dsc);
+                    img_dsc.rotation = 0;
+                    img_dsc.scale_x = LV_SCALE_NONE;
+                    img_dsc.scale_y = LV_SCALE_NONE;
+                    img_dsc.opa = glyph_draw_dsc->opa;
+                    img_dsc.src = glyph_draw_dsc->glyph_data;
+                    lv_draw_sw_image(draw_unit, &img_dsc, glyph_draw_dsc->letter_coords);
+#endif
+                }
+                break;
+            default:
+                break;
+        }
+
+    }
+
+    if(fill_draw_dsc && fill_area) {
+        lv_draw_sw_fill(draw_unit, fill_draw_dsc, fill_area);
+    }
+}
+
+#if LV_DRAW_SW_GLYPH_RUN
+
+static void glyph_run_flush(lv_draw_unit_t * draw_unit, lv_draw_sw_glyph_run_t * run)
+{
+    if(run->x1 > run->x2) return;
+
+    lv_area_t blend_area;
+    blend_area.x1 = run->x1;
+    blend_area.x2 = run->x2;
+    blend_area.y1 = run->area.y1;
+    blend_area.y2 = run->area.y2;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = run->color;
+    blend_dsc.opa = run->opa;
+    blend_dsc.mask_buf = run->buf;
+    blend_dsc.mask_area = &run->area;
+    blend_dsc.mask_stride = lv_area_get_width(&run->area);
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(draw_unit, &blend_dsc);
+
+    /*Clear only the used columns for the next glyphs*/
+    uint32_t stride = blend_dsc.mask_stride;
+    uint32_t used_w = run->x2 - run->x1 + 1;
+    uint8_t * row = run->buf + (run->x1 - run->area.x1);
+    int32_t y;
+    for(y = 0; y < run->line_height; y++) {
+        lv_memzero(row, used_w);
+        row += stride;
+    }
+
+    run->x1 = 0;
+    run->x2 = -1;
+}
+
+static bool glyph_run_add(lv_draw_unit_t * draw_unit, lv_draw_sw_glyph_run_t * run,
+                          const lv_draw_glyph_dsc_t * glyph_draw_dsc)
+{
+    switch(glyph_draw_dsc->format) {
+        case LV_FONT_GLYPH_FORMAT_A1:
+        case LV_FONT_GLYPH_FORMAT_A2:
+        case LV_FONT_GLYPH_FORMAT_A4:
+        case LV_FONT_GLYPH_FORMAT_A8:
+            break;
+        default:
+            return false;
+    }
+
+    /*Only the visible part of the glyph is stored*/
+    const lv_area_t * letter_coords = glyph_draw_dsc->letter_coords;
+    lv_area_t copy_area;
+    if(!lv_area_intersect(&copy_area, letter_coords, draw_unit->clip_area)) return true;
+
+    /*Start a new run in a new line*/
+    int32_t line_y1 = glyph_draw_dsc->bg_coords->y1;
+    if(line_y1 != run->area.y1) {
+        glyph_run_flush(draw_unit, run);
+        run->area.y1 = line_y1;
+        run->area.y2 = line_y1 + run->line_height - 1;
+    }
+
+    /*E.g. a glyph of a fallback font can be taller than the line*/
+    if(copy_area.y1 < run->area.y1 || copy_area.y2 > run->area.y2) return false;
+
+    /*The pixels of overlapping glyphs need to be blended twice*/
+    if(run->x1 <= run->x2 &&
+       (copy_area.x1 <= run->x2 || !lv_color_eq(glyph_draw_dsc->color, run->color) ||
+        glyph_draw_dsc->opa != run->opa)) {
+        glyph_run_flush(draw_unit, run);
+    }
+
+    if(run->x1 > run->x2) {
+        run->x1 = copy_area.x1;
+        run->color = glyph_draw_dsc->color;
+        run->opa = glyph_draw_dsc->opa;
+    }
+    run->x2 = copy_area.x2;
+
+    const lv_draw_buf_t * draw_buf = glyph_draw_dsc->glyph_data;
+    uint32_t src_stride = draw_buf->header.stride;
+    uint32_t dest_stride = lv_area_get_width(&run->area);
+    uint32_t copy_w = lv_area_get_width(&copy_area);
+    const uint8_t * src = draw_buf->data + (copy_area.y1 - letter_coords->y1) * src_stride +
+                          (copy_area.x1 - letter_coords->x1);
+    uint8_t * dest = run->buf + (copy_area.y1 - run->area.y1) * dest_stride + (copy_area.x1 - run->area.x1);
+    int32_t y;
+    for(y = copy_area.y1; y <= copy_area.y2; y++) {
+        lv_memcpy(dest, src, copy_w);
+        src += src_stride;
+        dest += dest_stride;
+    }
+
+    return true;
+}
+
+#endif /*LV_DRAW_SW_GLYPH_RUN*/
+
+#endif /*LV_USE_DRAW_SW*/
@@ -10,7 +10,7 @@
 #include "lv_draw_sw_mask_private.h"
 #include "blend/lv_draw_sw_blend_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 
 #if LV_USE_DRAW_SW
 
@@ -23,10 +23,29 @@
  *      DEFINES
  *********************/
 
+/*Longer segments or wider polylines are drawn line by line as their distances wouldn't fit into 32 bit*/
+#define POLYLINE_COORD_MAX  8000
+#define POLYLINE_WIDTH_MAX  1000
+
+/*Narrower segments are not worth limiting to the pixels around the line in each row*/
+#define POLYLINE_NARROW_LIMIT 8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*A segment of a polyline. The coordinates are in half pixels to address the pixel centers with integers.*/
+typedef struct {
+    int32_t ax;             /*Start point*/
+    int32_t ay;
+    int32_t ux;             /*Unit vector pointing to the end point in 1/65536 units*/
+    int32_t uy;
+    int32_t len;            /*Length in 1/65536 half pixels*/
+    lv_area_t area;         /*The pixels which might be covered*/
+    uint8_t round_start : 1;
+    uint8_t round_end   : 1;
+} polyline_seg_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -34,6 +53,10 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_skew(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_hor(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_ver(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
+static void draw_polyline_segments(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
+#if LV_DRAW_SW_COMPLEX
+static bool draw_polyline_analytic(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -99,9 +122,291 @@ void lv_draw_sw_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
     LV_PROFILER_END;
 }
 
+void lv_draw_sw_polyline(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
+{
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->points == NULL || dsc->point_cnt < 2) return;
+
+    LV_PROFILER_BEGIN;
+#if LV_DRAW_SW_COMPLEX
+    bool dashed = dsc->dash_gap && dsc->dash_width;
+    if(!dashed && draw_polyline_analytic(draw_unit, dsc)) {
+        LV_PROFILER_END;
+        return;
+    }
+#endif
+
+    draw_polyline_segments(draw_unit, dsc);
+    LV_PROFILER_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Draw the segments of a polyline one by one with `lv_draw_sw_line`.
+ * Used when the segments can't be drawn in one pass.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the polyline's descriptor
+ */
+static void draw_polyline_segments(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
+{
+    lv_draw_line_dsc_t line_dsc = *dsc;
+    uint32_t i;
+    for(i = 0; i < dsc->point_cnt - 1; i++) {
+        line_dsc.p1 = dsc->points[i];
+        line_dsc.p2 = dsc->points[i + 1];
+        line_dsc.round_start = i == 0 ? dsc->round_start : 0;
+        line_dsc.round_end = i == dsc->point_cnt - 2 ? dsc->round_end : 0;
+        lv_draw_sw_line(draw_unit, &line_dsc);
+    }
+}
+
+#if LV_DRAW_SW_COMPLEX
+
+/**
+ * Get the coverage of a pixel from its distance from an edge
+ * @param dist      distance from the edge in 1/65536 half pixels, positive outside
+ * @return          the coverage
+ */
+static inline int32_t get_edge_opa(int32_t dist)
+{
+    if(dist <= -65536) return LV_OPA_COVER;
+    if(dist >= 65536) return LV_OPA_TRANSP;
+    return ((65536 - dist) * 255) >> 17;
+}
+
+/**
+ * Get the coverage of a pixel around a rounded end of a segment
+ * @param dist      distance from the segment's line in 1/65536 half pixels
+ * @param t         distance from the end point along the line in 1/65536 half pixels
+ * @param hw        half of the line width in half pixels
+ * @return          the coverage
+ */
+static inline int32_t get_round_opa(int32_t dist, int32_t t, int32_t hw)
+{
+    /*Calculate in 1/16 half pixels to avoid overflow*/
+    int32_t d = dist >> 12;
+    t = t >> 12;
+    int32_t r = lv_sqrt32((uint32_t)(d * d + t * t));
+    return get_edge_opa((r - hw * 16) * 4096);
+}
+
+/**
+ * Get the area of the pixels which might be covered by a segment
+ * @param a         start point in half pixels
+ * @param b         end point in half pixels
+ * @param hw        half of the line width in half pixels
+ * @param area      store the result here
+ */
+static void get_segment_area(const lv_point_t * a, const lv_point_t * b, int32_t hw, lv_area_t * area)
+{
+    area->x1 = ((LV_MIN(a->x, b->x) - hw) >> 1) - 1;
+    area->x2 = ((LV_MAX(a->x, b->x) + hw) >> 1) + 1;
+    area->y1 = ((LV_MIN(a->y, b->y) - hw) >> 1) - 1;
+    area->y2 = ((LV_MAX(a->y, b->y) + hw) >> 1) + 1;
+}
+
+/**
+ * Get a point of a polyline in half pixels
+ * @param dsc       the polyline's descriptor
+ * @param i         index of the point
+ * @param p         store the result here
+ */
+static inline void get_polyline_point(const lv_draw_line_dsc_t * dsc, uint32_t i, lv_point_t * p)
+{
+    /*Odd wide lines are on the center of the pixels, even wide lines between two pixels as with the other lines*/
+    int32_t ofs = dsc->width & 1;
+    p->x = (int32_t)(dsc->points[i].x * 2) + ofs;
+    p->y = (int32_t)(dsc->points[i].y * 2) + ofs;
+}
+
+/**
+ * Add the coverage of a segment to a row of the mask. The greater coverage is kept
+ * so the joints are not blended twice.
+ * @param seg       the segment
+ * @param mask_buf  the coverages of the row starting at `x1`
+ * @param x1        the first pixel to calculate
+ * @param x2        the last pixel to calculate
+ * @param y         the row
+ * @param hw        half of the line width in half pixels
+ */
+static void add_segment_row(const polyline_seg_t * seg, lv_opa_t * mask_buf, int32_t x1, int32_t x2, int32_t y,
+                            int32_t hw)
+{
+    int32_t px = 2 * x1 + 1 - seg->ax;
+    int32_t py = 2 * y + 1 - seg->ay;
+    int32_t dist = -px * seg->uy + py * seg->ux;
+    int32_t t = px * seg->ux + py * seg->uy;
+    int32_t dist_step = -2 * seg->uy;
+    int32_t t_step = 2 * seg->ux;
+    int32_t hw_dist = hw << 16;
+
+    int32_t x;
+    for(x = x1; x <= x2; x++) {
+        int32_t opa;
+        if(t < 0 && seg->round_start) {
+            opa = get_round_opa(dist, t, hw);
+        }
+        else if(t > seg->len && seg->round_end) {
+            opa = get_round_opa(dist, t - seg->len, hw);
+        }
+        else {
+            opa = get_edge_opa(LV_ABS(dist) - hw_dist);
+            /*Flat ends half pixel after the end points to cover the end pixels*/
+            if(t < 0 && !seg->round_start) opa = LV_OPA_MIX2(opa, get_edge_opa(-t - 65536));
+            if(t > seg->len && !seg->round_end) opa = LV_OPA_MIX2(opa, get_edge_opa(t - seg->len - 65536));
+        }
+
+        lv_opa_t * mask_p = &mask_buf[x - x1];
+        if(opa > *mask_p) *mask_p = (lv_opa_t)opa;
+
+        dist += dist_step;
+        t += t_step;
+    }
+}
+
+/**
+ * Draw the segments of a polyline in one pass. The coverage of the pixels is calculated from
+ * their distance from the segments and the greatest one is used on each pixel.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the polyline's descriptor
+ * @return              false if the polyline is too large to be drawn this way
+ */
+static bool draw_polyline_analytic(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
+{
+    int32_t hw = dsc->width;
+    if(hw > POLYLINE_WIDTH_MAX) return false;
+
+    /*Count the visible segments and get their area*/
+    lv_area_t draw_area = {LV_COORD_MAX, LV_COORD_MAX, LV_COORD_MIN, LV_COORD_MIN};
+    uint32_t seg_cnt = 0;
+    lv_point_t a;
+    lv_point_t b;
+    lv_area_t seg_area;
+    uint32_t i;
+    get_polyline_point(dsc, 0, &b);
+    for(i = 0; i < dsc->point_cnt - 1; i++) {
+        a = b;
+        get_polyline_point(dsc, i + 1, &b);
+        if(LV_ABS(b.x - a.x) > POLYLINE_COORD_MAX || LV_ABS(b.y - a.y) > POLYLINE_COORD_MAX) return false;
+
+        get_segment_area(&a, &b, hw, &seg_area);
+        if(!lv_area_intersect(&seg_area, &seg_area, draw_unit->clip_area)) continue;
+
+        draw_area.x1 = LV_MIN(draw_area.x1, seg_area.x1);
+        draw_area.y1 = LV_MIN(draw_area.y1, seg_area.y1);
+        draw_area.x2 = LV_MAX(draw_area.x2, seg_area.x2);
+        draw_area.y2 = LV_MAX(draw_area.y2, seg_area.y2);
+        seg_cnt++;
+    }
+
+    if(seg_cnt == 0) return true;
+
+    polyline_seg_t * segs = lv_draw_sw_scratch_alloc(draw_unit, seg_cnt * sizeof(polyline_seg_t));
+    seg_cnt = 0;
+    get_polyline_point(dsc, 0, &b);
+    for(i = 0; i < dsc->point_cnt - 1; i++) {
+        a = b;
+        get_polyline_point(dsc, i + 1, &b);
+        get_segment_area(&a, &b, hw, &seg_area);
+        if(!lv_area_is_on(&seg_area, draw_unit->clip_area)) continue;
+
+        int32_t dx = b.x - a.x;
+        int32_t dy = b.y - a.y;
+        if(dx == 0 && dy == 0) continue;
+
+        /*Get the length with a few fractional bits*/
+        uint32_t len2 = (uint32_t)(dx * dx + dy * dy);
+        int32_t shift = 0;
+        while(shift < 8 && len2 < 0x10000000) {
+            len2 <<= 2;
+            shift++;
+        }
+        int32_t len = lv_sqrt32(len2);
+
+        polyline_seg_t * seg = &segs[seg_cnt];
+        seg->ax = a.x;
+        seg->ay = a.y;
+        int64_t scale = (int64_t)1 << (16 + shift);
+        seg->ux = (int32_t)(dx * scale / len);
+        seg->uy = (int32_t)(dy * scale / len);
+        seg->len = len << (16 - shift);
+        seg->area = seg_area;
+        /*The joints are rounded*/
+        seg->round_start = i == 0 ? dsc->round_start : 1;
+        seg->round_end = i == dsc->point_cnt - 2 ? dsc->round_end : 1;
+        seg_cnt++;
+    }
+
+    if(!lv_area_intersect(&draw_area, &draw_area, draw_unit->clip_area)) {
+        lv_draw_sw_scratch_free(draw_unit, segs);
+        return true;
+    }
+
+    int32_t draw_area_w = lv_area_get_width(&draw_area);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, draw_area_w);
+    lv_memzero(mask_buf, draw_area_w);
+
+    lv_area_t blend_area;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        int32_t row_x1 = LV_COORD_MAX;
+        int32_t row_x2 = LV_COORD_MIN;
+        for(i = 0; i < seg_cnt; i++) {
+            const polyline_seg_t * seg = &segs[i];
+            if(y < seg->area.y1 || y > seg->area.y2) continue;
+
+            int32_t x1 = LV_MAX(seg->area.x1, draw_area.x1);
+            int32_t x2 = LV_MIN(seg->area.x2, draw_area.x2);
+            if(x1 > x2) continue;
+
+            /*Limit wide rows to the pixels close to the line*/
+            if(x2 - x1 > POLYLINE_NARROW_LIMIT && seg->uy != 0) {
+                int64_t dist = (int64_t)(-(2 * x1 + 1 - seg->ax)) * seg->uy + (int64_t)(2 * y + 1 - seg->ay) * seg->ux;
+                int64_t lim = (int64_t)(hw + 2) * 65536;
+                int32_t xa = x1 + (int32_t)((dist - lim) / (2 * seg->uy));
+                int32_t xb = x1 + (int32_t)((dist + lim) / (2 * seg->uy));
+                x1 = LV_MAX(x1, LV_MIN(xa, xb) - 1);
+                x2 = LV_MIN(x2, LV_MAX(xa, xb) + 1);
+                if(x1 > x2) continue;
+            }
+
+            add_segment_row(seg, &mask_buf[x1 - draw_area.x1], x1, x2, y, hw);
+            row_x1 = LV_MIN(row_x1, x1);
+            row_x2 = LV_MAX(row_x2, x2);
+        }
+
+        if(row_x1 > row_x2) continue;
+
+        blend_area.x1 = row_x1;
+        blend_area.x2 = row_x2;
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        blend_dsc.mask_buf = &mask_buf[row_x1 - draw_area.x1];
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+
+        lv_memzero(&mask_buf[row_x1 - draw_area.x1], row_x2 - row_x1 + 1);
+    }
+
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
+    lv_draw_sw_scratch_free(draw_unit, segs);
+    return true;
+}
+
+#endif /*LV_DRAW_SW_COMPLEX*/
+
 static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
 {
     int32_t w = dsc->width - 1;
@@ -141,7 +446,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_unit_t * draw_unit, cons
 
         int32_t dash_start = blend_area.x1 % (dsc->dash_gap + dsc->dash_width);
 
-        lv_opa_t * mask_buf = lv_malloc(blend_area_w);
+        lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, blend_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -172,7 +477,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_unit_t * draw_unit, cons
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_sw_scratch_free(draw_unit, mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -214,7 +519,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_unit_t * draw_unit, cons
         int32_t y2 = blend_area.y2;
         blend_area.y2 = blend_area.y1;
 
-        lv_opa_t * mask_buf = lv_malloc(draw_area_w);
+        lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, draw_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -243,7 +548,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_unit_t * draw_unit, cons
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_sw_scratch_free(draw_unit, mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -345,7 +650,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_unit_t * draw_unit, con
     int32_t h;
     uint32_t hor_res = (uint32_t)lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
     size_t mask_buf_size = LV_MIN(lv_area_get_size(&blend_area), hor_res);
-    lv_opa_t * mask_buf = lv_malloc(mask_buf_size);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, mask_buf_size);
 
     int32_t y2 = blend_area.y2;
     blend_area.y2 = blend_area.y1;
@@ -390,7 +695,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_unit_t * draw_unit, con
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
 
-    lv_free(mask_buf);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
 
     lv_draw_sw_mask_free_param(&mask_left_param);
     lv_draw_sw_mask_free_param(&mask_right_param);
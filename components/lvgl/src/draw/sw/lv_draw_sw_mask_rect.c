@@ -16,7 +16,7 @@
 #include "../../misc/lv_log.h"
 #include "../../stdlib/lv_mem.h"
 #include "../../stdlib/lv_string.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 #include "lv_draw_sw_mask_private.h"
 
 /*********************
@@ -87,7 +87,7 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
     masks[0] = &param;
 
     uint32_t area_w = lv_area_get_width(&draw_area);
-    lv_opa_t * mask_buf = lv_malloc(area_w);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, area_w);
 
     int32_t y;
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
@@ -95,6 +95,22 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
         lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(masks, mask_buf, draw_area.x1, y, area_w);
         if(res == LV_DRAW_SW_MASK_RES_FULL_COVER) continue;
 
+        if(target_layer->color_format == LV_COLOR_FORMAT_RGB565A8) {
+            /*Only the separate alpha plane needs to be updated*/
+            lv_opa_t * alpha_buf = lv_draw_layer_go_to_xy_alpha(target_layer, draw_area.x1 - buf_area->x1,
+                                                                y - buf_area->y1);
+            if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                lv_memzero(alpha_buf, area_w);
+            }
+            else {
+                uint32_t i;
+                for(i = 0; i < area_w; i++) {
+                    if(mask_buf[i] != LV_OPA_COVER) alpha_buf[i] = LV_OPA_MIX2(alpha_buf[i], mask_buf[i]);
+                }
+            }
+            continue;
+        }
+
         lv_color32_t * c32_buf = lv_draw_layer_go_to_xy(target_layer, draw_area.x1 - buf_area->x1,
                                                         y - buf_area->y1);
 
@@ -111,7 +127,7 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
         }
     }
 
-    lv_free(mask_buf);
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
     lv_draw_sw_mask_free_param(&param);
 }
 
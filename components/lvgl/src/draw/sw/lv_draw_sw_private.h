@@ -0,0 +1,137 @@
+/**
+ * @file lv_draw_sw_private.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_PRIVATE_H
+#define LV_DRAW_SW_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_draw_sw.h"
+#include "../lv_draw_private.h"
+
+#if LV_USE_DRAW_SW
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Shrink the scratch memory only after this many refreshes in a row needed at most half of it*/
+#define LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct lv_draw_sw_unit_t {
+    lv_draw_unit_t base_unit;
+    lv_draw_task_t * task_act;
+#if LV_USE_OS
+    lv_thread_sync_t sync;
+    lv_thread_t thread;
+    volatile bool inited;
+    volatile bool exit_status;
+#endif
+    uint32_t idx;
+
+    /*Scratch memory for the temporary buffers (e.g. mask lines) of the draw tasks*/
+    uint8_t * scratch_buf;
+    uint32_t scratch_size;          /*Size of `scratch_buf` in bytes*/
+    uint32_t scratch_used;          /*Bytes used from `scratch_buf` by the current task*/
+    uint32_t scratch_required;      /*The most bytes needed by a task in the current refresh*/
+    uint32_t scratch_low_required;  /*The most bytes needed in the refreshes counted by `scratch_low_cnt`*/
+    uint32_t scratch_low_cnt;       /*Number of refreshes in a row which needed at most half of `scratch_size`*/
+
+#if LV_DRAW_SW_GLYPH_RUN
+    /*The glyphs of the current text line collected by the label drawer. NULL if not drawing a label.*/
+    struct lv_draw_sw_glyph_run_t * glyph_run;
+#endif
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get a temporary buffer for the current draw task from the scratch memory of a software draw unit.
+ * The buffers need to be released in the reverse order of the allocations.
+ * If `draw_unit` is not a software draw unit or the scratch memory is too small,
+ * `lv_malloc` is used and the scratch memory is enlarged before the next task.
+ * @param draw_unit     the draw unit which draws the current task
+ * @param size          size of the buffer in bytes
+ * @return              the buffer or NULL on error
+ */
+void * lv_draw_sw_scratch_alloc(lv_draw_unit_t * draw_unit, uint32_t size);
+
+/**
+ * Release a buffer allocated by `lv_draw_sw_scratch_alloc`
+ * @param draw_unit     the draw unit used for the allocation
+ * @param buf           the buffer to release
+ */
+void lv_draw_sw_scratch_free(lv_draw_unit_t * draw_unit, void * buf);
+
+/**
+ * Shrink the scratch memory of the software draw units if the last `LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT`
+ * refreshes needed at most half of it. It's shrunk to the most bytes needed by these refreshes or freed
+ * if they didn't use it at all. Called at the end of every refresh which rendered something so that
+ * a single large draw task (e.g. a wide shadow) doesn't keep its memory for good, but frames with
+ * varying needs don't free and allocate it again and again.
+ * The draw units need to be idle.
+ */
+void lv_draw_sw_scratch_shrink(void);
+
+/**
+ * Get a draw unit as a software draw unit
+ * @param draw_unit     pointer to a draw unit
+ * @return              the software draw unit or NULL if `draw_unit` is an other kind of draw unit
+ */
+lv_draw_sw_unit_t * lv_draw_sw_get_sw_unit(lv_draw_unit_t * draw_unit);
+
+/**
+ * Copy the pixels of an area between a layer which stores its pixels rotated by `layer->rotation`
+ * (see `lv_display_set_rotated_rendering()`) and a not rotated buffer with the layer's color format
+ * @param layer         pointer to a layer with rotated buffer
+ * @param area          the area to copy with absolute coordinates, needs to be on the layer's buffer area
+ * @param buf           the not rotated buffer which has the size of `area`
+ * @param stride        stride of `buf` in bytes
+ * @param to_layer      true: copy from `buf` to the layer; false: copy from the layer to `buf`
+ */
+void lv_draw_sw_rotated_layer_copy(lv_layer_t * layer, const lv_area_t * area, void * buf, int32_t stride,
+                                   bool to_layer);
+
+#if LV_DRAW_SW_COMPLEX
+
+/**
+ * Create the cache of the blurred shadow corners
+ */
+void lv_draw_sw_box_shadow_cache_init(void);
+
+/**
+ * Free the cache of the blurred shadow corners
+ */
+void lv_draw_sw_box_shadow_cache_deinit(void);
+
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_PRIVATE_H*/
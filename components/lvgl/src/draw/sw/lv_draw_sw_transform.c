@@ -51,6 +51,28 @@ typedef struct {
 static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
                                      int32_t * yout);
 
+/**
+ * Transform a line without interpolation, copying the source pixel the center of a destination pixel falls on.
+ * The source coordinates are stepped with 1/65536 precision.
+ * @param src       pointer to the source image
+ * @param src_w     width of the source image
+ * @param src_h     height of the source image
+ * @param src_stride    stride of the source image in bytes
+ * @param xs_ups    X coordinate of the first pixel on the source image (upscaled by 256)
+ * @param ys_ups    Y coordinate of the first pixel on the source image (upscaled by 256)
+ * @param xs_step   X step per pixel on the source image (upscaled by 65536)
+ * @param ys_step   Y step per pixel on the source image (upscaled by 65536)
+ * @param x_end     number of pixels to transform
+ * @param dest_buf  the destination line
+ * @param abuf      the destination alpha line for RGB565 and RGB565A8 images
+ * @param src_cf    color format of the source image
+ * @param recolor   true: transform L8 images to ARGB8888 instead of AL88
+ */
+static void transform_nearest(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                              int32_t x_end, uint8_t * dest_buf, uint8_t * abuf, lv_color_format_t src_cf,
+                              bool recolor);
+
 #if LV_DRAW_SW_SUPPORT_RGB888
 static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
@@ -124,6 +146,14 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
     tr_dsc.cosma = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
     tr_dsc.sinma = tr_dsc.sinma >> (LV_TRIGO_SHIFT - 10);
     tr_dsc.cosma = tr_dsc.cosma >> (LV_TRIGO_SHIFT - 10);
+
+    /*`lv_trigo_sin(90)` is 32767, so set the right angles exactly to keep the pixels aligned to the source pixels*/
+    if(tr_dsc.angle % 900 == 0) {
+        static const int32_t right_angle_sin[4] = {0, 1024, 0, -1024};
+        int32_t quarter = ((tr_dsc.angle / 900) % 4 + 4) % 4;
+        tr_dsc.sinma = right_angle_sin[quarter];
+        tr_dsc.cosma = right_angle_sin[(quarter + 1) % 4];
+    }
     tr_dsc.pivot_x_256 = tr_dsc.pivot.x * 256;
     tr_dsc.pivot_y_256 = tr_dsc.pivot.y * 256;
 
@@ -157,6 +187,13 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
     bool aa = (bool) draw_dsc->antialias;
     bool is_rotated = draw_dsc->rotation;
 
+    /*Right angle rotations map the pixels 1:1 and integer upscales 1:N, so without
+     *anti-aliasing (which smooths the upscaled pixels) no interpolation is needed*/
+    bool scale_none = draw_dsc->scale_x == LV_SCALE_NONE && draw_dsc->scale_y == LV_SCALE_NONE;
+    bool scale_int = draw_dsc->scale_x > 0 && draw_dsc->scale_x % LV_SCALE_NONE == 0 &&
+                     draw_dsc->scale_y > 0 && draw_dsc->scale_y % LV_SCALE_NONE == 0;
+    bool nearest = draw_dsc->rotation % 900 == 0 && (scale_none || (scale_int && !aa));
+
     int32_t xs_ups = 0, ys_ups = 0, ys_ups_start = 0, ys_step_256_original = 0;
     int32_t xs_step_256 = 0, ys_step_256 = 0;
 
@@ -231,54 +268,60 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
             ys_ups = ys1_ups + 0x80;
         }
 
-        switch(src_cf) {
+        if(nearest) {
+            transform_nearest(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
+                              alpha_buf, src_cf, draw_dsc->recolor_opa >= LV_OPA_MIN);
+        }
+        else {
+            switch(src_cf) {
 #if LV_DRAW_SW_SUPPORT_XRGB8888
-            case LV_COLOR_FORMAT_XRGB8888:
-                transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
-                                 4);
-                break;
+                case LV_COLOR_FORMAT_XRGB8888:
+                    transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
+                                     4);
+                    break;
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB888
-            case LV_COLOR_FORMAT_RGB888:
-                transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
-                                 3);
-                break;
+                case LV_COLOR_FORMAT_RGB888:
+                    transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
+                                     3);
+                    break;
 #endif
 #if LV_DRAW_SW_SUPPORT_A8
-            case LV_COLOR_FORMAT_A8:
-                transform_a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa);
-                break;
+                case LV_COLOR_FORMAT_A8:
+                    transform_a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa);
+                    break;
 #endif
 #if LV_DRAW_SW_SUPPORT_ARGB8888
-            case LV_COLOR_FORMAT_ARGB8888:
-                transform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
-                                   aa);
-                break;
+                case LV_COLOR_FORMAT_ARGB8888:
+                    transform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
+                                       aa);
+                    break;
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_SUPPORT_RGB565A8
-            case LV_COLOR_FORMAT_RGB565:
-                transform_rgb565a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
-                                   alpha_buf, false, aa);
-                break;
+                case LV_COLOR_FORMAT_RGB565:
+                    transform_rgb565a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
+                                       alpha_buf, false, aa);
+                    break;
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB565A8
-            case LV_COLOR_FORMAT_RGB565A8:
-                transform_rgb565a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w,
-                                   (uint16_t *)dest_buf,
-                                   alpha_buf, true, aa);
-                break;
+                case LV_COLOR_FORMAT_RGB565A8:
+                    transform_rgb565a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w,
+                                       (uint16_t *)dest_buf,
+                                       alpha_buf, true, aa);
+                    break;
 #endif
 #if LV_DRAW_SW_SUPPORT_L8
-            case LV_COLOR_FORMAT_L8:
-                if(draw_dsc->recolor_opa >= LV_OPA_MIN)
-                    transform_l8_to_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
-                                             aa);
-                else
-                    transform_l8_to_al88(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa);
-                break;
+                case LV_COLOR_FORMAT_L8:
+                    if(draw_dsc->recolor_opa >= LV_OPA_MIN)
+                        transform_l8_to_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
+                                                 aa);
+                    else
+                        transform_l8_to_al88(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa);
+                    break;
 #endif
-            default:
-                break;
+                default:
+                    break;
+            }
         }
 
         dest_buf = (uint8_t *)dest_buf + dest_stride;
@@ -290,20 +333,125 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
  *   STATIC FUNCTIONS
  **********************/
 
+static void transform_nearest(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                              int32_t x_end, uint8_t * dest_buf, uint8_t * abuf, lv_color_format_t src_cf,
+                              bool recolor)
+{
+    int32_t xs_acc = xs_ups * 256;
+    int32_t ys_acc = ys_ups * 256;
+
+    int32_t x;
+    switch(src_cf) {
+#if LV_DRAW_SW_SUPPORT_RGB888 || LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_RGB888: {
+                uint32_t px_size = lv_color_format_get_size(src_cf);
+                lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
+                for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+                    int32_t xs_int = xs_acc >> 16;
+                    int32_t ys_int = ys_acc >> 16;
+                    if(xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h) {
+                        dest_c32[x].alpha = 0x00;
+                        continue;
+                    }
+                    const uint8_t * src_u8 = &src[ys_int * src_stride + xs_int * px_size];
+                    dest_c32[x].red = src_u8[2];
+                    dest_c32[x].green = src_u8[1];
+                    dest_c32[x].blue = src_u8[0];
+                    dest_c32[x].alpha = 0xff;
+                }
+                break;
+            }
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888: {
+                uint32_t * dest_u32 = (uint32_t *)dest_buf;
+                for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+                    int32_t xs_int = xs_acc >> 16;
+                    int32_t ys_int = ys_acc >> 16;
+                    if(xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h) {
+                        dest_u32[x] = 0x00000000;
+                        continue;
+                    }
+                    dest_u32[x] = *(const uint32_t *)(src + ys_int * src_stride + xs_int * 4);
+                }
+                break;
+            }
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB565A8
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8: {
+                uint16_t * cbuf = (uint16_t *)dest_buf;
+                const lv_opa_t * src_alpha = src_cf == LV_COLOR_FORMAT_RGB565A8 ? src + src_stride * src_h : NULL;
+                int32_t alpha_stride = src_stride / 2;
+                for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+                    int32_t xs_int = xs_acc >> 16;
+                    int32_t ys_int = ys_acc >> 16;
+                    if(xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h) {
+                        abuf[x] = 0x00;
+                        continue;
+                    }
+                    cbuf[x] = *(const uint16_t *)(src + ys_int * src_stride + xs_int * 2);
+                    abuf[x] = src_alpha ? src_alpha[ys_int * alpha_stride + xs_int] : 0xff;
+                }
+                break;
+            }
+#endif
+#if LV_DRAW_SW_SUPPORT_A8
+        case LV_COLOR_FORMAT_A8:
+            for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+                int32_t xs_int = xs_acc >> 16;
+                int32_t ys_int = ys_acc >> 16;
+                if(xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h) {
+                    dest_buf[x] = 0x00;
+                    continue;
+                }
+                dest_buf[x] = src[ys_int * src_stride + xs_int];
+            }
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+            /*Into ARGB8888 if it will be recolored, else into AL88*/
+            for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+                int32_t xs_int = xs_acc >> 16;
+                int32_t ys_int = ys_acc >> 16;
+                bool out = xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h;
+                uint8_t lumi = out ? 0x00 : src[ys_int * src_stride + xs_int];
+                uint8_t alpha = out ? 0x00 : 0xff;
+                if(recolor) {
+                    lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
+                    dest_c32[x].red = dest_c32[x].green = dest_c32[x].blue = lumi;
+                    dest_c32[x].alpha = alpha;
+                }
+                else {
+                    lv_color16a_t * dest_al88 = (lv_color16a_t *)dest_buf;
+                    dest_al88[x].lumi = lumi;
+                    dest_al88[x].alpha = alpha;
+                }
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
 #if LV_DRAW_SW_SUPPORT_RGB888
 
 static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                              int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size)
 {
-    int32_t xs_ups_start = xs_ups;
-    int32_t ys_ups_start = ys_ups;
+    int32_t xs_acc = xs_ups * 256;
+    int32_t ys_acc = ys_ups * 256;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_acc >> 8;
+        ys_ups = ys_acc >> 8;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -396,14 +544,14 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                int32_t x_end, uint8_t * dest_buf, bool aa)
 {
-    int32_t xs_ups_start = xs_ups;
-    int32_t ys_ups_start = ys_ups;
+    int32_t xs_acc = xs_ups * 256;
+    int32_t ys_acc = ys_ups * 256;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_acc >> 8;
+        ys_ups = ys_acc >> 8;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -489,8 +637,8 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa)
 {
-    int32_t xs_ups_start = xs_ups;
-    int32_t ys_ups_start = ys_ups;
+    int32_t xs_acc = xs_ups * 256;
+    int32_t ys_acc = ys_ups * 256;
 
     const lv_opa_t * src_alpha = src + src_stride * src_h;
 
@@ -498,9 +646,9 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
     int32_t alpha_stride = src_stride / 2; /*alpha map stride is always half of RGB map stride*/
 
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_acc >> 8;
+        ys_ups = ys_acc >> 8;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -604,13 +752,13 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                          int32_t x_end, uint8_t * abuf, bool aa)
 {
-    int32_t xs_ups_start = xs_ups;
-    int32_t ys_ups_start = ys_ups;
+    int32_t xs_acc = xs_ups * 256;
+    int32_t ys_acc = ys_ups * 256;
 
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_acc >> 8;
+        ys_ups = ys_acc >> 8;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -685,14 +833,14 @@ static void transform_l8_to_al88(const uint8_t * src, int32_t src_w, int32_t src
                                  int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                  int32_t x_end, uint8_t * dest_buf, bool aa)
 {
-    int32_t xs_ups_start = xs_ups;
-    int32_t ys_ups_start = ys_ups;
+    int32_t xs_acc = xs_ups * 256;
+    int32_t ys_acc = ys_ups * 256;
     lv_color16a_t * dest_al88 = (lv_color16a_t *)dest_buf;
 
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_acc >> 8;
+        ys_ups = ys_acc >> 8;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -766,14 +914,14 @@ static void transform_l8_to_argb8888(const uint8_t * src, int32_t src_w, int32_t
                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                      int32_t x_end, uint8_t * dest_buf, bool aa)
 {
-    int32_t xs_ups_start = xs_ups;
-    int32_t ys_ups_start = ys_ups;
+    int32_t xs_acc = xs_ups * 256;
+    int32_t ys_acc = ys_ups * 256;
     lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
 
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_acc >> 8;
+        ys_ups = ys_acc >> 8;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
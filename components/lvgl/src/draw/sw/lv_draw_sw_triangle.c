@@ -0,0 +1,306 @@
+/**
+ * @file lv_draw_sw_triangle.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_mask_private.h"
+#include "blend/lv_draw_sw_blend_private.h"
+#include "../lv_draw_private.h"
+#include "lv_draw_sw_private.h"
+#if LV_USE_DRAW_SW
+
+#include "../../misc/lv_math.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../misc/lv_area_private.h"
+#include "../../misc/lv_color.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_draw_triangle_private.h"
+#include "lv_draw_sw_gradient_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define POLYGON_POINT_MAX   8
+
+/*Coverage of a pixel by an edge in 1/65536 units*/
+#define COVER_FULL          65536
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    int32_t ax;     /**< Start point of the edge*/
+    int32_t ay;
+    int32_t nx;     /**< Unit normal pointing inside in 1/65536 units*/
+    int32_t ny;
+} polygon_edge_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_DRAW_SW_COMPLEX
+static void fill_convex_polygon(lv_draw_unit_t * draw_unit, const lv_point_t * points, uint32_t point_cnt,
+                                const lv_area_t * coords, lv_color_t color, lv_opa_t opa, const lv_grad_dsc_t * grad_dsc);
+static bool init_edges(polygon_edge_t * edges, const lv_point_t * points, uint32_t point_cnt);
+static inline int32_t get_row_start_cover(const polygon_edge_t * edge, int32_t x, int32_t y, int32_t limit);
+static inline lv_opa_t cover_to_opa(int32_t cover);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_t * dsc)
+{
+#if LV_DRAW_SW_COMPLEX
+    lv_area_t tri_area;
+    tri_area.x1 = (int32_t)LV_MIN3(dsc->p[0].x, dsc->p[1].x, dsc->p[2].x);
+    tri_area.y1 = (int32_t)LV_MIN3(dsc->p[0].y, dsc->p[1].y, dsc->p[2].y);
+    tri_area.x2 = (int32_t)LV_MAX3(dsc->p[0].x, dsc->p[1].x, dsc->p[2].x);
+    tri_area.y2 = (int32_t)LV_MAX3(dsc->p[0].y, dsc->p[1].y, dsc->p[2].y);
+
+    lv_point_t p[3];
+    p[0] = lv_point_from_precise(&dsc->p[0]);
+    p[1] = lv_point_from_precise(&dsc->p[1]);
+    p[2] = lv_point_from_precise(&dsc->p[2]);
+
+    fill_convex_polygon(draw_unit, p, 3, &tri_area, dsc->bg_color, dsc->bg_opa, &dsc->bg_grad);
+#else
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(dsc);
+    LV_LOG_WARN("Can't draw triangles with LV_DRAW_SW_COMPLEX == 0");
+#endif /*LV_DRAW_SW_COMPLEX*/
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_SW_COMPLEX
+
+/**
+ * Fill a convex polygon row by row without masks.
+ * The points are the corners of the pixels, i.e. the center of the pixel (x;y) is (x + 0.5;y + 0.5).
+ * The coverage of a pixel is estimated by each edge from the distance of its center
+ * and they are multiplied like the masks were. As the span of each row where all edges fully
+ * cover the pixels is known, the mask is calculated only for the few pixels around the edges.
+ * @param draw_unit     pointer to a draw unit
+ * @param points        the vertices of the polygon in clockwise or counter-clockwise order
+ * @param point_cnt     number of points (max. `POLYGON_POINT_MAX`)
+ * @param coords        bounding box of the points, used as the area of the gradient
+ * @param color         the color of the polygon if there is no gradient
+ * @param opa           opacity of the polygon
+ * @param grad_dsc      gradient descriptor
+ */
+static void fill_convex_polygon(lv_draw_unit_t * draw_unit, const lv_point_t * points, uint32_t point_cnt,
+                                const lv_area_t * coords, lv_color_t color, lv_opa_t opa, const lv_grad_dsc_t * grad_dsc)
+{
+    LV_ASSERT(point_cnt <= POLYGON_POINT_MAX);
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, coords, draw_unit->clip_area)) return;
+
+    polygon_edge_t edges[POLYGON_POINT_MAX];
+    if(!init_edges(edges, points, point_cnt)) return;
+
+    int32_t area_w = lv_area_get_width(&draw_area);
+    lv_opa_t * mask_buf = lv_draw_sw_scratch_alloc(draw_unit, area_w);
+
+    lv_area_t row_area = draw_area;
+    lv_area_t blend_area;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = color;
+    blend_dsc.opa = opa;
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &row_area;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    lv_grad_t * grad = lv_gradient_get(grad_dsc, lv_area_get_width(coords), lv_area_get_height(coords));
+    lv_grad_dir_t grad_dir = grad ? grad_dsc->dir : LV_GRAD_DIR_NONE;
+    lv_opa_t * grad_opa_map = NULL;
+    if(grad_dir == LV_GRAD_DIR_HOR) {
+        blend_dsc.src_area = &row_area;
+        blend_dsc.src_buf = grad->color_map + draw_area.x1 - coords->x1;
+        blend_dsc.src_color_format = LV_COLOR_FORMAT_RGB888;
+        grad_opa_map = grad->opa_map + draw_area.x1 - coords->x1;
+    }
+
+    /*The coverage can't change more than COVER_FULL per pixel, so larger values needn't be tracked*/
+    int32_t limit = (int32_t)LV_MIN(((int64_t)area_w + 2) * COVER_FULL, 0x40000000);
+
+    int32_t cover[POLYGON_POINT_MAX];
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        /*Get where the pixels are partially and fully covered by all edges.
+         *The columns are relative to draw_area.x1*/
+        int32_t cover_x1 = 0;
+        int32_t cover_x2 = area_w - 1;
+        int32_t full_x1 = 0;
+        int32_t full_x2 = area_w - 1;
+        int32_t row_cover = COVER_FULL;
+        uint32_t i;
+        for(i = 0; i < point_cnt; i++) {
+            int32_t c = get_row_start_cover(&edges[i], draw_area.x1, y, limit);
+            int32_t step = edges[i].nx;
+            cover[i] = c;
+            if(step == 0) {
+                row_cover = LV_MIN(row_cover, c);
+            }
+            else if(step > 0) {
+                cover_x1 = LV_MAX(cover_x1, c > 0 ? 0 : -c / step + 1);
+                full_x1 = LV_MAX(full_x1, c >= COVER_FULL ? 0 : (COVER_FULL - c + step - 1) / step);
+            }
+            else {
+                cover_x2 = LV_MIN(cover_x2, c > 0 ? (c - 1) / -step : -1);
+                full_x2 = LV_MIN(full_x2, c >= COVER_FULL ? (c - COVER_FULL) / -step : -1);
+            }
+        }
+
+        if(row_cover <= 0 || cover_x1 > cover_x2) continue;
+
+        row_area.y1 = y;
+        row_area.y2 = y;
+
+        blend_dsc.opa = opa;
+        if(grad_dir == LV_GRAD_DIR_VER) {
+            blend_dsc.color = grad->color_map[y - coords->y1];
+            blend_dsc.opa = grad->opa_map[y - coords->y1];
+            if(opa < LV_OPA_MAX) blend_dsc.opa = LV_OPA_MIX2(blend_dsc.opa, opa);
+        }
+        /*Horizontal edges change the opacity of the whole row*/
+        if(row_cover < COVER_FULL) blend_dsc.opa = LV_OPA_MIX2(blend_dsc.opa, cover_to_opa(row_cover));
+
+        /*Calculate the mask only where it's partially covered*/
+        bool has_full = full_x1 <= full_x2;
+        int32_t x;
+        for(x = cover_x1; x <= cover_x2; x++) {
+            if(has_full && x == full_x1) {
+                x = full_x2;
+                continue;
+            }
+
+            lv_opa_t mask = LV_OPA_COVER;
+            for(i = 0; i < point_cnt && mask > LV_OPA_TRANSP; i++) {
+                int32_t edge_c = cover[i] + edges[i].nx * x;
+                if(edge_c < COVER_FULL) mask = LV_OPA_MIX2(mask, cover_to_opa(edge_c));
+            }
+            mask_buf[x] = mask;
+            if(grad_opa_map && grad_opa_map[x] < LV_OPA_MAX) mask_buf[x] = LV_OPA_MIX2(mask_buf[x], grad_opa_map[x]);
+        }
+
+        /*The inner part needs only the opacity of the gradient.
+         *Blending the row at once is faster than blending the spans separately because
+         *the blend function finds the fully covered part without calling the kernels several times.*/
+        if(has_full) {
+            if(grad_opa_map) lv_memcpy(mask_buf + full_x1, grad_opa_map + full_x1, full_x2 - full_x1 + 1);
+            else lv_memset(mask_buf + full_x1, 0xff, full_x2 - full_x1 + 1);
+        }
+
+        blend_area.x1 = draw_area.x1 + cover_x1;
+        blend_area.x2 = draw_area.x1 + cover_x2;
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+    }
+
+    lv_draw_sw_scratch_free(draw_unit, mask_buf);
+    if(grad) lv_gradient_cleanup(grad);
+}
+
+static bool init_edges(polygon_edge_t * edges, const lv_point_t * points, uint32_t point_cnt)
+{
+    /*The sign of the area tells the direction of the points*/
+    int64_t area = 0;
+    uint32_t i;
+    for(i = 0; i < point_cnt; i++) {
+        const lv_point_t * a = &points[i];
+        const lv_point_t * b = &points[(i + 1) % point_cnt];
+        area += (int64_t)a->x * b->y - (int64_t)b->x * a->y;
+    }
+    if(area == 0) return false;
+
+    for(i = 0; i < point_cnt; i++) {
+        const lv_point_t * a = &points[i];
+        const lv_point_t * b = &points[(i + 1) % point_cnt];
+        int64_t dx = (int64_t)b->x - a->x;
+        int64_t dy = (int64_t)b->y - a->y;
+
+        edges[i].ax = a->x;
+        edges[i].ay = a->y;
+
+        /*Repeated points have no edge. Make it cover everything.*/
+        if(dx == 0 && dy == 0) {
+            edges[i].nx = 0;
+            edges[i].ny = 0;
+            continue;
+        }
+
+        /*Get the length with a few fractional bits*/
+        int64_t len2 = dx * dx + dy * dy;
+        int32_t shift = 0;
+        while(len2 >= 0x40000000) {
+            len2 >>= 2;
+            shift--;
+        }
+        while(shift < 8 && len2 < 0x10000000) {
+            len2 <<= 2;
+            shift++;
+        }
+        int64_t len = lv_sqrt32((uint32_t)len2);
+        int64_t scale = COVER_FULL;
+        if(shift >= 0) scale *= (int64_t)1 << shift;
+        else len *= (int64_t)1 << -shift;
+
+        if(area < 0) scale = -scale;
+        edges[i].nx = (int32_t)(-dy * scale / len);
+        edges[i].ny = (int32_t)(dx * scale / len);
+    }
+
+    return true;
+}
+
+/**
+ * Get the coverage of the pixel (x;y) by an edge
+ * @param edge      pointer to an edge
+ * @param x         x coordinate of the pixel
+ * @param y         y coordinate of the pixel
+ * @param limit     clamp the result to [-limit;limit]
+ * @return          the coverage in 1/65536 units, it's negative outside and larger than COVER_FULL inside
+ */
+static inline int32_t get_row_start_cover(const polygon_edge_t * edge, int32_t x, int32_t y, int32_t limit)
+{
+    if(edge->nx == 0 && edge->ny == 0) return limit;
+
+    /*Use the center of the pixel*/
+    int64_t dist2 = (int64_t)edge->nx * (2 * (int64_t)x + 1 - 2 * (int64_t)edge->ax) +
+                    (int64_t)edge->ny * (2 * (int64_t)y + 1 - 2 * (int64_t)edge->ay);
+    int64_t c = dist2 / 2 + COVER_FULL / 2;
+    if(c > limit) return limit;
+    if(c < -limit) return -limit;
+    return (int32_t)c;
+}
+
+static inline lv_opa_t cover_to_opa(int32_t cover)
+{
+    if(cover <= 0) return LV_OPA_TRANSP;
+    if(cover >= COVER_FULL) return LV_OPA_COVER;
+    return (lv_opa_t)((cover * 255) >> 16);
+}
+
+#endif /*LV_DRAW_SW_COMPLEX*/
+
+#endif /*LV_USE_DRAW_SW*/
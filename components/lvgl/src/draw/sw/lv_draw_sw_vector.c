@@ -40,6 +40,12 @@ typedef struct {
     uint8_t a;
 } _tvg_color;
 
+typedef struct {
+    Tvg_Canvas * canvas;
+    int32_t ofs_x;      /*The paths are in the layer's coordinates, translate them by this to the buffer*/
+    int32_t ofs_y;
+} _tvg_draw_ctx;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -367,13 +373,16 @@ static void _set_paint_blend_mode(Tvg_Paint * obj, lv_vector_blend_t blend)
 
 static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc)
 {
-    Tvg_Canvas * canvas = (Tvg_Canvas *)ctx;
+    _tvg_draw_ctx * draw_ctx = (_tvg_draw_ctx *)ctx;
+    Tvg_Canvas * canvas = draw_ctx->canvas;
 
     Tvg_Paint * obj = tvg_shape_new();
 
     if(!path) {  /*clear*/
+        lv_area_t scissor_area = dsc->scissor_area;
+        lv_area_move(&scissor_area, draw_ctx->ofs_x, draw_ctx->ofs_y);
         _tvg_rect rc;
-        lv_area_to_tvg(&rc, &dsc->scissor_area);
+        lv_area_to_tvg(&rc, &scissor_area);
 
         _tvg_color c;
         lv_color_to_tvg(&c, &dsc->fill_dsc.color, dsc->fill_dsc.opa);
@@ -388,13 +397,18 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
         tvg_shape_set_fill_color(obj, c.r, c.g, c.b, c.a);
     }
     else {
+        lv_matrix_t matrix;
+        lv_matrix_identity(&matrix);
+        lv_matrix_translate(&matrix, (float)draw_ctx->ofs_x, (float)draw_ctx->ofs_y);
+        lv_matrix_multiply(&matrix, &dsc->matrix);
+
         Tvg_Matrix mtx;
-        lv_matrix_to_tvg(&mtx, &dsc->matrix);
+        lv_matrix_to_tvg(&mtx, &matrix);
         _set_paint_matrix(obj, &mtx);
 
         _set_paint_shape(obj, path);
 
-        _set_paint_fill(obj, canvas, &dsc->fill_dsc, &dsc->matrix);
+        _set_paint_fill(obj, canvas, &dsc->fill_dsc, &matrix);
         _set_paint_stroke(obj, &dsc->stroke_dsc);
         _set_paint_blend_mode(obj, dsc->blend_mode);
     }
@@ -407,12 +421,11 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
  **********************/
 void lv_draw_sw_vector(lv_draw_unit_t * draw_unit, const lv_draw_vector_task_dsc_t * dsc)
 {
-    LV_UNUSED(draw_unit);
-
     if(dsc->task_list == NULL)
         return;
 
-    lv_layer_t * layer = dsc->base.layer;
+    /*Not `dsc->base.layer` as rotated layers are drawn via a temporary layer*/
+    lv_layer_t * layer = draw_unit->target_layer;
     lv_draw_buf_t * draw_buf = layer->draw_buf;
     if(draw_buf == NULL)
         return;
@@ -432,12 +445,19 @@ void lv_draw_sw_vector(lv_draw_unit_t * draw_unit, const lv_draw_vector_task_dsc
     Tvg_Canvas * canvas = tvg_swcanvas_create();
     tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
 
+    _tvg_draw_ctx draw_ctx;
+    draw_ctx.canvas = canvas;
+    draw_ctx.ofs_x = -layer->buf_area.x1;
+    draw_ctx.ofs_y = -layer->buf_area.y1;
+
+    lv_area_t clip_area = *draw_unit->clip_area;
+    lv_area_move(&clip_area, draw_ctx.ofs_x, draw_ctx.ofs_y);
     _tvg_rect rc;
-    lv_area_to_tvg(&rc, draw_unit->clip_area);
+    lv_area_to_tvg(&rc, &clip_area);
     tvg_canvas_set_viewport(canvas, (int32_t)rc.x, (int32_t)rc.y, (int32_t)rc.w, (int32_t)rc.h);
 
     lv_ll_t * task_list = dsc->task_list;
-    lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, canvas);
+    lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &draw_ctx);
 
     if(tvg_canvas_draw(canvas) == TVG_RESULT_SUCCESS) {
         tvg_canvas_sync(canvas);
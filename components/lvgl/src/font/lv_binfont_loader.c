@@ -0,0 +1,1375 @@
+/**
+ * @file lv_binfont_loader.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_fmt_txt_private.h"
+#include "../lvgl.h"
+#include "../misc/lv_fs_private.h"
+#include "../misc/lv_types.h"
+#include "../stdlib/lv_string.h"
+#include "lv_binfont_loader.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Number of pages read after a missing page of a streamed font, as the neighbouring glyph ids are often used together*/
+#define STREAM_READ_AHEAD_PAGE_CNT  1
+
+/*Size of the longest glyph header which can be read from a streamed font*/
+#define STREAM_GLYPH_HEADER_MAX_SIZE    8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_fs_file_t * fp;
+    int8_t bit_pos;
+    uint8_t byte_value;
+} bit_iterator_t;
+
+typedef struct font_header_bin {
+    uint32_t version;
+    uint16_t tables_count;
+    uint16_t font_size;
+    uint16_t ascent;
+    int16_t descent;
+    uint16_t typo_ascent;
+    int16_t typo_descent;
+    uint16_t typo_line_gap;
+    int16_t min_y;
+    int16_t max_y;
+    uint16_t default_advance_width;
+    uint16_t kerning_scale;
+    uint8_t index_to_loc_format;
+    uint8_t glyph_id_format;
+    uint8_t advance_width_format;
+    uint8_t bits_per_pixel;
+    uint8_t xy_bits;
+    uint8_t wh_bits;
+    uint8_t advance_width_bits;
+    uint8_t compression_id;
+    uint8_t subpixels_mode;
+    uint8_t padding;
+    int16_t underline_position;
+    uint16_t underline_thickness;
+} font_header_bin_t;
+
+typedef struct cmap_table_bin {
+    uint32_t data_offset;
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t data_entries_count;
+    uint8_t format_type;
+    uint8_t padding;
+} cmap_table_bin_t;
+
+/*A font whose tables point into a memory mapped binary font file*/
+typedef struct {
+    lv_font_t font;     /*Has to be the first*/
+    lv_font_fmt_txt_dsc_t dsc;
+    union {
+        lv_font_fmt_txt_kern_pair_t pair;
+        lv_font_fmt_txt_kern_classes_t classes;
+    } kern;
+    font_header_bin_t header;
+    const uint8_t * data;
+    uint32_t data_size;
+    const uint8_t * loca;
+    uint32_t loca_count;
+    const uint8_t * glyf;
+    uint32_t glyf_length;
+} mapped_font_t;
+
+/*A page of a streamed font file*/
+typedef struct {
+    uint8_t * buf;
+    uint32_t page_idx;      /*`UINT32_MAX` if the page is not used*/
+    uint32_t size;          /*Number of valid bytes, less than the page size at the end of the file*/
+    uint32_t last_use;
+} stream_page_t;
+
+/*A font whose glyphs are read from the file on demand*/
+typedef struct {
+    lv_font_t font;     /*Has to be the first*/
+    font_header_bin_t header;
+    lv_fs_file_t file;
+    uint32_t loca_start;    /*File offset of the first `loca` entry*/
+    uint32_t loca_count;
+    uint32_t glyf_start;    /*File offset of the `glyf` table*/
+    uint32_t glyf_length;
+    stream_page_t * pages;  /*LRU cache of the pages of the file*/
+    uint32_t page_cnt;
+    uint32_t page_size;
+    uint32_t use_cnt;
+} streamed_font_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, streamed_font_t * sf);
+int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
+
+static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
+static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
+
+static uint32_t get_glyph_header_bits(const font_header_bin_t * header);
+static bool load_mapped_font(mapped_font_t * mf);
+static bool mapped_get_glyph_dsc(const lv_font_t * font, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * gdsc_out);
+static const uint8_t * mapped_get_glyph_bitmap(const lv_font_t * font, uint32_t gid,
+                                               const lv_font_fmt_txt_glyph_dsc_t * gdsc);
+static void mapped_release_glyph_bitmap(const lv_font_t * font, const uint8_t * bitmap);
+static bool streamed_get_glyph_dsc(const lv_font_t * font, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * gdsc_out);
+static const uint8_t * streamed_get_glyph_bitmap(const lv_font_t * font, uint32_t gid,
+                                                 const lv_font_fmt_txt_glyph_dsc_t * gdsc);
+static void streamed_release_glyph_bitmap(const lv_font_t * font, const uint8_t * bitmap);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_font_fmt_txt_glyph_loader_t mapped_glyph_loader = {
+    .get_glyph_dsc = mapped_get_glyph_dsc,
+    .get_glyph_bitmap = mapped_get_glyph_bitmap,
+    .release_glyph_bitmap = mapped_release_glyph_bitmap,
+};
+
+static const lv_font_fmt_txt_glyph_loader_t streamed_glyph_loader = {
+    .get_glyph_dsc = streamed_get_glyph_dsc,
+    .get_glyph_bitmap = streamed_get_glyph_bitmap,
+    .release_glyph_bitmap = streamed_release_glyph_bitmap,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_font_t * lv_binfont_create(const char * path)
+{
+    LV_ASSERT_NULL(path);
+
+    lv_fs_file_t file;
+    lv_fs_res_t fs_res = lv_fs_open(&file, path, LV_FS_MODE_RD);
+    if(fs_res != LV_FS_RES_OK) return NULL;
+
+    lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
+    LV_ASSERT_MALLOC(font);
+
+    if(!lvgl_load_font(&file, font, NULL)) {
+        LV_LOG_WARN("Error loading font file: %s", path);
+        /*
+        * When `lvgl_load_font` fails it can leak some pointers.
+        * All non-null pointers can be assumed as allocated and
+        * `lv_binfont_destroy` should free them correctly.
+        */
+        lv_binfont_destroy(font);
+        font = NULL;
+    }
+
+    lv_fs_close(&file);
+
+    return font;
+}
+
+#if LV_USE_FS_MEMFS
+lv_font_t * lv_binfont_create_from_buffer(void * buffer, uint32_t size)
+{
+    lv_fs_path_ex_t mempath;
+
+    lv_fs_make_path_from_buffer(&mempath, LV_FS_MEMFS_LETTER, buffer, size);
+    return lv_binfont_create((const char *)&mempath);
+}
+#endif
+
+lv_font_t * lv_binfont_create_from_mapped(const void * data, uint32_t size)
+{
+    LV_ASSERT_NULL(data);
+
+    mapped_font_t * mf = lv_malloc_zeroed(sizeof(mapped_font_t));
+    LV_ASSERT_MALLOC(mf);
+    if(mf == NULL) return NULL;
+
+    mf->data = data;
+    mf->data_size = size;
+    mf->font.dsc = &mf->dsc;
+    mf->dsc.glyph_loader = &mapped_glyph_loader;
+
+    if(!load_mapped_font(mf)) {
+        LV_LOG_WARN("Error loading mapped font from %p", data);
+        lv_free((void *)mf->dsc.cmaps);
+        lv_free(mf);
+        return NULL;
+    }
+
+    return &mf->font;
+}
+
+lv_font_t * lv_binfont_create_streamed(const char * path, uint32_t page_size, uint32_t page_cnt)
+{
+    LV_ASSERT_NULL(path);
+    LV_ASSERT(page_size > 0 && page_cnt > 0);
+
+    streamed_font_t * sf = lv_malloc_zeroed(sizeof(streamed_font_t));
+    LV_ASSERT_MALLOC(sf);
+    if(sf == NULL) return NULL;
+
+    /*Allocate the page descriptors and the pages in one block*/
+    uint8_t * pages_buf = lv_malloc(page_cnt * (sizeof(stream_page_t) + page_size));
+    LV_ASSERT_MALLOC(pages_buf);
+    if(pages_buf == NULL) {
+        lv_free(sf);
+        return NULL;
+    }
+
+    sf->pages = (stream_page_t *)pages_buf;
+    sf->page_cnt = page_cnt;
+    sf->page_size = page_size;
+    for(uint32_t i = 0; i < page_cnt; i++) {
+        sf->pages[i].buf = pages_buf + page_cnt * sizeof(stream_page_t) + i * page_size;
+        sf->pages[i].page_idx = UINT32_MAX;
+        sf->pages[i].size = 0;
+        sf->pages[i].last_use = 0;
+    }
+
+    lv_fs_res_t fs_res = lv_fs_open(&sf->file, path, LV_FS_MODE_RD);
+    if(fs_res != LV_FS_RES_OK) {
+        lv_free(sf->pages);
+        lv_free(sf);
+        return NULL;
+    }
+
+    lv_font_t * font = &sf->font;
+    if(!lvgl_load_font(&sf->file, font, sf) ||
+       (get_glyph_header_bits(&sf->header) + 7) / 8 > STREAM_GLYPH_HEADER_MAX_SIZE) {
+        LV_LOG_WARN("Error loading font file: %s", path);
+        lv_fs_close(&sf->file);
+        lv_free(sf->pages);
+        /*The font isn't marked as streamed yet so only the loaded tables and `sf` are freed*/
+        lv_binfont_destroy(font);
+        return NULL;
+    }
+
+    lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    dsc->glyph_loader = &streamed_glyph_loader;
+
+    return font;
+}
+
+void lv_binfont_destroy(lv_font_t * font)
+{
+    if(font == NULL) return;
+
+    const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
+    if(dsc == NULL) return;
+
+    /*The cached glyphs refer to the freed bitmaps and a new font can get the same address*/
+    lv_font_fmt_txt_glyph_cache_drop_all();
+
+    /*Only the cmaps and the font itself are allocated for mapped fonts*/
+    if(dsc->glyph_loader == &mapped_glyph_loader) {
+        lv_free((void *)dsc->cmaps);
+        lv_free(font);
+        return;
+    }
+
+    /*Streamed fonts are loaded like the others except the glyphs*/
+    if(dsc->glyph_loader == &streamed_glyph_loader) {
+        streamed_font_t * sf = (streamed_font_t *)font;
+        lv_fs_close(&sf->file);
+        lv_free(sf->pages);
+    }
+
+    if(dsc->kern_classes == 0) {
+        const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
+        if(NULL != kern_dsc) {
+            lv_font_fmt_txt_kern_hash_delete((lv_font_fmt_txt_kern_hash_t *)kern_dsc->hash);
+            lv_free((void *)kern_dsc->glyph_ids);
+            lv_free((void *)kern_dsc->values);
+            lv_free((void *)kern_dsc);
+        }
+    }
+    else {
+        const lv_font_fmt_txt_kern_classes_t * kern_dsc = dsc->kern_dsc;
+        if(NULL != kern_dsc) {
+            lv_free((void *)kern_dsc->class_pair_values);
+            lv_free((void *)kern_dsc->left_class_mapping);
+            lv_free((void *)kern_dsc->right_class_mapping);
+            lv_free((void *)kern_dsc);
+        }
+    }
+
+    const lv_font_fmt_txt_cmap_t * cmaps = dsc->cmaps;
+    if(NULL != cmaps) {
+        for(int i = 0; i < dsc->cmap_num; ++i) {
+            lv_free((void *)cmaps[i].glyph_id_ofs_list);
+            lv_free((void *)cmaps[i].unicode_list);
+        }
+        lv_free((void *)cmaps);
+    }
+
+    lv_free((void *)dsc->glyph_bitmap);
+    lv_free((void *)dsc->glyph_dsc);
+    lv_free((void *)dsc);
+    lv_free(font);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
+{
+    bit_iterator_t it;
+    it.fp = fp;
+    it.bit_pos = -1;
+    it.byte_value = 0;
+    return it;
+}
+
+static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res)
+{
+    unsigned int value = 0;
+    while(n_bits--) {
+        it->byte_value = it->byte_value << 1;
+        it->bit_pos--;
+
+        if(it->bit_pos < 0) {
+            it->bit_pos = 7;
+            *res = lv_fs_read(it->fp, &(it->byte_value), 1, NULL);
+            if(*res != LV_FS_RES_OK) {
+                return 0;
+            }
+        }
+        int8_t bit = (it->byte_value & 0x80) ? 1 : 0;
+
+        value |= (bit << n_bits);
+    }
+    *res = LV_FS_RES_OK;
+    return value;
+}
+
+static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res)
+{
+    unsigned int value = read_bits(it, n_bits, res);
+    if(value & (1 << (n_bits - 1))) {
+        value |= ~0u << n_bits;
+    }
+    return value;
+}
+
+static int read_label(lv_fs_file_t * fp, int start, const char * label)
+{
+    lv_fs_seek(fp, start, LV_FS_SEEK_SET);
+
+    uint32_t length;
+    char buf[4];
+
+    if(lv_fs_read(fp, &length, 4, NULL) != LV_FS_RES_OK
+       || lv_fs_read(fp, buf, 4, NULL) != LV_FS_RES_OK
+       || lv_memcmp(label, buf, 4) != 0) {
+        LV_LOG_WARN("Error reading '%s' label.", label);
+        return -1;
+    }
+
+    return length;
+}
+
+static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+                              uint32_t cmaps_start, cmap_table_bin_t * cmap_table)
+{
+    if(lv_fs_read(fp, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t), NULL) != LV_FS_RES_OK) {
+        return false;
+    }
+
+    for(unsigned int i = 0; i < font_dsc->cmap_num; ++i) {
+        lv_fs_res_t res = lv_fs_seek(fp, cmaps_start + cmap_table[i].data_offset, LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) {
+            return false;
+        }
+
+        lv_font_fmt_txt_cmap_t * cmap = (lv_font_fmt_txt_cmap_t *) & (font_dsc->cmaps[i]);
+
+        cmap->range_start = cmap_table[i].range_start;
+        cmap->range_length = cmap_table[i].range_length;
+        cmap->glyph_id_start = cmap_table[i].glyph_id_start;
+        cmap->type = cmap_table[i].format_type;
+
+        switch(cmap_table[i].format_type) {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+                    uint8_t ids_size = (uint8_t)(sizeof(uint8_t) * cmap_table[i].data_entries_count);
+                    uint8_t * glyph_id_ofs_list = lv_malloc(ids_size);
+
+                    cmap->glyph_id_ofs_list = glyph_id_ofs_list;
+
+                    if(lv_fs_read(fp, glyph_id_ofs_list, ids_size, NULL) != LV_FS_RES_OK) {
+                        return false;
+                    }
+
+                    cmap->list_length = cmap->range_length;
+                    break;
+                }
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY: {
+                    uint32_t list_size = sizeof(uint16_t) * cmap_table[i].data_entries_count;
+                    uint16_t * unicode_list = (uint16_t *)lv_malloc(list_size);
+
+                    cmap->unicode_list = unicode_list;
+                    cmap->list_length = cmap_table[i].data_entries_count;
+
+                    if(lv_fs_read(fp, unicode_list, list_size, NULL) != LV_FS_RES_OK) {
+                        return false;
+                    }
+
+                    if(cmap_table[i].format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+                        uint16_t * buf = lv_malloc(sizeof(uint16_t) * cmap->list_length);
+
+                        cmap->glyph_id_ofs_list = buf;
+
+                        if(lv_fs_read(fp, buf, sizeof(uint16_t) * cmap->list_length, NULL) != LV_FS_RES_OK) {
+                            return false;
+                        }
+                    }
+                    break;
+                }
+            default:
+                LV_LOG_WARN("Unknown cmaps format type %d.", cmap_table[i].format_type);
+                return false;
+        }
+    }
+    return true;
+}
+
+static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t cmaps_start)
+{
+    int32_t cmaps_length = read_label(fp, cmaps_start, "cmap");
+    if(cmaps_length < 0) {
+        return -1;
+    }
+
+    uint32_t cmaps_subtables_count;
+    if(lv_fs_read(fp, &cmaps_subtables_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        return -1;
+    }
+
+    lv_font_fmt_txt_cmap_t * cmaps =
+        lv_malloc(cmaps_subtables_count * sizeof(lv_font_fmt_txt_cmap_t));
+
+    lv_memset(cmaps, 0, cmaps_subtables_count * sizeof(lv_font_fmt_txt_cmap_t));
+
+    font_dsc->cmaps = cmaps;
+    font_dsc->cmap_num = cmaps_subtables_count;
+
+    cmap_table_bin_t * cmaps_tables = lv_malloc(sizeof(cmap_table_bin_t) * font_dsc->cmap_num);
+
+    bool success = load_cmaps_tables(fp, font_dsc, cmaps_start, cmaps_tables);
+
+    lv_free(cmaps_tables);
+
+    return success ? cmaps_length : -1;
+}
+
+static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+{
+    int32_t glyph_length = read_label(fp, start, "glyf");
+    if(glyph_length < 0) {
+        return -1;
+    }
+
+    lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = (lv_font_fmt_txt_glyph_dsc_t *)
+                                              lv_malloc(loca_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
+
+    lv_memset(glyph_dsc, 0, loca_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
+
+    font_dsc->glyph_dsc = glyph_dsc;
+
+    int cur_bmp_size = 0;
+
+    for(unsigned int i = 0; i < loca_count; ++i) {
+        lv_font_fmt_txt_glyph_dsc_t * gdsc = &glyph_dsc[i];
+
+        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        bit_iterator_t bit_it = init_bit_iterator(fp);
+
+        if(header->advance_width_bits == 0) {
+            gdsc->adv_w = header->default_advance_width;
+        }
+        else {
+            gdsc->adv_w = read_bits(&bit_it, header->advance_width_bits, &res);
+            if(res != LV_FS_RES_OK) {
+                return -1;
+            }
+        }
+
+        if(header->advance_width_format == 0) {
+            gdsc->adv_w *= 16;
+        }
+
+        gdsc->ofs_x = read_bits_signed(&bit_it, header->xy_bits, &res);
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        gdsc->ofs_y = read_bits_signed(&bit_it, header->xy_bits, &res);
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        gdsc->box_w = read_bits(&bit_it, header->wh_bits, &res);
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        gdsc->box_h = read_bits(&bit_it, header->wh_bits, &res);
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
+        int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
+
+        if(i == 0) {
+            gdsc->adv_w = 0;
+            gdsc->box_w = 0;
+            gdsc->box_h = 0;
+            gdsc->ofs_x = 0;
+            gdsc->ofs_y = 0;
+        }
+
+        gdsc->bitmap_index = cur_bmp_size;
+        if(gdsc->box_w * gdsc->box_h != 0) {
+            cur_bmp_size += bmp_size;
+        }
+    }
+
+    uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
+
+    font_dsc->glyph_bitmap = glyph_bmp;
+
+    cur_bmp_size = 0;
+
+    for(unsigned int i = 1; i < loca_count; ++i) {
+        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+        bit_iterator_t bit_it = init_bit_iterator(fp);
+
+        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+
+        read_bits(&bit_it, nbits, &res);
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        if(glyph_dsc[i].box_w * glyph_dsc[i].box_h == 0) {
+            continue;
+        }
+
+        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
+        int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
+
+        if(nbits % 8 == 0) {  /*Fast path*/
+            if(lv_fs_read(fp, &glyph_bmp[cur_bmp_size], bmp_size, NULL) != LV_FS_RES_OK) {
+                return -1;
+            }
+        }
+        else {
+            for(int k = 0; k < bmp_size - 1; ++k) {
+                glyph_bmp[cur_bmp_size + k] = read_bits(&bit_it, 8, &res);
+                if(res != LV_FS_RES_OK) {
+                    return -1;
+                }
+            }
+            glyph_bmp[cur_bmp_size + bmp_size - 1] = read_bits(&bit_it, 8 - nbits % 8, &res);
+            if(res != LV_FS_RES_OK) {
+                return -1;
+            }
+
+            /*The last fragment should be on the MSB but read_bits() will place it to the LSB*/
+            glyph_bmp[cur_bmp_size + bmp_size - 1] = glyph_bmp[cur_bmp_size + bmp_size - 1] << (nbits % 8);
+
+        }
+
+        cur_bmp_size += bmp_size;
+    }
+    return glyph_length;
+}
+
+/*
+ * Read the glyph offsets of the `loca` table.
+ * Returns the allocated offsets or NULL on error.
+ */
+static uint32_t * load_loca(lv_fs_file_t * fp, const font_header_bin_t * font_header, uint32_t loca_count)
+{
+    bool failed = false;
+    uint32_t * glyph_offset = lv_malloc(sizeof(uint32_t) * (loca_count + 1));
+
+    if(font_header->index_to_loc_format == 0) {
+        for(unsigned int i = 0; i < loca_count; ++i) {
+            uint16_t offset;
+            if(lv_fs_read(fp, &offset, sizeof(uint16_t), NULL) != LV_FS_RES_OK) {
+                failed = true;
+                break;
+            }
+            glyph_offset[i] = offset;
+        }
+    }
+    else if(font_header->index_to_loc_format == 1) {
+        if(lv_fs_read(fp, glyph_offset, loca_count * sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+            failed = true;
+        }
+    }
+    else {
+        LV_LOG_WARN("Unknown index_to_loc_format: %d.", font_header->index_to_loc_format);
+        failed = true;
+    }
+
+    if(failed) {
+        lv_free(glyph_offset);
+        return NULL;
+    }
+
+    return glyph_offset;
+}
+
+/*
+ * Loads a `lv_font_t` from a binary file, given a `lv_fs_file_t`.
+ *
+ * Memory allocations on `lvgl_load_font` should be immediately zeroed and
+ * the pointer should be set on the `lv_font_t` data before any possible return.
+ *
+ * When something fails, it returns `false` and the memory on the `lv_font_t`
+ * still needs to be freed using `lv_binfont_destroy`.
+ *
+ * `lv_binfont_destroy` will assume that all non-null pointers are allocated and
+ * should be freed.
+ *
+ * If `sf` is not NULL the `loca` and `glyf` tables are not loaded,
+ * only their position is stored in `sf` to read the glyphs on demand.
+ */
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, streamed_font_t * sf)
+{
+    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
+                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+
+    lv_memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+
+    font->dsc = font_dsc;
+
+    /*header*/
+    int32_t header_length = read_label(fp, 0, "head");
+    if(header_length < 0) {
+        return false;
+    }
+
+    font_header_bin_t font_header;
+    if(lv_fs_read(fp, &font_header, sizeof(font_header_bin_t), NULL) != LV_FS_RES_OK) {
+        return false;
+    }
+
+    if(sf) sf->header = font_header;
+
+    font->base_line = -font_header.descent;
+    font->line_height = font_header.ascent - font_header.descent;
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->subpx = font_header.subpixels_mode;
+    font->underline_position = (int8_t) font_header.underline_position;
+    font->underline_thickness = (int8_t) font_header.underline_thickness;
+
+    font_dsc->bpp = font_header.bits_per_pixel;
+    font_dsc->kern_scale = font_header.kerning_scale;
+    font_dsc->bitmap_format = font_header.compression_id;
+
+    /*cmaps*/
+    uint32_t cmaps_start = header_length;
+    int32_t cmaps_length = load_cmaps(fp, font_dsc, cmaps_start);
+    if(cmaps_length < 0) {
+        return false;
+    }
+
+    /*loca*/
+    uint32_t loca_start = cmaps_start + cmaps_length;
+    int32_t loca_length = read_label(fp, loca_start, "loca");
+    if(loca_length < 0) {
+        return false;
+    }
+
+    uint32_t loca_count;
+    if(lv_fs_read(fp, &loca_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        return false;
+    }
+
+    /*glyph*/
+    uint32_t glyph_start = loca_start + loca_length;
+    int32_t glyph_length;
+    if(sf) {
+        if(font_header.index_to_loc_format > 1) {
+            LV_LOG_WARN("Unknown index_to_loc_format: %d.", font_header.index_to_loc_format);
+            return false;
+        }
+
+        /*Only the position of the tables is stored to read the glyphs on demand*/
+        glyph_length = read_label(fp, glyph_start, "glyf");
+        sf->loca_start = loca_start + 12;
+        sf->loca_count = loca_count;
+        sf->glyf_start = glyph_start;
+        sf->glyf_length = glyph_length;
+    }
+    else {
+        uint32_t * glyph_offset = load_loca(fp, &font_header, loca_count);
+        if(glyph_offset == NULL) {
+            return false;
+        }
+
+        glyph_length = load_glyph(fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+
+        lv_free(glyph_offset);
+    }
+
+    if(glyph_length < 0) {
+        return false;
+    }
+
+    /*kerning*/
+    if(font_header.tables_count < 4) {
+        font_dsc->kern_dsc = NULL;
+        font_dsc->kern_classes = 0;
+        font_dsc->kern_scale = 0;
+        return true;
+    }
+
+    uint32_t kern_start = glyph_start + glyph_length;
+
+    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
+
+    return kern_length >= 0;
+}
+
+int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
+{
+    int32_t kern_length = read_label(fp, start, "kern");
+    if(kern_length < 0) {
+        return -1;
+    }
+
+    uint8_t kern_format_type;
+    int32_t padding;
+    if(lv_fs_read(fp, &kern_format_type, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
+       lv_fs_read(fp, &padding, 3 * sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+        return -1;
+    }
+
+    if(0 == kern_format_type) { /*sorted pairs*/
+        lv_font_fmt_txt_kern_pair_t * kern_pair = lv_malloc(sizeof(lv_font_fmt_txt_kern_pair_t));
+
+        lv_memset(kern_pair, 0, sizeof(lv_font_fmt_txt_kern_pair_t));
+
+        font_dsc->kern_dsc = kern_pair;
+        font_dsc->kern_classes = 0;
+
+        uint32_t glyph_entries;
+        if(lv_fs_read(fp, &glyph_entries, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        int ids_size;
+        if(format == 0) {
+            ids_size = sizeof(int8_t) * 2 * glyph_entries;
+        }
+        else {
+            ids_size = sizeof(int16_t) * 2 * glyph_entries;
+        }
+
+        uint8_t * glyph_ids = lv_malloc(ids_size);
+        int8_t * values = lv_malloc(glyph_entries);
+
+        kern_pair->glyph_ids_size = format;
+        kern_pair->pair_cnt = glyph_entries;
+        kern_pair->glyph_ids = glyph_ids;
+        kern_pair->values = values;
+
+        if(lv_fs_read(fp, glyph_ids, ids_size, NULL) != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
+            return -1;
+        }
+
+#if LV_FONT_FMT_TXT_KERN_HASH
+        kern_pair->hash = lv_font_fmt_txt_kern_hash_create(kern_pair);
+#endif
+    }
+    else if(3 == kern_format_type) { /*array M*N of classes*/
+
+        lv_font_fmt_txt_kern_classes_t * kern_classes = lv_malloc(sizeof(lv_font_fmt_txt_kern_classes_t));
+
+        lv_memset(kern_classes, 0, sizeof(lv_font_fmt_txt_kern_classes_t));
+
+        font_dsc->kern_dsc = kern_classes;
+        font_dsc->kern_classes = 1;
+
+        uint16_t kern_class_mapping_length;
+        uint8_t kern_table_rows;
+        uint8_t kern_table_cols;
+
+        if(lv_fs_read(fp, &kern_class_mapping_length, sizeof(uint16_t), NULL) != LV_FS_RES_OK ||
+           lv_fs_read(fp, &kern_table_rows, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
+           lv_fs_read(fp, &kern_table_cols, sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        int kern_values_length = sizeof(int8_t) * kern_table_rows * kern_table_cols;
+
+        uint8_t * kern_left = lv_malloc(kern_class_mapping_length);
+        uint8_t * kern_right = lv_malloc(kern_class_mapping_length);
+        int8_t * kern_values = lv_malloc(kern_values_length);
+
+        kern_classes->left_class_mapping  = kern_left;
+        kern_classes->right_class_mapping = kern_right;
+        kern_classes->left_class_cnt = kern_table_rows;
+        kern_classes->right_class_cnt = kern_table_cols;
+        kern_classes->class_pair_values = kern_values;
+
+        if(lv_fs_read(fp, kern_left, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
+           lv_fs_read(fp, kern_right, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
+           lv_fs_read(fp, kern_values, kern_values_length, NULL) != LV_FS_RES_OK) {
+            return -1;
+        }
+    }
+    else {
+        LV_LOG_WARN("Unknown kern_format_type: %d", kern_format_type);
+        return -1;
+    }
+
+    return kern_length;
+}
+
+/*
+ * Check the label and the length of a table in a mapped font
+ * Returns the length of the table or -1 on error.
+ */
+static int32_t get_mapped_label(const mapped_font_t * mf, uint32_t start, const char * label)
+{
+    uint32_t length = 0;
+    if(start <= mf->data_size && mf->data_size - start >= 8) {
+        lv_memcpy(&length, &mf->data[start], sizeof(uint32_t));
+    }
+
+    if(length < 8 || length > mf->data_size - start || lv_memcmp(label, &mf->data[start + 4], 4) != 0) {
+        LV_LOG_WARN("Error reading '%s' label.", label);
+        return -1;
+    }
+
+    return length;
+}
+
+/*The 16 bit lists of the cmaps and kerning pairs are used directly so they need to be aligned*/
+static bool is_aligned_16(const void * p)
+{
+    if((lv_uintptr_t)p & 0x1) {
+        LV_LOG_WARN("The tables of the mapped font are not aligned");
+        return false;
+    }
+    return true;
+}
+
+static int32_t load_mapped_cmaps(mapped_font_t * mf, uint32_t cmaps_start)
+{
+    int32_t cmaps_length = get_mapped_label(mf, cmaps_start, "cmap");
+    if(cmaps_length < 12) return -1;
+
+    uint32_t cmap_num;
+    lv_memcpy(&cmap_num, &mf->data[cmaps_start + 8], sizeof(uint32_t));
+    if(cmap_num > ((uint32_t)cmaps_length - 12) / sizeof(cmap_table_bin_t)) return -1;
+
+    lv_font_fmt_txt_cmap_t * cmaps = lv_malloc_zeroed(cmap_num * sizeof(lv_font_fmt_txt_cmap_t));
+    LV_ASSERT_MALLOC(cmaps);
+    if(cmaps == NULL) return -1;
+
+    mf->dsc.cmaps = cmaps;
+    mf->dsc.cmap_num = cmap_num;
+
+    for(uint32_t i = 0; i < cmap_num; i++) {
+        cmap_table_bin_t table;
+        lv_memcpy(&table, &mf->data[cmaps_start + 12 + i * sizeof(cmap_table_bin_t)], sizeof(cmap_table_bin_t));
+
+        lv_font_fmt_txt_cmap_t * cmap = &cmaps[i];
+        cmap->range_start = table.range_start;
+        cmap->range_length = table.range_length;
+        cmap->glyph_id_start = table.glyph_id_start;
+        cmap->type = table.format_type;
+
+        uint32_t list_size;
+        switch(table.format_type) {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                list_size = table.data_entries_count;
+                cmap->list_length = cmap->range_length;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                list_size = 0;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+                list_size = table.data_entries_count * sizeof(uint16_t);
+                cmap->list_length = table.data_entries_count;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+                list_size = table.data_entries_count * sizeof(uint16_t) * 2;
+                cmap->list_length = table.data_entries_count;
+                break;
+            default:
+                LV_LOG_WARN("Unknown cmaps format type %d.", table.format_type);
+                return -1;
+        }
+
+        if(list_size == 0) continue;
+
+        if(table.data_offset > (uint32_t)cmaps_length || list_size > cmaps_length - table.data_offset) return -1;
+        const uint8_t * list = &mf->data[cmaps_start + table.data_offset];
+
+        if(table.format_type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            cmap->glyph_id_ofs_list = list;
+        }
+        else {
+            if(!is_aligned_16(list)) return -1;
+            cmap->unicode_list = (const uint16_t *)list;
+            if(table.format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+                cmap->glyph_id_ofs_list = list + table.data_entries_count * sizeof(uint16_t);
+            }
+        }
+    }
+
+    return cmaps_length;
+}
+
+static int32_t load_mapped_kern(mapped_font_t * mf, uint32_t kern_start)
+{
+    int32_t kern_length = get_mapped_label(mf, kern_start, "kern");
+    if(kern_length < 16) return -1;
+
+    const uint8_t * kern = &mf->data[kern_start];
+    uint8_t kern_format_type = kern[8];
+
+    if(0 == kern_format_type) { /*sorted pairs*/
+        uint32_t glyph_entries;
+        lv_memcpy(&glyph_entries, &kern[12], sizeof(uint32_t));
+
+        uint32_t ids_size = glyph_entries * 2 * (mf->header.glyph_id_format == 0 ? sizeof(uint8_t) : sizeof(uint16_t));
+        if(glyph_entries > (uint32_t)kern_length || ids_size + glyph_entries > (uint32_t)kern_length - 16) return -1;
+        if(mf->header.glyph_id_format != 0 && !is_aligned_16(&kern[16])) return -1;
+
+        /*The pairs are binary searched as a hash table would need to be allocated*/
+        lv_font_fmt_txt_kern_pair_t * kern_pair = &mf->kern.pair;
+        kern_pair->glyph_ids = &kern[16];
+        kern_pair->values = (const int8_t *)&kern[16 + ids_size];
+        kern_pair->pair_cnt = glyph_entries;
+        kern_pair->glyph_ids_size = mf->header.glyph_id_format;
+
+        mf->dsc.kern_dsc = kern_pair;
+        mf->dsc.kern_classes = 0;
+    }
+    else if(3 == kern_format_type) { /*array M*N of classes*/
+        uint16_t kern_class_mapping_length;
+        lv_memcpy(&kern_class_mapping_length, &kern[12], sizeof(uint16_t));
+        uint8_t kern_table_rows = kern[14];
+        uint8_t kern_table_cols = kern[15];
+
+        uint32_t values_ofs = 16 + 2 * (uint32_t)kern_class_mapping_length;
+        if(values_ofs + kern_table_rows * kern_table_cols > (uint32_t)kern_length) return -1;
+
+        lv_font_fmt_txt_kern_classes_t * kern_classes = &mf->kern.classes;
+        kern_classes->left_class_mapping = &kern[16];
+        kern_classes->right_class_mapping = &kern[16 + kern_class_mapping_length];
+        kern_classes->class_pair_values = (const int8_t *)&kern[values_ofs];
+        kern_classes->left_class_cnt = kern_table_rows;
+        kern_classes->right_class_cnt = kern_table_cols;
+
+        mf->dsc.kern_dsc = kern_classes;
+        mf->dsc.kern_classes = 1;
+    }
+    else {
+        LV_LOG_WARN("Unknown kern_format_type: %d", kern_format_type);
+        return -1;
+    }
+
+    return kern_length;
+}
+
+/*
+ * Set up a font from a memory mapped binary font file.
+ * Only the cmap descriptors are allocated, everything else is used from the mapped data.
+ */
+static bool load_mapped_font(mapped_font_t * mf)
+{
+    /*header*/
+    int32_t header_length = get_mapped_label(mf, 0, "head");
+    if(header_length < 0) return false;
+
+    /*Older fonts have no underline info in the header*/
+    uint32_t header_size = LV_MIN((uint32_t)header_length - 8, sizeof(font_header_bin_t));
+    lv_memcpy(&mf->header, &mf->data[8], header_size);
+    const font_header_bin_t * header = &mf->header;
+
+    lv_font_t * font = &mf->font;
+    font->base_line = -header->descent;
+    font->line_height = header->ascent - header->descent;
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->subpx = header->subpixels_mode;
+    font->underline_position = (int8_t) header->underline_position;
+    font->underline_thickness = (int8_t) header->underline_thickness;
+
+    mf->dsc.bpp = header->bits_per_pixel;
+    mf->dsc.kern_scale = header->kerning_scale;
+    mf->dsc.bitmap_format = header->compression_id;
+
+    /*cmaps*/
+    uint32_t cmaps_start = header_length;
+    int32_t cmaps_length = load_mapped_cmaps(mf, cmaps_start);
+    if(cmaps_length < 0) return false;
+
+    /*loca*/
+    uint32_t loca_start = cmaps_start + cmaps_length;
+    int32_t loca_length = get_mapped_label(mf, loca_start, "loca");
+    if(loca_length < 12) return false;
+
+    if(header->index_to_loc_format > 1) {
+        LV_LOG_WARN("Unknown index_to_loc_format: %d.", header->index_to_loc_format);
+        return false;
+    }
+
+    lv_memcpy(&mf->loca_count, &mf->data[loca_start + 8], sizeof(uint32_t));
+    uint32_t loca_entry_size = header->index_to_loc_format == 0 ? sizeof(uint16_t) : sizeof(uint32_t);
+    if(mf->loca_count == 0 || mf->loca_count > ((uint32_t)loca_length - 12) / loca_entry_size) return false;
+    mf->loca = &mf->data[loca_start + 12];
+
+    /*glyph*/
+    uint32_t glyph_start = loca_start + loca_length;
+    int32_t glyph_length = get_mapped_label(mf, glyph_start, "glyf");
+    if(glyph_length < 0) return false;
+
+    mf->glyf = &mf->data[glyph_start];
+    mf->glyf_length = glyph_length;
+
+    /*kerning*/
+    if(header->tables_count < 4) {
+        mf->dsc.kern_dsc = NULL;
+        mf->dsc.kern_classes = 0;
+        mf->dsc.kern_scale = 0;
+        return true;
+    }
+
+    return load_mapped_kern(mf, glyph_start + glyph_length) >= 0;
+}
+
+static uint32_t get_glyph_header_bits(const font_header_bin_t * header)
+{
+    return header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+}
+
+/*
+ * Get where the data of a glyph is in the `glyf` table.
+ * `loca_entries` points to the raw `loca` entry of the glyph followed by the entry of the next glyph if `has_next`.
+ * Returns false if the offsets are invalid.
+ */
+static bool get_glyph_range(const font_header_bin_t * header, const uint8_t * loca_entries, bool has_next,
+                            uint32_t glyf_length, uint32_t * ofs, uint32_t * size)
+{
+    uint32_t start;
+    uint32_t end = glyf_length;
+    if(header->index_to_loc_format == 0) {
+        uint16_t ofs16[2];
+        lv_memcpy(ofs16, loca_entries, has_next ? 4 : 2);
+        start = ofs16[0];
+        if(has_next) end = ofs16[1];
+    }
+    else {
+        uint32_t ofs32[2];
+        lv_memcpy(ofs32, loca_entries, has_next ? 8 : 4);
+        start = ofs32[0];
+        if(has_next) end = ofs32[1];
+    }
+
+    uint32_t header_bytes = (get_glyph_header_bits(header) + 7) / 8;
+    if(end > glyf_length || start > end || end - start < header_bytes) return false;
+
+    *ofs = start;
+    *size = end - start;
+    return true;
+}
+
+static uint32_t read_glyph_bits(const uint8_t * data, uint32_t * bit_pos, uint32_t n_bits)
+{
+    uint32_t value = 0;
+    while(n_bits--) {
+        value = (value << 1) | ((data[*bit_pos >> 3] >> (7 - (*bit_pos & 0x7))) & 0x1);
+        (*bit_pos)++;
+    }
+    return value;
+}
+
+static int32_t read_glyph_bits_signed(const uint8_t * data, uint32_t * bit_pos, uint32_t n_bits)
+{
+    uint32_t value = read_glyph_bits(data, bit_pos, n_bits);
+    if(n_bits && (value & (1u << (n_bits - 1)))) {
+        value |= ~0u << n_bits;
+    }
+    return (int32_t)value;
+}
+
+/*
+ * Decode the bit packed header of a glyph.
+ * Glyph 0 is an empty glyph whatever is stored in the file.
+ */
+static void decode_glyph_header(const font_header_bin_t * header, uint32_t gid, const uint8_t * data,
+                                lv_font_fmt_txt_glyph_dsc_t * gdsc_out)
+{
+    lv_memzero(gdsc_out, sizeof(lv_font_fmt_txt_glyph_dsc_t));
+    if(gid == 0) return;
+
+    uint32_t bit_pos = 0;
+    uint32_t adv_w = header->default_advance_width;
+    if(header->advance_width_bits) adv_w = read_glyph_bits(data, &bit_pos, header->advance_width_bits);
+    if(header->advance_width_format == 0) adv_w *= 16;
+
+    gdsc_out->adv_w = adv_w;
+    gdsc_out->ofs_x = read_glyph_bits_signed(data, &bit_pos, header->xy_bits);
+    gdsc_out->ofs_y = read_glyph_bits_signed(data, &bit_pos, header->xy_bits);
+    gdsc_out->box_w = read_glyph_bits(data, &bit_pos, header->wh_bits);
+    gdsc_out->box_h = read_glyph_bits(data, &bit_pos, header->wh_bits);
+}
+
+/*
+ * The bitmap of a glyph starts right after its bit packed header so it can start at any bit.
+ * Shift it in place to a byte boundary. `bitmap` needs to have `size + 1` bytes and
+ * the last byte is set to zero as the decompressor can read a byte ahead.
+ */
+static void align_glyph_bitmap(uint8_t * bitmap, uint32_t size, uint32_t shift)
+{
+    bitmap[size] = 0;
+    if(shift == 0) return;
+
+    for(uint32_t i = 0; i < size; i++) {
+        bitmap[i] = (uint8_t)((bitmap[i] << shift) | (bitmap[i + 1] >> (8 - shift)));
+    }
+}
+
+static bool get_mapped_glyph_range(const mapped_font_t * mf, uint32_t gid, uint32_t * ofs, uint32_t * size)
+{
+    if(gid >= mf->loca_count) return false;
+
+    uint32_t entry_size = mf->header.index_to_loc_format == 0 ? sizeof(uint16_t) : sizeof(uint32_t);
+    return get_glyph_range(&mf->header, &mf->loca[gid * entry_size], gid + 1 < mf->loca_count, mf->glyf_length,
+                           ofs, size);
+}
+
+static bool mapped_get_glyph_dsc(const lv_font_t * font, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * gdsc_out)
+{
+    const mapped_font_t * mf = (const mapped_font_t *)font;
+
+    uint32_t ofs;
+    uint32_t size;
+    if(!get_mapped_glyph_range(mf, gid, &ofs, &size)) return false;
+
+    decode_glyph_header(&mf->header, gid, &mf->glyf[ofs], gdsc_out);
+    return true;
+}
+
+static const uint8_t * mapped_get_glyph_bitmap(const lv_font_t * font, uint32_t gid,
+                                               const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    LV_UNUSED(gdsc);
+
+    const mapped_font_t * mf = (const mapped_font_t *)font;
+
+    uint32_t ofs;
+    uint32_t size;
+    if(!get_mapped_glyph_range(mf, gid, &ofs, &size)) return NULL;
+
+    uint32_t nbits = get_glyph_header_bits(&mf->header);
+    const uint8_t * bitmap = &mf->glyf[ofs + nbits / 8];
+    uint32_t bitmap_size = size - nbits / 8;
+    if(nbits % 8 == 0) return bitmap;
+
+    uint8_t * aligned = lv_malloc(bitmap_size + 1);
+    LV_ASSERT_MALLOC(aligned);
+    if(aligned == NULL) return NULL;
+
+    lv_memcpy(aligned, bitmap, bitmap_size);
+    align_glyph_bitmap(aligned, bitmap_size, nbits % 8);
+    return aligned;
+}
+
+static void mapped_release_glyph_bitmap(const lv_font_t * font, const uint8_t * bitmap)
+{
+    const mapped_font_t * mf = (const mapped_font_t *)font;
+
+    /*Only the realigned bitmaps are allocated*/
+    lv_uintptr_t p = (lv_uintptr_t)bitmap;
+    if(p < (lv_uintptr_t)mf->data || p >= (lv_uintptr_t)mf->data + mf->data_size) {
+        lv_free((void *)bitmap);
+    }
+}
+
+static stream_page_t * find_stream_page(streamed_font_t * sf, uint32_t page_idx)
+{
+    for(uint32_t i = 0; i < sf->page_cnt; i++) {
+        if(sf->pages[i].page_idx == page_idx) return &sf->pages[i];
+    }
+    return NULL;
+}
+
+/*
+ * Read a page of the file into the least recently used page.
+ * Returns the page or NULL on error or if the page is after the end of the file.
+ */
+static stream_page_t * read_stream_page(streamed_font_t * sf, uint32_t page_idx, uint32_t use)
+{
+    stream_page_t * page = &sf->pages[0];
+    for(uint32_t i = 1; i < sf->page_cnt; i++) {
+        if(sf->pages[i].last_use < page->last_use) page = &sf->pages[i];
+    }
+
+    page->page_idx = UINT32_MAX;
+    page->size = 0;
+
+    uint32_t br = 0;
+    if(lv_fs_seek(&sf->file, page_idx * sf->page_size, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+       lv_fs_read(&sf->file, page->buf, sf->page_size, &br) != LV_FS_RES_OK || br == 0) {
+        return NULL;
+    }
+
+    page->page_idx = page_idx;
+    page->size = br;
+    page->last_use = use;
+    return page;
+}
+
+static const stream_page_t * get_stream_page(streamed_font_t * sf, uint32_t page_idx)
+{
+    sf->use_cnt++;
+
+    stream_page_t * page = find_stream_page(sf, page_idx);
+    if(page) {
+        page->last_use = sf->use_cnt;
+        return page;
+    }
+
+    page = read_stream_page(sf, page_idx, sf->use_cnt);
+    if(page == NULL) return NULL;
+
+    /*Read ahead the next pages of the glyphs as the neighbouring glyph ids are often used together.
+     *They are marked as used before the requested page so they don't replace it.*/
+    uint32_t glyf_end = sf->glyf_start + sf->glyf_length;
+    uint32_t ahead_cnt = LV_MIN(STREAM_READ_AHEAD_PAGE_CNT, sf->page_cnt - 1);
+    uint32_t i;
+    for(i = 1; i <= ahead_cnt && (page_idx + i) * sf->page_size < glyf_end; i++) {
+        if(find_stream_page(sf, page_idx + i)) continue;
+        if(read_stream_page(sf, page_idx + i, sf->use_cnt - 1) == NULL) break;
+    }
+
+    return page;
+}
+
+/*
+ * Copy `len` bytes from the `pos` position of a streamed font file.
+ * Returns false if they can't be read.
+ */
+static bool read_stream(streamed_font_t * sf, uint32_t pos, uint8_t * out, uint32_t len)
+{
+    while(len > 0) {
+        const stream_page_t * page = get_stream_page(sf, pos / sf->page_size);
+        if(page == NULL) return false;
+
+        uint32_t page_ofs = pos % sf->page_size;
+        if(page_ofs >= page->size) return false;
+
+        uint32_t copy_len = LV_MIN(len, page->size - page_ofs);
+        lv_memcpy(out, &page->buf[page_ofs], copy_len);
+        out += copy_len;
+        pos += copy_len;
+        len -= copy_len;
+    }
+
+    return true;
+}
+
+static bool get_streamed_glyph_range(streamed_font_t * sf, uint32_t gid, uint32_t * ofs, uint32_t * size)
+{
+    if(gid >= sf->loca_count) return false;
+
+    uint32_t entry_size = sf->header.index_to_loc_format == 0 ? sizeof(uint16_t) : sizeof(uint32_t);
+    bool has_next = gid + 1 < sf->loca_count;
+    uint8_t entries[2 * sizeof(uint32_t)];
+    if(!read_stream(sf, sf->loca_start + gid * entry_size, entries, has_next ? 2 * entry_size : entry_size)) {
+        return false;
+    }
+
+    return get_glyph_range(&sf->header, entries, has_next, sf->glyf_length, ofs, size);
+}
+
+static bool streamed_get_glyph_dsc(const lv_font_t * font, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * gdsc_out)
+{
+    streamed_font_t * sf = (streamed_font_t *)font;
+
+    uint32_t ofs;
+    uint32_t size;
+    if(!get_streamed_glyph_range(sf, gid, &ofs, &size)) return false;
+
+    uint8_t header[STREAM_GLYPH_HEADER_MAX_SIZE];
+    uint32_t header_size = (get_glyph_header_bits(&sf->header) + 7) / 8;
+    if(!read_stream(sf, sf->glyf_start + ofs, header, header_size)) return false;
+
+    decode_glyph_header(&sf->header, gid, header, gdsc_out);
+    return true;
+}
+
+static const uint8_t * streamed_get_glyph_bitmap(const lv_font_t * font, uint32_t gid,
+                                                 const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    LV_UNUSED(gdsc);
+
+    streamed_font_t * sf = (streamed_font_t *)font;
+
+    uint32_t ofs;
+    uint32_t size;
+    if(!get_streamed_glyph_range(sf, gid, &ofs, &size)) return NULL;
+
+    uint32_t nbits = get_glyph_header_bits(&sf->header);
+    uint32_t bitmap_size = size - nbits / 8;
+    uint8_t * bitmap = lv_malloc(bitmap_size + 1);
+    LV_ASSERT_MALLOC(bitmap);
+    if(bitmap == NULL) return NULL;
+
+    if(!read_stream(sf, sf->glyf_start + ofs + nbits / 8, bitmap, bitmap_size)) {
+        lv_free(bitmap);
+        return NULL;
+    }
+
+    align_glyph_bitmap(bitmap, bitmap_size, nbits % 8);
+    return bitmap;
+}
+
+static void streamed_release_glyph_bitmap(const lv_font_t * font, const uint8_t * bitmap)
+{
+    LV_UNUSED(font);
+
+    lv_free((void *)bitmap);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file lv_binfont_loader.h
+ *
+ */
+
+#ifndef LV_BINFONT_LOADER_H
+#define LV_BINFONT_LOADER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Loads a `lv_font_t` object from a binary font file
+ * @param path   path to font file
+ * @return  pointer to font where to load
+ */
+lv_font_t * lv_binfont_create(const char * path);
+
+#if LV_USE_FS_MEMFS
+/**
+ * Loads a `lv_font_t` object from a memory buffer containing the binary font file.
+ * Requires LV_USE_FS_MEMFS
+ * @param buffer        address of the font file in the memory
+ * @param size          size of the font file buffer
+ * @return              pointer to font where to load
+ */
+lv_font_t * lv_binfont_create_from_buffer(void * buffer, uint32_t size);
+#endif
+
+/**
+ * Create a `lv_font_t` object from a binary font file mapped to the memory, e.g. a flash partition
+ * mapped with `esp_partition_mmap()` or a file mapped with `mmap()`.
+ * The glyphs, cmaps and kerning tables are used directly from the mapped region and
+ * only a few hundred bytes of metadata are allocated regardless of the number of glyphs.
+ * The tables must be at least 2 byte aligned in the memory, so `data` should be 4 byte aligned.
+ * @param data          address of the mapped font file. It needs to remain valid while the font is used.
+ * @param size          size of the font file
+ * @return              pointer to the new font or NULL on error
+ */
+lv_font_t * lv_binfont_create_from_mapped(const void * data, uint32_t size);
+
+/**
+ * Create a `lv_font_t` object from a binary font file whose glyphs are read on demand, e.g. from an SD card.
+ * Only the header, the cmaps and the kerning tables are loaded. The glyph descriptors and bitmaps
+ * are read through a cache of `page_cnt` pages of `page_size` bytes of the file
+ * and the next page is read ahead as the neighbouring glyphs are often used together.
+ * The decoded glyphs are cached by the glyph cache of the fmt_txt fonts as for other fonts.
+ * The file remains opened until the font is destroyed and it's read from the thread which draws the glyphs.
+ * @param path          path to the font file
+ * @param page_size     size of a page in bytes, e.g. 512 or the sector size of the file system
+ * @param page_cnt      number of cached pages, at least 2 to make use of reading ahead
+ * @return              pointer to the new font or NULL on error
+ */
+lv_font_t * lv_binfont_create_streamed(const char * path, uint32_t page_size, uint32_t page_cnt);
+
+/**
+ * Frees the memory allocated by the `lv_binfont_create()`, `lv_binfont_create_from_mapped()`
+ * and `lv_binfont_create_streamed()` functions
+ * @param font          lv_font_t object created by the lv_binfont_create functions
+ */
+void lv_binfont_destroy(lv_font_t * font);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /* LV_BINFONT_LOADER_H */
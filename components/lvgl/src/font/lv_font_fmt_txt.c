@@ -0,0 +1,941 @@
+/**
+ * @file lv_font_fmt_txt.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font.h"
+#include "lv_font_fmt_txt_private.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_types.h"
+#include "../misc/lv_log.h"
+#include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_USE_FONT_COMPRESSED
+    #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
+#endif /*LV_USE_FONT_COMPRESSED*/
+
+#define glyph_cache_p (LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache)
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#define GLYPH_CACHE_NAME "FONT_FMT_TXT_GLYPH"
+
+#define gid_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_gid_cache
+
+#if LV_FONT_FMT_TXT_GID_CACHE_SIZE > 0
+    #if LV_FONT_FMT_TXT_GID_CACHE_SIZE < 2 || (LV_FONT_FMT_TXT_GID_CACHE_SIZE & (LV_FONT_FMT_TXT_GID_CACHE_SIZE - 1))
+        #error "LV_FONT_FMT_TXT_GID_CACHE_SIZE must be 0 or a power of 2"
+    #endif
+    /*The cache is 2-way set associative*/
+    #define GID_CACHE_SET_CNT (LV_FONT_FMT_TXT_GID_CACHE_SIZE / 2)
+#endif
+
+/*Approximate size of the draw buffer and the cache entry of a glyph besides the pixels*/
+#define GLYPH_CACHE_OVERHEAD    100
+
+/*Convert an A1, A2 and A4 values to A8*/
+#define A1_PX(b)    {(((b) >> 3) & 1) * 255, (((b) >> 2) & 1) * 255, (((b) >> 1) & 1) * 255, ((b) & 1) * 255}
+#define A2_PX(b)    {(((b) >> 6) & 3) * 85, (((b) >> 4) & 3) * 85, (((b) >> 2) & 3) * 85, ((b) & 3) * 85}
+#define A4_PX(b)    {((b) >> 4) * 17, ((b) & 0xF) * 17}
+
+/*Generate the rows of an unpacking table for every possible input value*/
+#define TABLE_4(px, b)      px(b), px((b) + 1), px((b) + 2), px((b) + 3)
+#define TABLE_16(px, b)     TABLE_4(px, b), TABLE_4(px, (b) + 4), TABLE_4(px, (b) + 8), TABLE_4(px, (b) + 12)
+#define TABLE_64(px, b)     TABLE_16(px, b), TABLE_16(px, (b) + 16), TABLE_16(px, (b) + 32), TABLE_16(px, (b) + 48)
+#define TABLE_256(px)       TABLE_64(px, 0), TABLE_64(px, 64), TABLE_64(px, 128), TABLE_64(px, 192)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t gid_left;
+    uint32_t gid_right;
+} kern_pair_ref_t;
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    const lv_font_t * font;
+    uint32_t gid;
+    lv_font_fmt_txt_glyph_dsc_t gdsc;   /**< Not compared, just passed to the create callback*/
+    lv_draw_buf_t * draw_buf;
+} glyph_cache_data_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int unicode_list_compare(const void * ref, const void * element);
+static int kern_pair_8_compare(const void * ref, const void * element);
+static int kern_pair_16_compare(const void * ref, const void * element);
+static inline uint32_t kern_hash_slot(uint32_t key, uint32_t mask);
+static const lv_font_fmt_txt_glyph_dsc_t * get_glyph_dsc(const lv_font_t * font, uint32_t gid,
+                                                          lv_font_fmt_txt_glyph_dsc_t * buf);
+static bool decode_glyph(const lv_font_t * font, uint32_t gid, const lv_font_fmt_txt_glyph_dsc_t * gdsc, uint8_t * out);
+static void unpack_plain(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp);
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    static lv_draw_buf_t * get_cached_glyph(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+#endif
+
+#if LV_USE_FONT_COMPRESSED
+    static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
+    static inline void decompress_line(uint8_t * out, int32_t w);
+    static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len);
+    static inline void rle_init(const uint8_t * in,  uint8_t bpp);
+    static inline uint8_t rle_next(void);
+#endif /*LV_USE_FONT_COMPRESSED*/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const uint8_t opa4_table[16] = {0,  17, 34,  51,
+                                       68, 85, 102, 119,
+                                       136, 153, 170, 187,
+                                       204, 221, 238, 255
+                                      };
+
+#if LV_USE_FONT_COMPRESSED
+static const uint8_t opa3_table[8] = {0, 36, 73, 109, 146, 182, 218, 255};
+#endif
+
+static const uint8_t opa2_table[4] = {0, 85, 170, 255};
+
+/*Unpack a nibble (4 pixels) of A1, a byte (4 pixels) of A2 and a byte (2 pixels) of A4 at once*/
+static const uint8_t a1_nibble_table[16][4] = {TABLE_16(A1_PX, 0)};
+static const uint8_t a2_byte_table[256][4] = {TABLE_256(A2_PX)};
+static const uint8_t a4_byte_table[256][2] = {TABLE_256(A4_PX)};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
+{
+    const lv_font_t * font = g_dsc->resolved_font;
+
+    uint32_t gid = g_dsc->gid.index;
+    if(!gid) return NULL;
+
+    lv_font_fmt_txt_glyph_dsc_t gdsc_buf;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = get_glyph_dsc(font, gid, &gdsc_buf);
+    if(gdsc == NULL) return NULL;
+
+    int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
+    if(gsize == 0) return NULL;
+
+#if !LV_USE_FONT_COMPRESSED
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) {
+        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
+        return NULL;
+    }
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    lv_draw_buf_t * cached_draw_buf = get_cached_glyph(g_dsc, gdsc);
+    if(cached_draw_buf) return cached_draw_buf;
+#endif
+
+    /*Not cached, e.g. too large or all the cached glyphs are in use*/
+    if(!decode_glyph(font, gid, gdsc, draw_buf->data)) return NULL;
+    return draw_buf;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    lv_font_fmt_txt_glyph_dsc_t gdsc_buf;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = get_glyph_dsc(font, gid, &gdsc_buf);
+    if(gdsc == NULL) return false;
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+    dsc_out->entry = NULL;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(glyph_cache_p, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+#else
+    LV_UNUSED(g_dsc);
+#endif
+}
+
+lv_font_fmt_txt_kern_hash_t * lv_font_fmt_txt_kern_hash_create(const lv_font_fmt_txt_kern_pair_t * kern_pair)
+{
+    LV_ASSERT_NULL(kern_pair);
+
+    /*Keep the load factor at most 2/3 so that the probe sequences remain short*/
+    uint32_t pair_cnt = kern_pair->pair_cnt;
+    uint32_t slot_cnt = 2;
+    while(slot_cnt < pair_cnt + pair_cnt / 2 + 1) slot_cnt <<= 1;
+
+    /*Allocate the descriptor, the keys and the values in one block*/
+    uint8_t * buf = lv_malloc(sizeof(lv_font_fmt_txt_kern_hash_t) + slot_cnt * sizeof(uint32_t) + slot_cnt);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return NULL;
+
+    lv_font_fmt_txt_kern_hash_t * hash = (lv_font_fmt_txt_kern_hash_t *)buf;
+    uint32_t * keys = (uint32_t *)(buf + sizeof(lv_font_fmt_txt_kern_hash_t));
+    int8_t * values = (int8_t *)(keys + slot_cnt);
+    lv_memzero(keys, slot_cnt * sizeof(uint32_t));
+    hash->keys = keys;
+    hash->values = values;
+    hash->mask = slot_cnt - 1;
+
+    uint32_t i;
+    for(i = 0; i < pair_cnt; i++) {
+        uint32_t gid_left;
+        uint32_t gid_right;
+        if(kern_pair->glyph_ids_size == 0) {
+            const uint8_t * g_ids = kern_pair->glyph_ids;
+            gid_left = g_ids[i * 2];
+            gid_right = g_ids[i * 2 + 1];
+        }
+        else {
+            const uint16_t * g_ids = kern_pair->glyph_ids;
+            gid_left = g_ids[i * 2];
+            gid_right = g_ids[i * 2 + 1];
+        }
+
+        /*Glyph id 0 means "not found" so such a pair is never looked up*/
+        if(gid_left == 0) continue;
+
+        uint32_t key = gid_left << 16 | gid_right;
+        uint32_t slot = kern_hash_slot(key, hash->mask);
+        while(keys[slot] != 0 && keys[slot] != key) slot = (slot + 1) & hash->mask;
+
+        /*Keep the first of the duplicated pairs as the binary search might find either of them*/
+        if(keys[slot] == key) continue;
+        keys[slot] = key;
+        values[slot] = kern_pair->values[i];
+    }
+
+    return hash;
+}
+
+void lv_font_fmt_txt_kern_hash_delete(lv_font_fmt_txt_kern_hash_t * hash)
+{
+    lv_free(hash);
+}
+
+void lv_font_fmt_txt_glyph_cache_init(void)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_p != NULL) return;
+
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(glyph_cache_data_t), LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb,
+    });
+
+    if(glyph_cache_p) lv_cache_set_name(glyph_cache_p, GLYPH_CACHE_NAME);
+#endif
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_destroy(glyph_cache_p, NULL);
+    glyph_cache_p = NULL;
+#endif
+}
+
+void lv_font_fmt_txt_glyph_cache_drop_all(void)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_drop_all(glyph_cache_p, NULL);
+#endif
+
+#if LV_FONT_FMT_TXT_GID_CACHE_SIZE > 0
+    lv_memzero(gid_cache, sizeof(gid_cache));
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get the descriptor of a glyph from the font's array or from its glyph loader
+ * @param font      the font
+ * @param gid       id of the glyph
+ * @param buf       the glyph is loaded here if the font has a glyph loader
+ * @return          the glyph descriptor or NULL if it can't be loaded
+ */
+static const lv_font_fmt_txt_glyph_dsc_t * get_glyph_dsc(const lv_font_t * font, uint32_t gid,
+                                                          lv_font_fmt_txt_glyph_dsc_t * buf)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc->glyph_loader == NULL) return &fdsc->glyph_dsc[gid];
+
+    return fdsc->glyph_loader->get_glyph_dsc(font, gid, buf) ? buf : NULL;
+}
+
+/**
+ * Decode the bitmap of a glyph to A8
+ * @param font      the font
+ * @param gid       id of the glyph
+ * @param gdsc      the glyph descriptor
+ * @param out       buffer for the A8 bitmap with `lv_draw_buf_width_to_stride(box_w, LV_COLOR_FORMAT_A8)` stride
+ * @return          false if the bitmap couldn't be loaded
+ */
+static bool decode_glyph(const lv_font_t * font, uint32_t gid, const lv_font_fmt_txt_glyph_dsc_t * gdsc, uint8_t * out)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    const lv_font_fmt_txt_glyph_loader_t * loader = fdsc->glyph_loader;
+    const uint8_t * bitmap_in;
+    if(loader) {
+        bitmap_in = loader->get_glyph_bitmap(font, gid, gdsc);
+        if(bitmap_in == NULL) return false;
+    }
+    else {
+        bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    }
+
+    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
+        unpack_plain(bitmap_in, out, gdsc->box_w, gdsc->box_h, (uint8_t)fdsc->bpp);
+    }
+#if LV_USE_FONT_COMPRESSED
+    else {
+        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
+        decompress(bitmap_in, out, gdsc->box_w, gdsc->box_h, (uint8_t)fdsc->bpp, prefilter);
+    }
+#endif
+
+    if(loader && loader->release_glyph_bitmap) loader->release_glyph_bitmap(font, bitmap_in);
+    return true;
+}
+
+/**
+ * Unpack an uncompressed 1, 2, 4 or 8 bpp bitmap to A8.
+ * The rows of the glyphs are not byte aligned, so all the pixels are unpacked
+ * as one continuous line a byte at a time and the rows are moved to their stride afterwards.
+ * @param in        the packed bitmap
+ * @param out       buffer for the A8 bitmap with `lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8)` stride
+ * @param w         width of the glyph
+ * @param h         height of the glyph
+ * @param bpp       bit per pixel of `in`
+ */
+static void unpack_plain(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp)
+{
+    uint32_t px_cnt = (uint32_t)w * h;
+    uint32_t px_per_byte = 8 / bpp;
+    uint32_t byte_cnt = px_cnt / px_per_byte;
+    uint32_t i;
+    uint8_t * out_tmp = out;
+
+    if(bpp == 1) {
+        for(i = 0; i < byte_cnt; i++) {
+            const uint8_t * hi = a1_nibble_table[in[i] >> 4];
+            const uint8_t * lo = a1_nibble_table[in[i] & 0xF];
+            out_tmp[0] = hi[0];
+            out_tmp[1] = hi[1];
+            out_tmp[2] = hi[2];
+            out_tmp[3] = hi[3];
+            out_tmp[4] = lo[0];
+            out_tmp[5] = lo[1];
+            out_tmp[6] = lo[2];
+            out_tmp[7] = lo[3];
+            out_tmp += 8;
+        }
+    }
+    else if(bpp == 2) {
+        for(i = 0; i < byte_cnt; i++) {
+            const uint8_t * px = a2_byte_table[in[i]];
+            out_tmp[0] = px[0];
+            out_tmp[1] = px[1];
+            out_tmp[2] = px[2];
+            out_tmp[3] = px[3];
+            out_tmp += 4;
+        }
+    }
+    else if(bpp == 4) {
+        for(i = 0; i < byte_cnt; i++) {
+            const uint8_t * px = a4_byte_table[in[i]];
+            out_tmp[0] = px[0];
+            out_tmp[1] = px[1];
+            out_tmp += 2;
+        }
+    }
+    else if(bpp == 8) {
+        lv_memcpy(out_tmp, in, px_cnt);
+        out_tmp += px_cnt;
+    }
+    else {
+        LV_LOG_WARN("%d bpp is not handled", bpp);
+        return;
+    }
+
+    /*Unpack the used pixels of the last, partially used byte*/
+    uint32_t rest = px_cnt - byte_cnt * px_per_byte;
+    if(rest) {
+        uint8_t last = in[byte_cnt];
+        for(i = 0; i < rest; i++) {
+            uint32_t shift = 8 - (i + 1) * bpp;
+            if(bpp == 1) out_tmp[i] = ((last >> shift) & 0x1) ? 0xff : 0x00;
+            else if(bpp == 2) out_tmp[i] = opa2_table[(last >> shift) & 0x3];
+            else out_tmp[i] = opa4_table[(last >> shift) & 0xF];
+        }
+    }
+
+    /*Move the rows to their place from the last to keep the not moved rows intact*/
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+    if(stride != (uint32_t)w) {
+        int32_t y;
+        for(y = h - 1; y > 0; y--) {
+            lv_memmove(out + y * stride, out + y * w, w);
+        }
+    }
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+
+/**
+ * Get the decoded bitmap of a glyph from the cache. It's decoded and added to the cache if not cached yet.
+ * @param g_dsc     the glyph descriptor. Its `entry` is set to be released by `lv_font_release_glyph_fmt_txt`
+ * @param gdsc      the descriptor of the glyph in the font
+ * @return          the A8 draw buffer of the glyph or NULL if it can't be cached
+ */
+static lv_draw_buf_t * get_cached_glyph(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    if(glyph_cache_p == NULL || !lv_cache_is_enabled(glyph_cache_p)) return NULL;
+
+    /*The cache would log an error on every draw for glyphs which can never fit.
+     *They are decoded to the caller's buffer instead.*/
+    size_t size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h + GLYPH_CACHE_OVERHEAD;
+    if(size > lv_cache_get_max_size(glyph_cache_p, NULL)) return NULL;
+
+    glyph_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.font = g_dsc->resolved_font;
+    search_key.gid = g_dsc->gid.index;
+    search_key.gdsc = *gdsc;
+    search_key.slot.size = size;
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(glyph_cache_p, &search_key, NULL);
+    if(entry == NULL) return NULL;
+
+    g_dsc->entry = entry;
+    glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->draw_buf;
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &data->gdsc;
+
+    data->draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h, LV_COLOR_FORMAT_A8,
+                                           LV_STRIDE_AUTO);
+    if(data->draw_buf == NULL) return false;
+
+    if(!decode_glyph(data->font, data->gid, gdsc, data->draw_buf->data)) {
+        lv_draw_buf_destroy(data->draw_buf);
+        data->draw_buf = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_draw_buf_destroy(data->draw_buf);
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->font != rhs->font) {
+        return (lv_uintptr_t)lhs->font > (lv_uintptr_t)rhs->font ? 1 : -1;
+    }
+
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+
+    return 0;
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0*/
+
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    if(letter == '\0') return 0;
+
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+    /*The first cmap is usually a simple range (e.g. ASCII) which is faster to use directly than the cache*/
+    const lv_font_fmt_txt_cmap_t * cmap0 = &fdsc->cmaps[0];
+    if(fdsc->cmap_num > 0 && cmap0->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY &&
+       letter - cmap0->range_start < cmap0->range_length) {
+        return cmap0->glyph_id_start + letter - cmap0->range_start;
+    }
+
+#if LV_FONT_FMT_TXT_GID_CACHE_SIZE > 0
+    /*The most recently used entry of a set is kept in the first way*/
+    uint32_t set = (letter ^ (uint32_t)((lv_uintptr_t)fdsc >> 4)) & (GID_CACHE_SET_CNT - 1);
+    lv_font_fmt_txt_gid_cache_entry_t * ways = &gid_cache[set * 2];
+    if(ways[0].fdsc == fdsc && ways[0].letter == letter) return ways[0].gid;
+    if(ways[1].fdsc == fdsc && ways[1].letter == letter) {
+        lv_font_fmt_txt_gid_cache_entry_t tmp = ways[1];
+        ways[1] = ways[0];
+        ways[0] = tmp;
+        return tmp.gid;
+    }
+
+    /*Not found letters are cached too as they'd need the longest search*/
+    uint32_t gid = find_glyph_dsc_id(fdsc, letter);
+    ways[1] = ways[0];
+    ways[0].fdsc = fdsc;
+    ways[0].letter = letter;
+    ways[0].gid = gid;
+    return gid;
+#else
+    return find_glyph_dsc_id(fdsc, letter);
+#endif
+}
+
+/**
+ * Search the cmaps of a font for a letter
+ * @param fdsc      the font descriptor
+ * @param letter    a Unicode letter
+ * @return          the id of the letter's glyph or 0 if not found
+ */
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+
+        /*Relative code point*/
+        uint32_t rcp = letter - fdsc->cmaps[i].range_start;
+        if(rcp >= fdsc->cmaps[i].range_length) continue;
+        uint32_t glyph_id = 0;
+        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
+            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
+            }
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
+            }
+        }
+
+        return glyph_id;
+    }
+
+    return 0;
+
+}
+
+static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
+{
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+
+    int8_t value = 0;
+
+    if(fdsc->kern_classes == 0) {
+        /*Kern pairs*/
+        const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+        if(kdsc->hash) {
+            /*Linear probing till the pair or an empty slot is found*/
+            const lv_font_fmt_txt_kern_hash_t * hash = kdsc->hash;
+            uint32_t key = gid_left << 16 | gid_right;
+            uint32_t slot = kern_hash_slot(key, hash->mask);
+            while(hash->keys[slot] != 0) {
+                if(hash->keys[slot] == key) {
+                    value = hash->values[slot];
+                    break;
+                }
+                slot = (slot + 1) & hash->mask;
+            }
+        }
+        else if(kdsc->glyph_ids_size == 0) {
+            /*Use binary search to find the kern value.
+             *The pairs are ordered left_id first, then right_id secondly.*/
+            const uint16_t * g_ids = kdsc->glyph_ids;
+            kern_pair_ref_t g_id_both = {gid_left, gid_right};
+            uint16_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
+
+            /*If the `g_id_both` were found get its index from the pointer*/
+            if(kid_p) {
+                lv_uintptr_t ofs = kid_p - g_ids;
+                value = kdsc->values[ofs];
+            }
+        }
+        else if(kdsc->glyph_ids_size == 1) {
+            /*Use binary search to find the kern value.
+             *The pairs are ordered left_id first, then right_id secondly.*/
+            const uint32_t * g_ids = kdsc->glyph_ids;
+            kern_pair_ref_t g_id_both = {gid_left, gid_right};
+            uint32_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
+
+            /*If the `g_id_both` were found get its index from the pointer*/
+            if(kid_p) {
+                lv_uintptr_t ofs = kid_p - g_ids;
+                value = kdsc->values[ofs];
+            }
+
+        }
+        else {
+            /*Invalid value*/
+        }
+    }
+    else {
+        /*Kern classes*/
+        const lv_font_fmt_txt_kern_classes_t * kdsc = fdsc->kern_dsc;
+        uint8_t left_class = kdsc->left_class_mapping[gid_left];
+        uint8_t right_class = kdsc->right_class_mapping[gid_right];
+
+        /*If class = 0, kerning not exist for that glyph
+         *else got the value form `class_pair_values` 2D array*/
+        if(left_class > 0 && right_class > 0) {
+            value = kdsc->class_pair_values[(left_class - 1) * kdsc->right_class_cnt + (right_class - 1)];
+        }
+
+    }
+    return value;
+}
+
+static int kern_pair_8_compare(const void * ref, const void * element)
+{
+    const kern_pair_ref_t * ref8_p = ref;
+    const uint8_t * element8_p = element;
+
+    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
+    if(ref8_p->gid_left != element8_p[0]) return ref8_p->gid_left - element8_p[0];
+    else return ref8_p->gid_right - element8_p[1];
+}
+
+static int kern_pair_16_compare(const void * ref, const void * element)
+{
+    const kern_pair_ref_t * ref16_p = ref;
+    const uint16_t * element16_p = element;
+
+    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
+    if(ref16_p->gid_left != element16_p[0]) return ref16_p->gid_left - element16_p[0];
+    else return ref16_p->gid_right - element16_p[1];
+}
+
+/**
+ * Get the first slot to probe for a kerning pair
+ * @param key       `gid_left << 16 | gid_right`
+ * @param mask      number of slots - 1
+ * @return          index of the slot
+ */
+static inline uint32_t kern_hash_slot(uint32_t key, uint32_t mask)
+{
+    /*Fibonacci hashing spreads the neighboring glyph ids*/
+    key *= 0x9E3779B1;
+    return (key ^ (key >> 16)) & mask;
+}
+
+#if LV_USE_FONT_COMPRESSED
+
+/**
+ * The compress a glyph's bitmap
+ * @param in the compressed bitmap
+ * @param out buffer to store the result
+ * @param px_num number of pixels in the glyph (width * height)
+ * @param bpp bit per pixel (bpp = 3 will be converted to bpp = 4)
+ * @param prefilter true: the lines are XORed
+ */
+static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter)
+{
+    const lv_opa_t * opa_table;
+    switch(bpp) {
+        case 2:
+            opa_table = opa2_table;
+            break;
+        case 3:
+            opa_table = opa3_table;
+            break;
+        case 4:
+            opa_table = opa4_table;
+            break;
+        default:
+            LV_LOG_WARN("%d bpp is not handled", bpp);
+            return;
+    }
+
+    rle_init(in, bpp);
+
+    uint8_t * line_buf1 = lv_malloc(w);
+
+    uint8_t * line_buf2 = NULL;
+
+    if(prefilter) {
+        line_buf2 = lv_malloc(w);
+    }
+
+    decompress_line(line_buf1, w);
+
+    int32_t y;
+    int32_t x;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+
+    for(x = 0; x < w; x++) {
+        out[x] = opa_table[line_buf1[x]];
+    }
+    out += stride;
+
+    for(y = 1; y < h; y++) {
+        if(prefilter) {
+            decompress_line(line_buf2, w);
+
+            for(x = 0; x < w; x++) {
+                line_buf1[x] = line_buf2[x] ^ line_buf1[x];
+                out[x] = opa_table[line_buf1[x]];
+            }
+        }
+        else {
+            decompress_line(line_buf1, w);
+
+            for(x = 0; x < w; x++) {
+                out[x] = opa_table[line_buf1[x]];
+            }
+        }
+        out += stride;
+    }
+
+    lv_free(line_buf1);
+    lv_free(line_buf2);
+}
+
+/**
+ * Decompress one line. Store one pixel per byte
+ * @param out output buffer
+ * @param w width of the line in pixel count
+ */
+static inline void decompress_line(uint8_t * out, int32_t w)
+{
+    int32_t i;
+    for(i = 0; i < w; i++) {
+        out[i] = rle_next();
+    }
+}
+
+/**
+ * Read bits from an input buffer. The read can cross byte boundary.
+ * @param in the input buffer to read from.
+ * @param bit_pos index of the first bit to read.
+ * @param len number of bits to read (must be <= 8).
+ * @return the read bits
+ */
+static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len)
+{
+    uint8_t bit_mask;
+    switch(len) {
+        case 1:
+            bit_mask = 0x1;
+            break;
+        case 2:
+            bit_mask = 0x3;
+            break;
+        case 3:
+            bit_mask = 0x7;
+            break;
+        case 4:
+            bit_mask = 0xF;
+            break;
+        case 8:
+            bit_mask = 0xFF;
+            break;
+        default:
+            bit_mask = (uint16_t)((uint16_t) 1 << len) - 1;
+    }
+
+    uint32_t byte_pos = bit_pos >> 3;
+    bit_pos = bit_pos & 0x7;
+
+    if(bit_pos + len >= 8) {
+        uint16_t in16 = (in[byte_pos] << 8) + in[byte_pos + 1];
+        return (in16 >> (16 - bit_pos - len)) & bit_mask;
+    }
+    else {
+        return (in[byte_pos] >> (8 - bit_pos - len)) & bit_mask;
+    }
+}
+
+static inline void rle_init(const uint8_t * in,  uint8_t bpp)
+{
+    lv_font_fmt_rle_t * rle = &font_rle;
+    rle->in = in;
+    rle->bpp = bpp;
+    rle->state = RLE_STATE_SINGLE;
+    rle->rdp = 0;
+    rle->prev_v = 0;
+    rle->count = 0;
+}
+
+static inline uint8_t rle_next(void)
+{
+    uint8_t v = 0;
+    uint8_t ret = 0;
+    lv_font_fmt_rle_t * rle = &font_rle;
+
+    if(rle->state == RLE_STATE_SINGLE) {
+        ret = get_bits(rle->in, rle->rdp, rle->bpp);
+        if(rle->rdp != 0 && rle->prev_v == ret) {
+            rle->count = 0;
+            rle->state = RLE_STATE_REPEATED;
+        }
+
+        rle->prev_v = ret;
+        rle->rdp += rle->bpp;
+    }
+    else if(rle->state == RLE_STATE_REPEATED) {
+        v = get_bits(rle->in, rle->rdp, 1);
+        rle->count++;
+        rle->rdp += 1;
+        if(v == 1) {
+            ret = rle->prev_v;
+            if(rle->count == 11) {
+                rle->count = get_bits(rle->in, rle->rdp, 6);
+                rle->rdp += 6;
+                if(rle->count != 0) {
+                    rle->state = RLE_STATE_COUNTER;
+                }
+                else {
+                    ret = get_bits(rle->in, rle->rdp, rle->bpp);
+                    rle->prev_v = ret;
+                    rle->rdp += rle->bpp;
+                    rle->state = RLE_STATE_SINGLE;
+                }
+            }
+        }
+        else {
+            ret = get_bits(rle->in, rle->rdp, rle->bpp);
+            rle->prev_v = ret;
+            rle->rdp += rle->bpp;
+            rle->state = RLE_STATE_SINGLE;
+        }
+
+    }
+    else if(rle->state == RLE_STATE_COUNTER) {
+        ret = rle->prev_v;
+        rle->count--;
+        if(rle->count == 0) {
+            ret = get_bits(rle->in, rle->rdp, rle->bpp);
+            rle->prev_v = ret;
+            rle->rdp += rle->bpp;
+            rle->state = RLE_STATE_SINGLE;
+        }
+    }
+
+    return ret;
+}
+#endif /*LV_USE_FONT_COMPRESSED*/
+
+/** Code Comparator.
+ *
+ *  Compares the value of both input arguments.
+ *
+ *  @param[in]  pRef        Pointer to the reference.
+ *  @param[in]  pElement    Pointer to the element to compare.
+ *
+ *  @return Result of comparison.
+ *  @retval < 0   Reference is less than element.
+ *  @retval = 0   Reference is equal to element.
+ *  @retval > 0   Reference is greater than element.
+ *
+ */
+static int unicode_list_compare(const void * ref, const void * element)
+{
+    return (*(uint16_t *)ref) - (*(uint16_t *)element);
+}
@@ -108,6 +108,13 @@ typedef struct {
     lv_font_fmt_txt_cmap_type_t type;
 } lv_font_fmt_txt_cmap_t;
 
+/** Open addressing hash table of kerning pairs for constant time lookup*/
+typedef struct {
+    const uint32_t * keys;      /**< `glyph_id_left << 16 | glyph_id_right` of the pairs, 0: empty slot */
+    const int8_t * values;      /**< Kern value of the pair with the same index in `keys` */
+    uint32_t mask;              /**< Number of slots - 1. The number of slots is a power of 2 */
+} lv_font_fmt_txt_kern_hash_t;
+
 /** A simple mapping of kern values from pairs*/
 typedef struct {
     /*To get a kern value of two code points:
@@ -121,6 +128,10 @@ typedef struct {
     const int8_t * values;
     uint32_t pair_cnt   : 30;
     uint32_t glyph_ids_size : 2;    /**< 0: `glyph_ids` is stored as `uint8_t`; 1: as `uint16_t` */
+
+    /** Optional hash table of the pairs (see `lv_font_fmt_txt_kern_hash_create`).
+     *  If NULL the pairs are binary searched.*/
+    const lv_font_fmt_txt_kern_hash_t * hash;
 } lv_font_fmt_txt_kern_pair_t;
 
 /** More complex but more optimal class based kern value storage*/
@@ -147,6 +158,38 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
+/**
+ * Load the glyphs of a font on demand if they are not stored in the `glyph_dsc` and `glyph_bitmap` arrays,
+ * e.g. for binary fonts used from a memory mapped region.
+ */
+typedef struct {
+    /**
+     * Get the descriptor of a glyph
+     * @param font      the font
+     * @param gid       id of the glyph
+     * @param gdsc_out  store the descriptor here. Its `bitmap_index` is not used.
+     * @return          true on success; false if the glyph doesn't exist or can't be read
+     */
+    bool (*get_glyph_dsc)(const lv_font_t * font, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * gdsc_out);
+
+    /**
+     * Get the bitmap of a glyph in the font's `bitmap_format`
+     * @param font      the font
+     * @param gid       id of the glyph
+     * @param gdsc      the descriptor of the glyph returned by `get_glyph_dsc`
+     * @return          the bitmap which needs to remain valid until `release_glyph_bitmap` is called,
+     *                  or NULL on error
+     */
+    const uint8_t * (*get_glyph_bitmap)(const lv_font_t * font, uint32_t gid, const lv_font_fmt_txt_glyph_dsc_t * gdsc);
+
+    /**
+     * Optional. Called when the bitmap returned by `get_glyph_bitmap` is not used anymore.
+     * @param font      the font
+     * @param bitmap    the bitmap returned by `get_glyph_bitmap`
+     */
+    void (*release_glyph_bitmap)(const lv_font_t * font, const uint8_t * bitmap);
+} lv_font_fmt_txt_glyph_loader_t;
+
 /** Describe store for additional data for fonts */
 typedef struct {
     /** The bitmaps of all glyphs */
@@ -183,6 +226,12 @@ typedef struct {
      * from `lv_font_fmt_txt_bitmap_format_t`
      */
     uint16_t bitmap_format  : 2;
+
+    /**
+     * Optional. If set, the glyphs are loaded with it instead of from
+     * `glyph_dsc` and `glyph_bitmap` which can be NULL then.
+     */
+    const lv_font_fmt_txt_glyph_loader_t * glyph_loader;
 } lv_font_fmt_txt_dsc_t;
 
 /**********************
@@ -209,6 +258,29 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Used as `release_glyph` callback in lvgl's native font format.
+ * Releases the cached bitmap returned by `lv_font_get_bitmap_fmt_txt`.
+ * It's called for the fonts without `release_glyph` callback too.
+ * @param font          pointer to font
+ * @param g_dsc         the glyph descriptor whose bitmap was drawn
+ */
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
+/**
+ * Create a hash table from kerning pairs to look them up in constant time instead of binary searching them.
+ * Assign it to the `hash` field of `kern_pair` to use it.
+ * @param kern_pair     the kerning pairs of a font
+ * @return              the hash table or NULL on error. Free it with `lv_font_fmt_txt_kern_hash_delete`
+ */
+lv_font_fmt_txt_kern_hash_t * lv_font_fmt_txt_kern_hash_create(const lv_font_fmt_txt_kern_pair_t * kern_pair);
+
+/**
+ * Delete a hash table created by `lv_font_fmt_txt_kern_hash_create`
+ * @param hash          the hash table to delete. Can be NULL
+ */
+void lv_font_fmt_txt_kern_hash_delete(lv_font_fmt_txt_kern_hash_t * hash);
+
 /**********************
  *      MACROS
  **********************/
@@ -41,10 +41,35 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+#if LV_FONT_FMT_TXT_GID_CACHE_SIZE > 0
+/** A cached Unicode letter -> glyph id lookup*/
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< The font the letter was looked up in. NULL if the entry is empty*/
+    uint32_t letter;
+    uint32_t gid;                           /**< 0 if the letter is not in the font*/
+} lv_font_fmt_txt_gid_cache_entry_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the decoded glyph bitmaps
+ */
+void lv_font_fmt_txt_glyph_cache_init(void);
+
+/**
+ * Free the cache of the decoded glyph bitmaps
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+
+/**
+ * Drop the cached glyph bitmaps and glyph ids, e.g. before the data of a font is freed.
+ * The cache can't be iterated by font so the glyphs of all fonts are dropped.
+ */
+void lv_font_fmt_txt_glyph_cache_drop_all(void);
+
 /**********************
  *      MACROS
  **********************/
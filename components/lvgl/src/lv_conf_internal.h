@@ -27,6 +27,7 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_SSE2         3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 /* Handle special Kconfig options */
@@ -337,6 +338,17 @@
     #endif
 #endif
 
+/*Use RGB565A8 (3 bytes/pixel) instead of ARGB8888 (4 bytes/pixel) for the simple layers with alpha channel
+ *if the display is RGB565. The layers need 25% less memory so simple layers are drawn in fewer chunks.
+ *The draw units need to render to RGB565A8 (the software renderer needs `LV_DRAW_SW_SUPPORT_RGB565A8`)*/
+#ifndef LV_DRAW_LAYER_USE_RGB565A8
+    #ifdef CONFIG_LV_DRAW_LAYER_USE_RGB565A8
+        #define LV_DRAW_LAYER_USE_RGB565A8 CONFIG_LV_DRAW_LAYER_USE_RGB565A8
+    #else
+        #define LV_DRAW_LAYER_USE_RGB565A8  0
+    #endif
+#endif
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -516,14 +528,16 @@
     #endif
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /*Allow buffering some shadow calculation.
-        *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
-        #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
-            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
+        /*Memory budget for caching the blurred corners of shadows.
+        *The shadows with the same width, radius and spread reuse the corners in every stripe and frame.
+        *A corner takes `2 * (shadow_width + radius)^2` bytes.
+        *0: to disable caching
+        *It replaces the deprecated LV_DRAW_SW_SHADOW_CACHE_SIZE which was the largest shadow size in pixels.*/
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_BYTES
+            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_BYTES
+                #define LV_DRAW_SW_SHADOW_CACHE_BYTES CONFIG_LV_DRAW_SW_SHADOW_CACHE_BYTES
             #else
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+                #define LV_DRAW_SW_SHADOW_CACHE_BYTES 0  /*[bytes]*/
             #endif
         #endif
 
@@ -540,6 +554,34 @@
         #endif
     #endif
 
+    /* Memory budget for caching the color maps of gradients.
+     * The same gradient is not recalculated for each stripe of a partial refresh or on every frame.
+     * A map takes about 4 bytes per pixel of the gradient's width (horizontal) or height (vertical)
+     * and 1 kB for complex gradients.
+     * 0: to disable caching */
+    #ifndef LV_DRAW_SW_GRADIENT_CACHE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_GRADIENT_CACHE_SIZE
+            #define LV_DRAW_SW_GRADIENT_CACHE_SIZE CONFIG_LV_DRAW_SW_GRADIENT_CACHE_SIZE
+        #else
+            #define LV_DRAW_SW_GRADIENT_CACHE_SIZE (4 * 1024)   /*[bytes]*/
+        #endif
+    #endif
+
+    /* Collect the glyphs of a text line into a coverage buffer and blend them at once
+     * instead of blending every glyph one by one. Used for fonts with line height <= 32 px.
+     * Takes `line_height * clip_area_width` bytes from the scratch memory of the draw unit. */
+    #ifndef LV_DRAW_SW_GLYPH_RUN
+        #ifdef LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_DRAW_SW_GLYPH_RUN
+                #define LV_DRAW_SW_GLYPH_RUN CONFIG_LV_DRAW_SW_GLYPH_RUN
+            #else
+                #define LV_DRAW_SW_GLYPH_RUN 0
+            #endif
+        #else
+            #define LV_DRAW_SW_GLYPH_RUN        1
+        #endif
+    #endif
+
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -1096,6 +1138,18 @@
     #endif
 #endif
 
+/*Memory budget for widgets with `LV_OBJ_FLAG_CACHE_AS_BITMAP`. Such widgets are rendered once
+ *together with their children into a bitmap which is reused until something in them is invalidated.
+ *If the budget is exceeded the least recently used bitmaps are freed.
+ *0: disable the feature and draw the widgets normally*/
+#ifndef LV_OBJ_BITMAP_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_BITMAP_CACHE_SIZE
+        #define LV_OBJ_BITMAP_CACHE_SIZE CONFIG_LV_OBJ_BITMAP_CACHE_SIZE
+    #else
+        #define LV_OBJ_BITMAP_CACHE_SIZE 0      /*[bytes]*/
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1636,6 +1690,41 @@
     #endif
 #endif
 
+/*Memory budget for caching the decoded A8 bitmaps of the glyphs of built-in (fmt_txt) fonts.
+ *The glyphs are not unpacked again each time they are drawn, e.g. for each stripe of a partial refresh.
+ *A glyph takes its width * height bytes plus about 100 bytes.
+ *0: to disable caching*/
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (8 * 1024)   /*[bytes]*/
+    #endif
+#endif
+
+/*Number of cached Unicode letter -> glyph id lookups of built-in (fmt_txt) fonts.
+ *Saves searching the cmaps each time a letter is measured or drawn. Must be a power of 2.
+ *The letters of the first cmap are looked up directly if it's a simple range (e.g. ASCII).
+ *0: to disable caching*/
+#ifndef LV_FONT_FMT_TXT_GID_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GID_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GID_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GID_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GID_CACHE_SIZE 64
+    #endif
+#endif
+
+/*1: Create a hash table of the kerning pairs of the fonts loaded by `lv_binfont_create()`
+ *to find the kerning values in constant time instead of binary searching the pairs.
+ *It takes 7.5..15 bytes per pair. Fonts with kerning classes don't need it.*/
+#ifndef LV_FONT_FMT_TXT_KERN_HASH
+    #ifdef CONFIG_LV_FONT_FMT_TXT_KERN_HASH
+        #define LV_FONT_FMT_TXT_KERN_HASH CONFIG_LV_FONT_FMT_TXT_KERN_HASH
+    #else
+        #define LV_FONT_FMT_TXT_KERN_HASH 0
+    #endif
+#endif
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -2011,6 +2100,26 @@
             #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
         #endif
     #endif
+    #ifndef LV_LABEL_LINE_CACHE
+        #ifdef LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_LABEL_LINE_CACHE
+                #define LV_LABEL_LINE_CACHE CONFIG_LV_LABEL_LINE_CACHE
+            #else
+                #define LV_LABEL_LINE_CACHE 0
+            #endif
+        #else
+            #define LV_LABEL_LINE_CACHE 1     /*Store the line breaks of labels (8 bytes per line) to measure the text only when it changes*/
+        #endif
+    #endif
+    /*Max. size of the A8 bitmap the text of a scrolling label is rendered to once.
+     *While scrolling only the bitmap is drawn at the current offset. 0: disable*/
+    #ifndef LV_LABEL_SCROLL_BITMAP_SIZE
+        #ifdef CONFIG_LV_LABEL_SCROLL_BITMAP_SIZE
+            #define LV_LABEL_SCROLL_BITMAP_SIZE CONFIG_LV_LABEL_SCROLL_BITMAP_SIZE
+        #else
+            #define LV_LABEL_SCROLL_BITMAP_SIZE 0   /*[bytes]*/
+        #endif
+    #endif
     #ifndef LV_LABEL_WAIT_CHAR_COUNT
         #ifdef CONFIG_LV_LABEL_WAIT_CHAR_COUNT
             #define LV_LABEL_WAIT_CHAR_COUNT CONFIG_LV_LABEL_WAIT_CHAR_COUNT
@@ -3730,6 +3839,20 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
     #endif
 #endif
 
+/*LV_DRAW_SW_SHADOW_CACHE_SIZE was the largest cached shadow size in pixels.
+ *Convert it to the budget of one corner of that size.*/
+#if !defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && defined(CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
+#endif
+
+#if LV_DRAW_SW_COMPLEX && defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+    #warning "LV_DRAW_SW_SHADOW_CACHE_SIZE is deprecated, use LV_DRAW_SW_SHADOW_CACHE_BYTES. Please update lv_conf.h or run menuconfig again."
+    #if LV_DRAW_SW_SHADOW_CACHE_BYTES == 0
+        #undef LV_DRAW_SW_SHADOW_CACHE_BYTES
+        #define LV_DRAW_SW_SHADOW_CACHE_BYTES (2 * LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #endif
+#endif
+
 /*If running without lv_conf.h add typedefs with default value*/
 #ifdef LV_CONF_SKIP
     #if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)    /*Disable warnings for Visual Studio*/
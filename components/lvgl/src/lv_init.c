@@ -118,11 +118,6 @@ static inline void lv_global_init(lv_global_t * global)
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
 #endif
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void lv_cleanup_devices(lv_global_t * global)
@@ -218,6 +213,8 @@ void lv_init(void)
     lv_windows_platform_init();
 #endif
 
+    lv_font_fmt_txt_glyph_cache_init();
+
     lv_obj_style_init();
 
     /*Initialize the screen refresh system*/
@@ -389,6 +386,8 @@ void lv_deinit(void)
 
     lv_obj_style_deinit();
 
+    lv_font_fmt_txt_glyph_cache_deinit();
+
 #if LV_USE_PXP
 #if LV_USE_DRAW_PXP || LV_USE_ROTATE_PXP
     lv_draw_pxp_deinit();
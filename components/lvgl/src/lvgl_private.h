@@ -53,6 +53,7 @@ extern "C" {
 #include "core/lv_obj_private.h"
 #include "core/lv_obj_scroll_private.h"
 #include "core/lv_obj_draw_private.h"
+#include "core/lv_obj_bitmap_cache_private.h"
 #include "core/lv_obj_class_private.h"
 #include "core/lv_group_private.h"
 #include "core/lv_obj_event_private.h"
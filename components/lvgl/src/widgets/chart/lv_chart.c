@@ -823,6 +823,26 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     /*If there are at least as many points as pixels then draw only vertical lines*/
     bool crowded_mode = (int32_t)chart->point_cnt >= w;
 
+    /*Draw each series with polylines instead of a line per segment if possible.
+     *If the draw tasks are customized in LV_EVENT_DRAW_TASK_ADDED keep the segments as they were.*/
+    lv_point_precise_t * points = NULL;
+    if(!crowded_mode && !(line_dsc.dash_width && line_dsc.dash_gap) &&
+       !lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+        points = lv_malloc(sizeof(lv_point_precise_t) * chart->point_cnt);
+    }
+
+    /*The range of points which can affect the clip area*/
+    uint32_t first_point = 0;
+    uint32_t last_point = chart->point_cnt - 1;
+    if(points && w > 0) {
+        int32_t x_margin = point_w + line_dsc.width + 1;
+        int32_t x1 = clip_area_ori.x1 - x_margin - x_ofs;
+        int32_t x2 = clip_area_ori.x2 + x_margin - x_ofs;
+        if(x1 > 0) first_point = LV_MIN((uint32_t)(x1 * (int32_t)(chart->point_cnt - 1) / w), last_point);
+        if(x2 < 0) last_point = 0;
+        else last_point = LV_MIN((uint32_t)((x2 * (int32_t)(chart->point_cnt - 1) + w - 1) / w), last_point);
+    }
+
     line_dsc.base.id1 = lv_ll_get_len(&chart->series_ll) - 1;
     point_dsc_default.base.id1 = line_dsc.base.id1;
     /*Go through all data lines*/
@@ -839,6 +859,48 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
 
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
+        if(points) {
+            int32_t y_range = chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec];
+            uint32_t run_cnt = 0;
+            for(i = first_point; i <= last_point + 1; i++) {
+                uint32_t p = (start_point + i) % chart->point_cnt;
+                bool valid = i <= last_point && ser->y_points[p] != LV_CHART_POINT_NONE;
+                if(valid) {
+                    int32_t y_tmp = (int32_t)((int32_t)ser->y_points[p] - chart->ymin[ser->y_axis_sec]) * h / y_range;
+                    points[i].x = (lv_value_precise_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
+                    points[i].y = h - y_tmp + y_ofs;
+                    run_cnt++;
+                }
+                /*Draw the connected points when a gap or the end is reached*/
+                else if(run_cnt) {
+                    line_dsc.points = &points[i - run_cnt];
+                    line_dsc.point_cnt = run_cnt;
+                    line_dsc.base.id2 = i - run_cnt;
+                    lv_draw_polyline(layer, &line_dsc);
+                    run_cnt = 0;
+                }
+            }
+
+            /*Draw the points above the lines*/
+            if(point_w && point_h) {
+                for(i = first_point; i <= last_point; i++) {
+                    if(ser->y_points[(start_point + i) % chart->point_cnt] == LV_CHART_POINT_NONE) continue;
+
+                    lv_area_t point_area;
+                    point_area.x1 = (int32_t)points[i].x - point_w;
+                    point_area.x2 = (int32_t)points[i].x + point_w;
+                    point_area.y1 = (int32_t)points[i].y - point_h;
+                    point_area.y2 = (int32_t)points[i].y + point_h;
+                    point_dsc_default.base.id2 = i;
+                    lv_draw_rect(layer, &point_dsc_default, &point_area);
+                }
+            }
+
+            point_dsc_default.base.id1--;
+            line_dsc.base.id1--;
+            continue;
+        }
+
         line_dsc.p1.x = x_ofs;
         line_dsc.p2.x = x_ofs;
 
@@ -930,6 +992,7 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id1--;
     }
 
+    lv_free(points);
     layer->_clip_area = clip_area_ori;
 }
 
@@ -22,6 +22,7 @@
 #include "../../misc/lv_bidi_private.h"
 #include "../../misc/lv_text_ap.h"
 #include "../../misc/lv_text_private.h"
+#include "../../misc/cache/lv_image_cache.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../stdlib/lv_string.h"
 
@@ -38,6 +39,22 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_LABEL_LINE_CACHE
+/** The text and the line breaks of a label before its text was changed*/
+typedef struct {
+    char * text;
+    lv_draw_label_lines_t lines;
+} text_change_t;
+#endif
+
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+/** Draw unit to collect the glyphs of a text into an A8 bitmap*/
+typedef struct {
+    lv_draw_unit_t base_unit;
+    lv_draw_buf_t * bitmap;
+    bool failed;                    /**< A glyph or decoration can't be stored in the bitmap*/
+} scroll_bitmap_unit_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -58,8 +75,28 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+static const lv_draw_label_lines_t * get_lines(lv_label_t * label, const lv_font_t * font, int32_t letter_space,
+                                               int32_t max_w, lv_text_flag_t flag);
+static uint32_t get_next_line(const lv_draw_label_lines_t * lines, uint32_t line_idx, const char * txt,
+                              uint32_t line_start, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                              lv_text_flag_t flag);
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords);
+#if LV_LABEL_LINE_CACHE
+static bool text_change_start(lv_obj_t * obj, text_change_t * change);
+static void refr_text_change(lv_obj_t * obj, text_change_t * change);
+static int32_t get_letters_area(const char * txt, uint32_t start, uint32_t end, int32_t x, int32_t y,
+                                const lv_font_t * font, int32_t letter_space, lv_area_t * area);
+#endif
+static void draw_scroll_text(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_label_dsc_t * dsc,
+                             const lv_area_t * txt_coords);
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+static const lv_draw_buf_t * get_scroll_bitmap(lv_obj_t * obj, const lv_draw_label_dsc_t * dsc,
+                                               const lv_area_t * txt_coords);
+static void scroll_bitmap_glyph_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                                   lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area);
+static void scroll_bitmap_free(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -137,11 +174,18 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
-    lv_obj_invalidate(obj);
-
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
 
+#if LV_LABEL_LINE_CACHE
+    /*Keep the old text and lines to invalidate only the letters that have changed*/
+    text_change_t change;
+    bool partial = text != label->text && text_change_start(obj, &change);
+    if(!partial) lv_obj_invalidate(obj);
+#else
+    lv_obj_invalidate(obj);
+#endif
+
     const size_t text_len = get_text_length(text);
 
     /*If set its own text then reallocate it (maybe its size changed)*/
@@ -164,7 +208,12 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
 
         label->text = lv_malloc(text_len);
         LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
+        if(label->text == NULL) {
+#if LV_LABEL_LINE_CACHE
+            if(partial) refr_text_change(obj, &change);
+#endif
+            return;
+        }
 
         copy_text_to_label(label, text);
 
@@ -172,7 +221,12 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
         label->static_txt = 0;
     }
 
+#if LV_LABEL_LINE_CACHE
+    if(partial) refr_text_change(obj, &change);
+    else lv_label_refr_text(obj);
+#else
     lv_label_refr_text(obj);
+#endif
 }
 
 void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
@@ -180,15 +234,23 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(fmt);
 
-    lv_obj_invalidate(obj);
     lv_label_t * label = (lv_label_t *)obj;
 
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
+        lv_obj_invalidate(obj);
         lv_label_refr_text(obj);
         return;
     }
 
+#if LV_LABEL_LINE_CACHE
+    text_change_t change;
+    bool partial = text_change_start(obj, &change);
+    if(!partial) lv_obj_invalidate(obj);
+#else
+    lv_obj_invalidate(obj);
+#endif
+
     if(label->text != NULL && label->static_txt == 0) {
         lv_free(label->text);
         label->text = NULL;
@@ -200,7 +262,12 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     va_end(args);
     label->static_txt = 0; /*Now the text is dynamically allocated*/
 
+#if LV_LABEL_LINE_CACHE
+    if(partial) refr_text_change(obj, &change);
+    else lv_label_refr_text(obj);
+#else
     lv_label_refr_text(obj);
+#endif
 }
 
 void lv_label_set_text_static(lv_obj_t * obj, const char * text)
@@ -334,14 +401,20 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     const int32_t max_w = lv_area_get_width(&txt_coords);
     const int32_t max_h = lv_area_get_height(&txt_coords);
 
+    /*In dot mode the last visible line is broken differently so the stored lines can't be used*/
+    const lv_draw_label_lines_t * lines = NULL;
+    if(label->long_mode != LV_LABEL_LONG_DOT) lines = get_lines(label, font, letter_space, max_w, flag);
+
     int32_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
+    uint32_t line_idx = 0;
     while(txt[new_line_start] != '\0') {
         bool last_line = y + letter_height + line_space + letter_height > max_h;
         if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        new_line_start += get_next_line(lines, line_idx, txt, line_start, font, letter_space, max_w, flag);
+        line_idx++;
         if(byte_id < new_line_start || txt[new_line_start] == '\0')
             break; /*The line of 'index' letter begins at 'line_start'*/
 
@@ -425,6 +498,10 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
 
     lv_text_flag_t flag = get_label_flags(label);
 
+    const lv_draw_label_lines_t * lines = NULL;
+    if(label->long_mode != LV_LABEL_LONG_DOT) lines = get_lines(label, font, letter_space, max_w, flag);
+    uint32_t line_idx = 0;
+
     /*Search the line of the index letter*/;
     while(txt[line_start] != '\0') {
         /*If dots will be shown, break the last visible line anywhere,
@@ -432,7 +509,8 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
         bool last_line = y + letter_height + line_space + letter_height > max_h;
         if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        new_line_start += get_next_line(lines, line_idx, txt, line_start, font, letter_space, max_w, flag);
+        line_idx++;
 
         if(pos.y <= y + letter_height) {
             /*The line is found (stored in 'line_start')*/
@@ -539,31 +617,36 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
 
     lv_text_flag_t flag = get_label_flags(label);
 
+    const lv_draw_label_lines_t * lines = NULL;
+    if(label->long_mode != LV_LABEL_LONG_DOT) lines = get_lines(label, font, letter_space, max_w, flag);
+    uint32_t line_idx = 0;
+
     /*Search the line of the index letter*/
     int32_t y = 0;
     while(txt[line_start] != '\0') {
         bool last_line = y + letter_height + line_space + letter_height > max_h;
         if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        new_line_start += get_next_line(lines, line_idx, txt, line_start, font, letter_space, max_w, flag);
 
         if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
         y += letter_height + line_space;
 
         line_start = new_line_start;
+        line_idx++;
     }
 
     /*Calculate the x coordinate*/
     const lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
 
     int32_t x = 0;
-    if(align == LV_TEXT_ALIGN_CENTER) {
-        const int32_t line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
-        x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
-    }
-    else if(align == LV_TEXT_ALIGN_RIGHT) {
-        const int32_t line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
-        x += lv_area_get_width(&txt_coords) - line_w;
+    if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
+        int32_t line_w;
+        if(lines && line_idx < lines->line_cnt) line_w = lines->lines[line_idx].width;
+        else line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
+
+        if(align == LV_TEXT_ALIGN_CENTER) x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
+        else x += lv_area_get_width(&txt_coords) - line_w;
     }
 
     int32_t last_x = 0;
@@ -692,6 +775,15 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.y          = 0;
 #endif
 
+#if LV_LABEL_LINE_CACHE
+    lv_memzero(&label->lines, sizeof(label->lines));
+#endif
+
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+    label->scroll_bitmap = NULL;
+    label->scroll_bitmap_skip = 0;
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
@@ -712,6 +804,12 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     lv_label_dot_tmp_free(obj);
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_free(&label->lines);
+#endif
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+    scroll_bitmap_free(obj);
+#endif
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
 }
@@ -794,6 +892,8 @@ static void draw_main(lv_event_t * e)
     label_draw_dsc.flag = flag;
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
+    label_draw_dsc.lines = get_lines(label, label_draw_dsc.font, label_draw_dsc.letter_space,
+                                     lv_area_get_width(&txt_coords), flag);
 
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
     label_draw_dsc.sel_end = lv_label_get_text_selection_end(obj);
@@ -807,8 +907,13 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        if(label_draw_dsc.lines) {
+            lv_draw_label_lines_get_size(label_draw_dsc.lines, label->text, label_draw_dsc.line_space, &size);
+        }
+        else {
+            lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                             LV_COORD_MAX, flag);
+        }
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -828,7 +933,7 @@ static void draw_main(lv_event_t * e)
     if(label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         const lv_area_t clip_area_ori = layer->_clip_area;
         layer->_clip_area = txt_clip;
-        lv_draw_label(layer, &label_draw_dsc, &txt_coords);
+        draw_scroll_text(obj, layer, &label_draw_dsc, &txt_coords);
         layer->_clip_area = clip_area_ori;
     }
     else {
@@ -840,8 +945,13 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        if(label_draw_dsc.lines) {
+            lv_draw_label_lines_get_size(label_draw_dsc.lines, label->text, label_draw_dsc.line_space, &size);
+        }
+        else {
+            lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                             LV_COORD_MAX, flag);
+        }
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -849,7 +959,7 @@ static void draw_main(lv_event_t * e)
                                    lv_font_get_glyph_width(label_draw_dsc.font, ' ', ' ') * LV_LABEL_WAIT_CHAR_COUNT;
             label_draw_dsc.ofs_y = label->offset.y;
 
-            lv_draw_label(layer, &label_draw_dsc, &txt_coords);
+            draw_scroll_text(obj, layer, &label_draw_dsc, &txt_coords);
         }
 
         /*Draw the text again below the original to make a circular effect */
@@ -857,7 +967,7 @@ static void draw_main(lv_event_t * e)
             label_draw_dsc.ofs_x = label->offset.x;
             label_draw_dsc.ofs_y = label->offset.y + size.y + lv_font_get_line_height(label_draw_dsc.font);
 
-            lv_draw_label(layer, &label_draw_dsc, &txt_coords);
+            draw_scroll_text(obj, layer, &label_draw_dsc, &txt_coords);
         }
     }
 
@@ -896,9 +1006,15 @@ static void overwrite_anim_property(lv_anim_t * dest, const lv_anim_t * src, lv_
 static void lv_label_refr_text(lv_obj_t * obj)
 {
     lv_label_t * label = (lv_label_t *)obj;
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+    scroll_bitmap_free(obj);
+#endif
     if(label->text == NULL) return;
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
+#endif
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_invalidate(&label->lines);
 #endif
     label->invalid_size_cache = true;
 
@@ -913,7 +1029,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_point_t size;
     lv_text_flag_t flag = get_label_flags(label);
 
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    const lv_draw_label_lines_t * lines = get_lines(label, font, letter_space, max_w, flag);
+    if(lines) lv_draw_label_lines_get_size(lines, label->text, line_space, &size);
+    else lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1165,6 +1283,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+#if LV_LABEL_LINE_CACHE
+                lv_draw_label_lines_invalidate(&label->lines);
+#endif
             }
         }
     }
@@ -1197,6 +1318,10 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_invalidate(&label->lines);
+#endif
 }
 
 /**
@@ -1313,6 +1438,41 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
     return flag;
 }
 
+/**
+ * Get the line breaks of the label's text calculated with the given parameters.
+ * Recalculate them only if the text or the parameters have changed since the last call.
+ * @return  pointer to the lines or NULL if they can't be cached
+ */
+static const lv_draw_label_lines_t * get_lines(lv_label_t * label, const lv_font_t * font, int32_t letter_space,
+                                               int32_t max_w, lv_text_flag_t flag)
+{
+#if LV_LABEL_LINE_CACHE
+    /*Static texts can be modified without notifying the label so they are always measured*/
+    if(label->static_txt || label->text == NULL) return NULL;
+    if(!lv_draw_label_lines_update(&label->lines, label->text, font, letter_space, max_w, flag)) return NULL;
+    return &label->lines;
+#else
+    LV_UNUSED(label);
+    LV_UNUSED(font);
+    LV_UNUSED(letter_space);
+    LV_UNUSED(max_w);
+    LV_UNUSED(flag);
+    return NULL;
+#endif
+}
+
+/**
+ * Get the length of a line from the stored lines if available, else measure it.
+ */
+static uint32_t get_next_line(const lv_draw_label_lines_t * lines, uint32_t line_idx, const char * txt,
+                              uint32_t line_start, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                              lv_text_flag_t flag)
+{
+    if(lines) return lines->lines[line_idx + 1].start - line_start;
+
+    return lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+}
+
 /* Function created because of this pattern be used in multiple functions */
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
                                    const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords)
@@ -1330,4 +1490,354 @@ static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, con
     }
 }
 
+/**
+ * Draw the text of a scrolling label at its current offset.
+ * Use the pre-rendered bitmap of the text if possible, else draw it glyph by glyph.
+ */
+static void draw_scroll_text(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_label_dsc_t * dsc,
+                             const lv_area_t * txt_coords)
+{
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+    const lv_draw_buf_t * bitmap = get_scroll_bitmap(obj, dsc, txt_coords);
+    if(bitmap) {
+        lv_draw_image_dsc_t img_dsc;
+        lv_draw_image_dsc_init(&img_dsc);
+        img_dsc.src = bitmap;
+        img_dsc.opa = dsc->opa;
+        img_dsc.blend_mode = dsc->blend_mode;
+        img_dsc.recolor = dsc->color;
+        img_dsc.recolor_opa = LV_OPA_COVER;
+
+        /*The bitmap has a margin around the text for the overhanging glyphs*/
+        int32_t pad = lv_font_get_line_height(dsc->font) / 4;
+        lv_area_t coords;
+        coords.x1 = txt_coords->x1 + dsc->ofs_x - pad;
+        coords.y1 = txt_coords->y1 + dsc->ofs_y - pad;
+        coords.x2 = coords.x1 + bitmap->header.w - 1;
+        coords.y2 = coords.y1 + bitmap->header.h - 1;
+        lv_draw_image(layer, &img_dsc, &coords);
+        return;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+
+    lv_draw_label(layer, dsc, txt_coords);
+}
+
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+/**
+ * Get the text of a scrolling label rendered to an A8 bitmap. It's created on the first call
+ * and kept until the text or the style changes.
+ * @return  the bitmap or NULL if the text should be drawn glyph by glyph
+ */
+static const lv_draw_buf_t * get_scroll_bitmap(lv_obj_t * obj, const lv_draw_label_dsc_t * dsc,
+                                               const lv_area_t * txt_coords)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->scroll_bitmap) return label->scroll_bitmap;
+    if(label->scroll_bitmap_skip) return NULL;
+
+    /*Only if the text really scrolls. Static texts can be modified without notifying the label
+     *and the selected letters have other colors.*/
+    label->scroll_bitmap_skip = 1;
+    if(lv_anim_get(obj, set_ofs_x_anim) == NULL && lv_anim_get(obj, set_ofs_y_anim) == NULL) return NULL;
+    if(label->static_txt) return NULL;
+    if(dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL) return NULL;
+
+    lv_point_t size;
+    if(dsc->lines) lv_draw_label_lines_get_size(dsc->lines, dsc->text, dsc->line_space, &size);
+    else lv_text_get_size(&size, dsc->text, dsc->font, dsc->letter_space, dsc->line_space, LV_COORD_MAX, dsc->flag);
+
+    /*Center and right aligned texts are narrower than the label*/
+    int32_t text_w = dsc->align == LV_TEXT_ALIGN_LEFT ? size.x : LV_MAX(size.x, lv_area_get_width(txt_coords));
+    int32_t pad = lv_font_get_line_height(dsc->font) / 4;
+    int32_t w = text_w + 2 * pad;
+    int32_t h = size.y + 2 * pad;
+    if((int64_t)lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8) * h > LV_LABEL_SCROLL_BITMAP_SIZE) return NULL;
+
+    lv_draw_buf_t * bitmap = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(bitmap == NULL) return NULL;
+    lv_draw_buf_clear(bitmap, NULL);
+
+    lv_draw_label_dsc_t bitmap_dsc = *dsc;
+    bitmap_dsc.ofs_x = 0;
+    bitmap_dsc.ofs_y = 0;
+    bitmap_dsc.opa = LV_OPA_COVER;
+    bitmap_dsc.hint = NULL;
+
+    lv_area_t clip_area = {0, 0, w - 1, h - 1};
+    lv_area_t coords = {pad, pad, pad + text_w - 1, pad + size.y - 1};
+    scroll_bitmap_unit_t unit;
+    lv_memzero(&unit, sizeof(unit));
+    unit.base_unit.clip_area = &clip_area;
+    unit.bitmap = bitmap;
+    lv_draw_label_iterate_characters(&unit.base_unit, &bitmap_dsc, &coords, scroll_bitmap_glyph_cb);
+
+    if(unit.failed) {
+        lv_draw_buf_destroy(bitmap);
+        return NULL;
+    }
+
+    label->scroll_bitmap = bitmap;
+    label->scroll_bitmap_skip = 0;
+    return bitmap;
+}
+
+/**
+ * Add a glyph or a decoration line to the bitmap of a scrolling label.
+ * The bitmap's pixel coordinates are used as coordinates.
+ */
+static void scroll_bitmap_glyph_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                                   lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area)
+{
+    scroll_bitmap_unit_t * u = (scroll_bitmap_unit_t *)draw_unit;
+
+    const uint8_t * src = NULL;
+    uint32_t src_stride = 0;
+    lv_area_t area;
+    if(glyph_draw_dsc) {
+        switch(glyph_draw_dsc->format) {
+            case LV_FONT_GLYPH_FORMAT_A1:
+            case LV_FONT_GLYPH_FORMAT_A2:
+            case LV_FONT_GLYPH_FORMAT_A4:
+            case LV_FONT_GLYPH_FORMAT_A8: {
+                    const lv_draw_buf_t * glyph_buf = glyph_draw_dsc->glyph_data;
+                    src = glyph_buf->data;
+                    src_stride = glyph_buf->header.stride;
+                    area = *glyph_draw_dsc->letter_coords;
+                }
+                break;
+            default:
+                /*E.g. images, vector glyphs or placeholders*/
+                u->failed = true;
+                return;
+        }
+    }
+    else if(fill_draw_dsc) {
+        area = *fill_area;
+    }
+    else {
+        return;
+    }
+
+    lv_area_t clipped;
+    if(!lv_area_intersect(&clipped, &area, draw_unit->clip_area)) return;
+
+    lv_draw_buf_t * bitmap = u->bitmap;
+    int32_t w = lv_area_get_width(&clipped);
+    int32_t y;
+    for(y = clipped.y1; y <= clipped.y2; y++) {
+        uint8_t * dest = lv_draw_buf_goto_xy(bitmap, clipped.x1, y);
+        const uint8_t * src_line = src ? src + (y - area.y1) * src_stride + (clipped.x1 - area.x1) : NULL;
+        int32_t x;
+        for(x = 0; x < w; x++) {
+            /*Overlapping glyphs cover each other like when they are blended one by one*/
+            uint32_t a = src_line ? src_line[x] : LV_OPA_COVER;
+            dest[x] = (uint8_t)(dest[x] + a - LV_UDIV255(dest[x] * a));
+        }
+    }
+}
+
+static void scroll_bitmap_free(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->scroll_bitmap) {
+        lv_image_cache_drop(label->scroll_bitmap);
+        lv_draw_buf_destroy(label->scroll_bitmap);
+        label->scroll_bitmap = NULL;
+    }
+    label->scroll_bitmap_skip = 0;
+}
+#endif /*LV_LABEL_SCROLL_BITMAP_SIZE*/
+
+#if LV_LABEL_LINE_CACHE
+/**
+ * Move the text and the lines of a label to `change` to compare them with the new text later.
+ * Only if the position of the letters can be calculated from the stored lines, i.e. the text is
+ * wrapped or clipped without selection and decoration and the lines are valid with the current styles.
+ * @return  true: the old text and lines are moved to `change`; false: nothing has changed
+ */
+static bool text_change_start(lv_obj_t * obj, text_change_t * change)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(label->text == NULL || label->static_txt) return false;
+    if(label->long_mode != LV_LABEL_LONG_WRAP && label->long_mode != LV_LABEL_LONG_CLIP) return false;
+    if(lv_label_get_text_selection_start(obj) != LV_DRAW_LABEL_NO_TXT_SEL &&
+       lv_label_get_text_selection_end(obj) != LV_DRAW_LABEL_NO_TXT_SEL) return false;
+    if(lv_obj_get_style_text_decor(obj, LV_PART_MAIN) != LV_TEXT_DECOR_NONE) return false;
+
+    lv_area_t txt_coords;
+    lv_obj_get_content_coords(obj, &txt_coords);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    if(!lv_draw_label_lines_is_valid(&label->lines, font, letter_space, lv_area_get_width(&txt_coords),
+                                     get_label_flags(label))) {
+        return false;
+    }
+
+    change->text = label->text;
+    change->lines = label->lines;
+    label->text = NULL;
+    lv_memzero(&label->lines, sizeof(label->lines));
+    return true;
+}
+
+/**
+ * Refresh the label with its new text but invalidate only the glyphs which are different
+ * or at an other position than in the old text, then free the old text and lines.
+ * The letters are located the same way as `lv_draw_label_iterate_characters` draws them.
+ */
+static void refr_text_change(lv_obj_t * obj, text_change_t * change)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    /*Disable invalidations because lv_label_refr_text would invalidate the whole label.
+     *If the size changes the layout update will invalidate it anyway.*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    bool inv_enabled = lv_display_is_invalidation_enabled(disp);
+    lv_display_enable_invalidation(disp, false);
+    lv_label_refr_text(obj);
+    lv_display_enable_invalidation(disp, inv_enabled);
+
+    lv_area_t txt_coords;
+    lv_obj_get_content_coords(obj, &txt_coords);
+    int32_t w = lv_area_get_width(&txt_coords);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    int32_t line_height = lv_font_get_line_height(font) + lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    const lv_draw_label_lines_t * lines = get_lines(label, font, letter_space, w, get_label_flags(label));
+
+    lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
+    lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
+    lv_text_align_t old_align = align;
+    lv_base_dir_t old_base_dir = base_dir;
+    lv_bidi_calculate_align(&old_align, &old_base_dir, change->text);
+    if(lines) lv_bidi_calculate_align(&align, &base_dir, label->text);
+
+    /*With other lines or alignment every letter can move*/
+    if(lines == NULL || lines->line_cnt != change->lines.line_cnt || align != old_align || base_dir != old_base_dir) {
+        lv_obj_invalidate(obj);
+        lines = NULL;
+    }
+
+    if(label->long_mode == LV_LABEL_LONG_WRAP) lv_area_move(&txt_coords, 0, -lv_obj_get_scroll_top(obj));
+
+    uint32_t i;
+    for(i = 0; lines && i < lines->line_cnt; i++) {
+        const lv_draw_label_line_t * old_line = &change->lines.lines[i];
+        const lv_draw_label_line_t * new_line = &lines->lines[i];
+        uint32_t old_len = old_line[1].start - old_line[0].start;
+        uint32_t new_len = new_line[1].start - new_line[0].start;
+
+        int32_t old_x = txt_coords.x1 + label->offset.x;
+        int32_t new_x = old_x;
+        if(align == LV_TEXT_ALIGN_CENTER) {
+            old_x += (w - old_line->width) / 2;
+            new_x += (w - new_line->width) / 2;
+        }
+        else if(align == LV_TEXT_ALIGN_RIGHT) {
+            old_x += w - old_line->width;
+            new_x += w - new_line->width;
+        }
+
+#if LV_USE_BIDI
+        char * old_txt = lv_malloc(old_len + 1);
+        char * new_txt = lv_malloc(new_len + 1);
+        if(old_txt == NULL || new_txt == NULL) {
+            lv_free(old_txt);
+            lv_free(new_txt);
+            lv_obj_invalidate(obj);
+            break;
+        }
+        lv_bidi_process_paragraph(change->text + old_line->start, old_txt, old_len, base_dir, NULL, 0);
+        lv_bidi_process_paragraph(label->text + new_line->start, new_txt, new_len, base_dir, NULL, 0);
+#else
+        const char * old_txt = change->text + old_line->start;
+        const char * new_txt = label->text + new_line->start;
+#endif
+
+        /*Find the common beginning and end of the line*/
+        uint32_t common_len = LV_MIN(old_len, new_len);
+        uint32_t head = 0;
+        if(old_x == new_x) {
+            while(head < common_len && old_txt[head] == new_txt[head]) head++;
+        }
+        uint32_t tail = 0;
+        while(tail < common_len - head && old_txt[old_len - 1 - tail] == new_txt[new_len - 1 - tail]) tail++;
+#if LV_TXT_ENC == LV_TXT_ENC_UTF8
+        /*Don't split multi-byte letters*/
+        while(head > 0 && ((old_txt[head] & 0xC0) == 0x80 || (new_txt[head] & 0xC0) == 0x80)) head--;
+        while(tail > 0 && (old_txt[old_len - tail] & 0xC0) == 0x80) tail--;
+#endif
+
+        int32_t y = txt_coords.y1 + label->offset.y + (int32_t)i * line_height;
+        lv_area_t area;
+        lv_area_set(&area, LV_COORD_MAX, LV_COORD_MAX, LV_COORD_MIN, LV_COORD_MIN);
+        old_x = get_letters_area(old_txt, 0, head, old_x, y, font, letter_space, NULL);
+        new_x = get_letters_area(new_txt, 0, head, new_x, y, font, letter_space, NULL);
+        old_x = get_letters_area(old_txt, head, old_len - tail, old_x, y, font, letter_space, &area);
+        new_x = get_letters_area(new_txt, head, new_len - tail, new_x, y, font, letter_space, &area);
+
+        /*The common end needs to be redrawn only if it has moved*/
+        if(old_x != new_x) {
+            get_letters_area(old_txt, old_len - tail, old_len, old_x, y, font, letter_space, &area);
+            get_letters_area(new_txt, new_len - tail, new_len, new_x, y, font, letter_space, &area);
+        }
+
+        if(area.x1 <= area.x2) lv_obj_invalidate_area(obj, &area);
+
+#if LV_USE_BIDI
+        lv_free(old_txt);
+        lv_free(new_txt);
+#endif
+    }
+
+    lv_free(change->text);
+    lv_draw_label_lines_free(&change->lines);
+}
+
+/**
+ * Add the area of the glyphs of a line's letters to an area
+ * @param txt           the text of the line
+ * @param start         byte index of the first letter
+ * @param end           byte index after the last letter
+ * @param x             x coordinate of the first letter
+ * @param y             y coordinate of the line
+ * @param font          font of the text
+ * @param letter_space  letter space of the text
+ * @param area          the area to extend or NULL to only measure the letters
+ * @return              x coordinate of the letter at `end`
+ */
+static int32_t get_letters_area(const char * txt, uint32_t start, uint32_t end, int32_t x, int32_t y,
+                                const lv_font_t * font, int32_t letter_space, lv_area_t * area)
+{
+    uint32_t i = start;
+    while(i < end) {
+        uint32_t letter;
+        uint32_t letter_next;
+        lv_text_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+
+        if(area && !lv_text_is_marker(letter)) {
+            lv_font_glyph_dsc_t g;
+            lv_font_get_glyph_dsc(font, &g, letter, '\0');
+            if(g.box_w > 0 && g.box_h > 0) {
+                int32_t x1 = x + g.ofs_x;
+                int32_t y1 = y + (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+                area->x1 = LV_MIN(area->x1, x1);
+                area->y1 = LV_MIN(area->y1, y1);
+                area->x2 = LV_MAX(area->x2, x1 + g.box_w - 1);
+                area->y2 = LV_MAX(area->y2, y1 + g.box_h - 1);
+            }
+        }
+
+        int32_t letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+        if(letter_w > 0) x += letter_w + letter_space;
+    }
+
+    return x;
+}
+#endif /*LV_LABEL_LINE_CACHE*/
+
 #endif
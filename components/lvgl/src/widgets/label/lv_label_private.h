@@ -41,6 +41,14 @@ struct lv_label_t {
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_t lines;    /**< Line breaks of the text, recalculated if the text or the style changes */
+#endif
+
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+    lv_draw_buf_t * scroll_bitmap;  /**< A8 rendering of the text in the scrolling long modes */
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
@@ -53,6 +61,9 @@ struct lv_label_t {
     uint8_t expand : 1;                 /**< Ignore real width (used by the library with LV_LABEL_LONG_SCROLL) */
     uint8_t dot_tmp_alloc : 1;          /**< 1: dot is allocated, 0: dot directly holds up to 4 chars */
     uint8_t invalid_size_cache : 1;     /**< 1: Recalculate size and update cache */
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+    uint8_t scroll_bitmap_skip : 1;     /**< 1: The text can't be drawn from `scroll_bitmap` until it's refreshed */
+#endif
 };
 
 
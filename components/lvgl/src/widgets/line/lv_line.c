@@ -238,12 +238,32 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_draw_line_dsc_init(&line_dsc);
         lv_obj_init_draw_line_dsc(obj, LV_PART_MAIN, &line_dsc);
 
-        /*Read all points and draw the lines*/
+        /*Draw the lines in one pass unless they are dashed or the draw tasks are customized*/
         uint32_t i;
-        for(i = 0; i < line->point_num - 1; i++) {
-            int32_t w = lv_obj_get_width(obj);
-            int32_t h = lv_obj_get_height(obj);
+        int32_t w = lv_obj_get_width(obj);
+        int32_t h = lv_obj_get_height(obj);
+        lv_point_precise_t * points = NULL;
+        if(!(line_dsc.dash_width && line_dsc.dash_gap) && !lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+            points = lv_malloc(sizeof(lv_point_precise_t) * line->point_num);
+        }
+
+        if(points) {
+            for(i = 0; i < line->point_num; i++) {
+                points[i].x = resolve_point_coord(line->point_array.constant[i].x, w) + x_ofs;
+                points[i].y = resolve_point_coord(line->point_array.constant[i].y, h);
+                if(line->y_inv == 0) points[i].y = points[i].y + y_ofs;
+                else points[i].y = h - points[i].y + y_ofs;
+            }
 
+            line_dsc.points = points;
+            line_dsc.point_cnt = line->point_num;
+            lv_draw_polyline(layer, &line_dsc);
+            lv_free(points);
+            return;
+        }
+
+        /*Read all points and draw the lines*/
+        for(i = 0; i < line->point_num - 1; i++) {
             line_dsc.p1.x = resolve_point_coord(line->point_array.constant[i].x, w) + x_ofs;
             line_dsc.p1.y = resolve_point_coord(line->point_array.constant[i].y, h);
 
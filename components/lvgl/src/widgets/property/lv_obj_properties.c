@@ -14,7 +14,7 @@
  * Generated code from properties.py
  */
 /* *INDENT-OFF* */
-const lv_property_name_t lv_obj_property_names[73] = {
+const lv_property_name_t lv_obj_property_names[74] = {
     {"align",                  LV_PROPERTY_OBJ_ALIGN,},
     {"child_count",            LV_PROPERTY_OBJ_CHILD_COUNT,},
     {"content_height",         LV_PROPERTY_OBJ_CONTENT_HEIGHT,},
@@ -23,6 +23,7 @@ const lv_property_name_t lv_obj_property_names[73] = {
     {"event_count",            LV_PROPERTY_OBJ_EVENT_COUNT,},
     {"ext_draw_size",          LV_PROPERTY_OBJ_EXT_DRAW_SIZE,},
     {"flag_adv_hittest",       LV_PROPERTY_OBJ_FLAG_ADV_HITTEST,},
+    {"flag_cache_as_bitmap",   LV_PROPERTY_OBJ_FLAG_CACHE_AS_BITMAP,},
     {"flag_checkable",         LV_PROPERTY_OBJ_FLAG_CHECKABLE,},
     {"flag_click_focusable",   LV_PROPERTY_OBJ_FLAG_CLICK_FOCUSABLE,},
     {"flag_clickable",         LV_PROPERTY_OBJ_FLAG_CLICKABLE,},
@@ -37,10 +37,22 @@ test_options = {
     'OPTIONS_TEST_VG_LITE': 'VG-Lite simulator with full config, 32 bit color depth',
 }
 
+# Benchmarks which only print their results. They are run only if selected with --build-options.
+perf_options = {
+    'OPTIONS_PERF': 'Benchmarks with the test config, system heap, 32 bit color depth',
+}
+
+# The SSE2 blend backend needs a 64 bit x86 host
+if platform.machine().lower() in ('x86_64', 'amd64') and not os.getenv('NON_AMD64_BUILD'):
+    test_options['OPTIONS_TEST_SSE2'] = 'Test config, system heap, SSE2 blend backend, 32 bit color depth'
+    perf_options['OPTIONS_PERF_SSE2'] = 'Benchmarks with the test config, system heap, SSE2 blend backend, 32 bit color depth'
+
 
 def get_option_description(option_name):
     if option_name in build_only_options:
         return build_only_options[option_name]
+    if option_name in perf_options:
+        return perf_options[option_name]
     return test_options[option_name]
 
 
@@ -222,7 +234,7 @@ if __name__ == "__main__":
     parser = argparse.ArgumentParser(
         description='Build and/or run LVGL tests.', epilog=epilog)
     parser.add_argument('--build-options', nargs=1,
-                        choices=list(chain(build_only_options, test_options)),
+                        choices=list(chain(build_only_options, test_options, perf_options)),
                         help='''the build option name to build or run. When
                         omitted all build configurations are used.
                         ''')
@@ -254,8 +266,8 @@ if __name__ == "__main__":
             options_to_build = test_options
 
     for options_name in options_to_build:
-        is_test = options_name in test_options
-        build_type = 'Debug'
+        is_test = options_name in test_options or options_name in perf_options
+        build_type = 'Release' if options_name in perf_options else 'Debug'
         build_tests(options_name, build_type, args.clean)
         if is_test:
             try:
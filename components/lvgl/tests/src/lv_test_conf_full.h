@@ -2,7 +2,11 @@
 #define LV_TEST_CONF_FULL_H
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_SHADOW_CACHE_BYTES   (8 * 1024)
+#define LV_OBJ_BITMAP_CACHE_SIZE        (1024 * 1024)
+#define LV_LABEL_SCROLL_BITMAP_SIZE     (64 * 1024)
+#define LV_DRAW_LAYER_USE_RGB565A8      1
+#define LV_FONT_FMT_TXT_KERN_HASH       1
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
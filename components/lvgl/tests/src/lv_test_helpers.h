@@ -22,6 +22,10 @@ static inline size_t lv_test_get_free_mem(void)
 
 #define CANVAS_WIDTH_TO_STRIDE(w, px_size) ((((w) * (px_size) + (LV_DRAW_BUF_STRIDE_ALIGN - 1)) / LV_DRAW_BUF_STRIDE_ALIGN) * LV_DRAW_BUF_STRIDE_ALIGN)
 
+/* Colored arcs are drawn with an analytic rasteriser. The anti-aliasing of their angles' lines
+ * differs a little from the mask based rendering of the reference images. */
+#define LV_TEST_ARC_TOLERANCE   12
+
 void lv_test_wait(uint32_t ms);
 
 #endif /*LV_TEST_HELPERS_H*/
@@ -0,0 +1,54 @@
+#if LV_BUILD_TEST
+
+#include "lv_test_perf.h"
+#include <time.h>
+
+static uint32_t elapsed(uint64_t start, uint32_t rounds, uint64_t unit_per_sec)
+{
+    uint64_t ticks = (uint64_t)clock() - start;
+    return (uint32_t)(ticks * unit_per_sec / CLOCKS_PER_SEC / (rounds ? rounds : 1));
+}
+
+uint64_t lv_test_perf_start(void)
+{
+    return (uint64_t)clock();
+}
+
+uint32_t lv_test_perf_elapsed_us(uint64_t start, uint32_t rounds)
+{
+    return elapsed(start, rounds, 1000000);
+}
+
+uint32_t lv_test_perf_elapsed_ns(uint64_t start, uint32_t rounds)
+{
+    return elapsed(start, rounds, 1000000000);
+}
+
+uint32_t lv_test_perf_measure_us(lv_test_perf_cb_t cb, void * user_data, uint32_t rounds)
+{
+    uint64_t start = lv_test_perf_start();
+    uint32_t i;
+    for(i = 0; i < rounds; i++) cb(user_data);
+    return lv_test_perf_elapsed_us(start, rounds);
+}
+
+uint32_t lv_test_perf_measure_ns(lv_test_perf_cb_t cb, void * user_data, uint32_t rounds)
+{
+    uint64_t start = lv_test_perf_start();
+    uint32_t i;
+    for(i = 0; i < rounds; i++) cb(user_data);
+    return lv_test_perf_elapsed_ns(start, rounds);
+}
+
+uint32_t lv_test_perf_refr_us(lv_obj_t * obj, uint32_t rounds)
+{
+    uint64_t start = lv_test_perf_start();
+    uint32_t i;
+    for(i = 0; i < rounds; i++) {
+        lv_obj_invalidate(obj ? obj : lv_screen_active());
+        lv_refr_now(NULL);
+    }
+    return lv_test_perf_elapsed_us(start, rounds);
+}
+
+#endif
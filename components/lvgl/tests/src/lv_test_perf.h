@@ -0,0 +1,31 @@
+#ifndef LV_TEST_PERF_H
+#define LV_TEST_PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../lvgl.h"
+
+typedef void (*lv_test_perf_cb_t)(void * user_data);
+
+/* Get the CPU time to pass to `lv_test_perf_elapsed_us/ns` */
+uint64_t lv_test_perf_start(void);
+
+/* Average CPU time of `rounds` rounds since `start` in us and ns */
+uint32_t lv_test_perf_elapsed_us(uint64_t start, uint32_t rounds);
+uint32_t lv_test_perf_elapsed_ns(uint64_t start, uint32_t rounds);
+
+/* Call `cb` `rounds` times and return the average time of a call in us and ns */
+uint32_t lv_test_perf_measure_us(lv_test_perf_cb_t cb, void * user_data, uint32_t rounds);
+uint32_t lv_test_perf_measure_ns(lv_test_perf_cb_t cb, void * user_data, uint32_t rounds);
+
+/* Invalidate `obj` (the active screen if NULL) and refresh the display `rounds` times.
+ * Return the average time of a refresh in us */
+uint32_t lv_test_perf_refr_us(lv_obj_t * obj, uint32_t rounds);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEST_PERF_H*/
@@ -0,0 +1,56 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define CANVAS_SIZE 220
+
+static lv_draw_buf_t * canvas_buf;
+
+void setUp(void)
+{
+    canvas_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(canvas_buf);
+    canvas_buf = NULL;
+}
+
+static void draw_arcs_cb(void * canvas)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.center.x = CANVAS_SIZE / 2;
+    dsc.center.y = CANVAS_SIZE / 2;
+    dsc.color = lv_color_hex(0xff0000);
+    int32_t r;
+    for(r = 100; r > 10; r -= 15) {
+        dsc.radius = r;
+        dsc.width = r / 5 + 1;
+        dsc.start_angle = r;
+        dsc.end_angle = r * 3;
+        dsc.rounded = r % 2;
+        lv_draw_arc(&layer, &dsc);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+/*Time of drawing some arcs*/
+void test_arc_benchmark(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+
+    TEST_PRINTF("drawing arcs: %u us", lv_test_perf_measure_us(draw_arcs_cb, canvas, 50));
+}
+
+#endif
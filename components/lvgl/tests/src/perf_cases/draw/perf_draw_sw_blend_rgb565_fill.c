@@ -0,0 +1,112 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+/* The perf build uses LV_DRAW_SW_ASM_NONE, so the C fill and copy of the ESP32 are measured.*/
+
+#define MAX_W       240
+#define MAX_H       3
+#define GAP         5                           /*Extra pixels at the end of the rows if the stride is not w*/
+#define BUF_PX      ((MAX_W + GAP + 4) * MAX_H + 8)
+
+static uint64_t dest_buf64[BUF_PX / 4 + 1];     /*uint64_t to be 8 byte aligned*/
+static uint64_t src_buf64[BUF_PX / 4 + 1];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static uint16_t * get_buf(uint64_t * buf64, int32_t ofs)
+{
+    return (uint16_t *)buf64 + ofs;
+}
+
+static void init_fill_dsc(lv_draw_sw_blend_fill_dsc_t * dsc, lv_color_t color, int32_t ofs, int32_t w, int32_t h,
+                          int32_t stride_px)
+{
+    lv_memzero(dsc, sizeof(lv_draw_sw_blend_fill_dsc_t));
+    dsc->dest_buf = get_buf(dest_buf64, ofs);
+    dsc->dest_w = w;
+    dsc->dest_h = h;
+    dsc->dest_stride = stride_px * 2;
+    dsc->color = color;
+    dsc->opa = LV_OPA_COVER;
+}
+
+static void init_copy_dsc(lv_draw_sw_blend_image_dsc_t * dsc, int32_t ofs, int32_t w, int32_t h, int32_t stride_px)
+{
+    lv_memzero(dsc, sizeof(lv_draw_sw_blend_image_dsc_t));
+    dsc->dest_buf = get_buf(dest_buf64, ofs);
+    dsc->dest_w = w;
+    dsc->dest_h = h;
+    dsc->dest_stride = stride_px * 2;
+    dsc->src_buf = get_buf(src_buf64, ofs);
+    dsc->src_stride = stride_px * 2;
+    dsc->src_color_format = LV_COLOR_FORMAT_RGB565;
+    dsc->opa = LV_OPA_COVER;
+    dsc->blend_mode = LV_BLEND_MODE_NORMAL;
+}
+
+static void naive_fill_cb(void * user_data)
+{
+    lv_draw_sw_blend_fill_dsc_t * dsc = user_data;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest = dsc->dest_buf;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        for(x = 0; x < dsc->dest_w; x++) dest[x] = color16;
+        dest = (uint16_t *)((uint8_t *)dest + dsc->dest_stride);
+    }
+}
+
+static void fill_cb(void * user_data)
+{
+    lv_draw_sw_blend_color_to_rgb565(user_data);
+}
+
+static void copy_cb(void * user_data)
+{
+    lv_draw_sw_blend_image_to_rgb565(user_data);
+}
+
+/*Time of filling/copying MAX_H rows per call.
+ *"aligned" starts at an 8 byte boundary, "unaligned" 2 bytes after it.
+ *The rows have a gap at the end, so they are not merged to one.*/
+void test_rgb565_fill_benchmark(void)
+{
+    static const int32_t widths[] = {1, 2, 3, 4, 7, 8, 16, 31, 32, 64, 100, 128, 239, 240};
+    const uint32_t rounds = 20000;
+    lv_draw_sw_blend_fill_dsc_t fill_dsc;
+    lv_draw_sw_blend_image_dsc_t copy_dsc;
+    uint32_t i;
+    int32_t ofs;
+
+    for(i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+        for(ofs = 0; ofs < 2; ofs++) {
+            int32_t w = widths[i];
+            init_fill_dsc(&fill_dsc, lv_color_hex(0x3366cc), ofs, w, MAX_H, w + GAP);
+            uint32_t naive_ns = lv_test_perf_measure_ns(naive_fill_cb, &fill_dsc, rounds);
+            uint32_t fill_ns = lv_test_perf_measure_ns(fill_cb, &fill_dsc, rounds);
+            init_fill_dsc(&fill_dsc, lv_color_white(), ofs, w, MAX_H, w + GAP);
+            uint32_t memset_ns = lv_test_perf_measure_ns(fill_cb, &fill_dsc, rounds);
+            init_copy_dsc(&copy_dsc, ofs, w, MAX_H, w + GAP);
+            uint32_t copy_ns = lv_test_perf_measure_ns(copy_cb, &copy_dsc, rounds);
+
+            TEST_PRINTF("w: %d, %s: naive fill %u ns, fill %u ns, fill 0xFFFF %u ns, copy %u ns",
+                        w, ofs ? "unaligned" : "aligned", naive_ns, fill_ns, memset_ns, copy_ns);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,112 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+/* OPTIONS_PERF_SSE2 measures the SSE2 blend functions, OPTIONS_PERF the C functions they replace.*/
+
+#define MAX_W       67
+#define MAX_H       5
+#define BUF_STRIDE  ((MAX_W + 3) * 4)
+#define BUF_SIZE    (BUF_STRIDE * MAX_H)
+
+static uint8_t src_buf[BUF_SIZE];
+static uint8_t dest_buf[BUF_SIZE];
+static lv_opa_t mask_buf[MAX_W * MAX_H];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/*Have some opaque and transparent areas in the source and the mask too*/
+static void fill_bufs(void)
+{
+    uint32_t rnd = 0x12345678;
+    uint32_t i;
+    for(i = 0; i < BUF_SIZE; i++) {
+        rnd = rnd * 1103515245 + 12345;
+        src_buf[i] = (uint8_t)(rnd >> 16);
+        dest_buf[i] = (uint8_t)(rnd >> 8);
+        if((i & 3) == 3 && (i & 0x40)) src_buf[i] = (i & 0x80) ? LV_OPA_COVER : LV_OPA_TRANSP;
+    }
+
+    for(i = 0; i < sizeof(mask_buf); i++) {
+        rnd = rnd * 1103515245 + 12345;
+        if((rnd >> 16) & 3) mask_buf[i] = i % 16 < 8 ? 0xFF : 0x00;
+        else mask_buf[i] = (lv_opa_t)(rnd >> 8);
+    }
+}
+
+/*Start from the second pixel to measure the unaligned cases*/
+static void init_image_dsc(lv_draw_sw_blend_image_dsc_t * dsc, int32_t dest_px_size)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest_buf + dest_px_size;
+    dsc->dest_w = MAX_W;
+    dsc->dest_h = MAX_H;
+    dsc->dest_stride = BUF_STRIDE;
+    dsc->src_buf = src_buf + 4;
+    dsc->src_stride = BUF_STRIDE - 4;
+    dsc->src_color_format = LV_COLOR_FORMAT_ARGB8888;
+    dsc->opa = LV_OPA_COVER;
+    dsc->mask_buf = mask_buf;
+    dsc->mask_stride = MAX_W;
+    dsc->blend_mode = LV_BLEND_MODE_NORMAL;
+}
+
+static void image_to_rgb565_cb(void * dsc)
+{
+    lv_draw_sw_blend_image_to_rgb565(dsc);
+}
+
+static void image_to_argb8888_cb(void * dsc)
+{
+    lv_draw_sw_blend_image_to_argb8888(dsc);
+}
+
+static void color_to_rgb565_cb(void * dsc)
+{
+    lv_draw_sw_blend_color_to_rgb565(dsc);
+}
+
+/*Time of blending 67x5 pixels with a mask*/
+void test_sse2_benchmark(void)
+{
+    const uint32_t rounds = 2000;
+    lv_draw_sw_blend_image_dsc_t img_dsc;
+    lv_draw_sw_blend_fill_dsc_t fill_dsc;
+
+    fill_bufs();
+
+    init_image_dsc(&img_dsc, 2);
+    uint32_t to_rgb565_ns = lv_test_perf_measure_ns(image_to_rgb565_cb, &img_dsc, rounds);
+
+    init_image_dsc(&img_dsc, 4);
+    uint32_t to_argb8888_ns = lv_test_perf_measure_ns(image_to_argb8888_cb, &img_dsc, rounds);
+
+    lv_memzero(&fill_dsc, sizeof(fill_dsc));
+    fill_dsc.dest_buf = dest_buf + 2;
+    fill_dsc.dest_w = MAX_W;
+    fill_dsc.dest_h = MAX_H;
+    fill_dsc.dest_stride = BUF_STRIDE;
+    fill_dsc.color = lv_color_hex(0x3366cc);
+    fill_dsc.opa = LV_OPA_COVER;
+    fill_dsc.mask_buf = mask_buf;
+    fill_dsc.mask_stride = MAX_W;
+    uint32_t color_ns = lv_test_perf_measure_ns(color_to_rgb565_cb, &fill_dsc, rounds);
+
+    TEST_PRINTF("%s: ARGB8888 -> RGB565 %u ns, ARGB8888 -> ARGB8888 %u ns, color -> RGB565 %u ns",
+                LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 ? "SSE2" : "C", to_rgb565_ns, to_argb8888_ns, color_ns);
+}
+
+#endif
@@ -0,0 +1,51 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define shadow_cache_p (LV_GLOBAL_DEFAULT()->sw_shadow_cache)
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    lv_cache_drop_all(shadow_cache_p, NULL);
+    lv_cache_set_max_size(shadow_cache_p, LV_DRAW_SW_SHADOW_CACHE_BYTES, NULL);
+#endif
+}
+
+/*Refresh time of some cards with shadow with and without the cache*/
+void test_box_shadow_cache_benchmark(void)
+{
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_pos(obj, 30 + (i % 3) * 250, 30 + (i / 3) * 200);
+        lv_obj_set_size(obj, 200, 120);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_color_white(), 0);
+        lv_obj_set_style_radius(obj, 12, 0);
+        lv_obj_set_style_shadow_width(obj, 20, 0);
+        lv_obj_set_style_shadow_offset_y(obj, 4, 0);
+    }
+
+    uint32_t cached_us = lv_test_perf_refr_us(NULL, 20);
+
+    lv_cache_drop_all(shadow_cache_p, NULL);
+    lv_cache_set_max_size(shadow_cache_p, 0, NULL);
+    uint32_t not_cached_us = lv_test_perf_refr_us(NULL, 20);
+
+    TEST_PRINTF("refresh with shadow cache: %u us, without: %u us", cached_us, not_cached_us);
+#endif
+}
+
+#endif
@@ -0,0 +1,92 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GLYPH_RUN
+
+#define CANVAS_W    400
+#define CANVAS_H    300
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * draw_buf;
+
+void setUp(void)
+{
+    draw_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(draw_buf);
+}
+
+static lv_draw_unit_t * get_sw_unit(void)
+{
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u && lv_draw_sw_get_sw_unit(u) == NULL) u = u->next;
+    TEST_ASSERT_NOT_NULL(u);
+    return u;
+}
+
+/*Draw directly with a software draw unit (glyph run) or with an other draw unit (glyphs one by one)*/
+static void draw_label(lv_draw_unit_t * unit, lv_layer_t * layer, const lv_draw_label_dsc_t * dsc,
+                       const lv_area_t * coords, const lv_area_t * clip)
+{
+    lv_layer_t * target_layer_ori = unit->target_layer;
+    const lv_area_t * clip_area_ori = unit->clip_area;
+    unit->target_layer = layer;
+    unit->clip_area = clip;
+    lv_draw_sw_label(unit, dsc, coords);
+    unit->target_layer = target_layer_ori;
+    unit->clip_area = clip_area_ori;
+}
+
+static uint32_t bench_us(lv_draw_unit_t * unit, const lv_font_t * font, uint32_t rounds)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = font;
+    dsc.text = "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Cras malesuada ultrices magna in rutrum. "
+               "Suspendisse potenti. Aenean tincidunt, lorem eget efficitur porta, mi nisl dapibus leo, "
+               "sed gravida enim erat quis metus. Nulla facilisi. Curabitur sit amet ex vitae nunc.";
+    lv_area_t coords = {0, 0, 239, CANVAS_H - 1};
+    lv_area_t clip = coords;
+
+    uint64_t start = lv_test_perf_start();
+    uint32_t i;
+    for(i = 0; i < rounds; i++) {
+        draw_label(unit, &layer, &dsc, &coords, &clip);
+    }
+    return lv_test_perf_elapsed_us(start, rounds);
+}
+
+/*Time of drawing a paragraph to RGB565 with the glyphs blended one by one and line by line*/
+void test_draw_sw_glyph_run_benchmark(void)
+{
+    const lv_font_t * fonts[] = {&lv_font_montserrat_12, &lv_font_montserrat_14, &lv_font_montserrat_20, &lv_font_montserrat_28};
+    const int32_t sizes[] = {12, 14, 20, 28};
+
+    lv_draw_unit_t other_unit;
+    lv_memzero(&other_unit, sizeof(other_unit));
+    lv_draw_unit_t * sw_unit = get_sw_unit();
+
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        uint32_t glyphs_us = bench_us(&other_unit, fonts[i], 200);
+        uint32_t run_us = bench_us(sw_unit, fonts[i], 200);
+        TEST_PRINTF("montserrat %d: glyphs %u us, glyph run %u us", (int)sizes[i], glyphs_us, run_us);
+    }
+}
+
+#endif
+
+#endif
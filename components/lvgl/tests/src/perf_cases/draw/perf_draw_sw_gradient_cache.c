@@ -0,0 +1,51 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->sw_grad_cache)
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    lv_cache_drop_all(grad_cache_p, NULL);
+    lv_cache_set_max_size(grad_cache_p, LV_DRAW_SW_GRADIENT_CACHE_SIZE, NULL);
+#endif
+}
+
+/*Refresh time of 3 gradient widgets with and without the cache*/
+void test_gradient_cache_benchmark(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    static const uint32_t colors[][2] = {{0xff0000, 0x0000ff}, {0x00ff00, 0xffff00}, {0x00ffff, 0x000000}};
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, 240, 100);
+        lv_obj_set_y(obj, i * 110);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_color_hex(colors[i][0]), 0);
+        lv_obj_set_style_bg_grad_color(obj, lv_color_hex(colors[i][1]), 0);
+        lv_obj_set_style_bg_grad_dir(obj, i == 1 ? LV_GRAD_DIR_HOR : LV_GRAD_DIR_VER, 0);
+    }
+
+    uint32_t cached_us = lv_test_perf_refr_us(NULL, 50);
+
+    lv_cache_drop_all(grad_cache_p, NULL);
+    lv_cache_set_max_size(grad_cache_p, 0, NULL);
+    uint32_t not_cached_us = lv_test_perf_refr_us(NULL, 50);
+
+    TEST_PRINTF("refresh with gradient cache: %u us, without: %u us", cached_us, not_cached_us);
+#endif
+}
+
+#endif
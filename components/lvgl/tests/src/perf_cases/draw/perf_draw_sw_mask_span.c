@@ -0,0 +1,53 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Refresh time of large rounded rectangles, arcs and images with rounded clip area*/
+void test_mask_span_benchmark(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_pos(obj, 20 + (i % 2) * 390, 20 + (i / 2) * 150);
+        lv_obj_set_size(obj, 370, 130);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+        lv_obj_set_style_radius(obj, 40, 0);
+    }
+
+    for(i = 0; i < 2; i++) {
+        lv_obj_t * arc = lv_arc_create(scr);
+        lv_obj_set_pos(arc, 20 + i * 180, 320);
+        lv_obj_set_size(arc, 150, 150);
+        lv_obj_set_style_arc_width(arc, 30 / (i + 1), 0);
+        lv_obj_set_style_arc_width(arc, 30 / (i + 1), LV_PART_INDICATOR);
+        lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
+        lv_arc_set_value(arc, 70);
+
+        lv_obj_t * img = lv_image_create(scr);
+        lv_obj_set_pos(img, 400 + i * 150, 330);
+        lv_image_set_src(img, &test_image_cogwheel_rgb565);
+        lv_obj_set_style_radius(img, i == 0 ? 40 : LV_RADIUS_CIRCLE, 0);
+    }
+
+    TEST_PRINTF("refresh of masked widgets: %u us", lv_test_perf_refr_us(NULL, 20));
+}
+
+#endif
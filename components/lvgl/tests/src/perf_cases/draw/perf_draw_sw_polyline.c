@@ -0,0 +1,70 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * create_chart(uint32_t series_cnt)
+{
+    static const lv_color_t colors[] = {LV_COLOR_MAKE(0xff, 0, 0), LV_COLOR_MAKE(0, 0xa0, 0), LV_COLOR_MAKE(0, 0, 0xff), LV_COLOR_MAKE(0, 0, 0)};
+
+    lv_obj_t * chart = lv_chart_create(lv_screen_active());
+    lv_obj_set_size(chart, 320, 240);
+    lv_chart_set_point_count(chart, 240);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);
+
+    uint32_t i;
+    for(i = 0; i < series_cnt; i++) {
+        lv_chart_series_t * ser = lv_chart_add_series(chart, colors[i], LV_CHART_AXIS_PRIMARY_Y);
+        uint32_t j;
+        for(j = 0; j < 240; j++) {
+            lv_chart_set_next_value(chart, ser, (int32_t)((lv_trigo_sin((int16_t)(j * (3 + i) + i * 40)) + 32768) * 100 / 65536));
+        }
+    }
+    return chart;
+}
+
+/*Time of updating a chart with a new value per series*/
+void test_polyline_chart_benchmark(void)
+{
+    uint32_t series_cnt;
+    for(series_cnt = 1; series_cnt <= 4; series_cnt++) {
+        uint32_t mode;
+        for(mode = 0; mode < 2; mode++) {
+            lv_obj_t * chart = create_chart(series_cnt);
+            /*Draw tasks which can be customized are still created for each segment*/
+            if(mode == 1) lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+            lv_refr_now(NULL);
+
+            const uint32_t rounds = 30;
+            uint64_t start = lv_test_perf_start();
+            uint32_t i;
+            for(i = 0; i < rounds; i++) {
+                lv_chart_series_t * ser = lv_chart_get_series_next(chart, NULL);
+                while(ser) {
+                    lv_chart_set_next_value(chart, ser, (int32_t)(i * 7 % 100));
+                    ser = lv_chart_get_series_next(chart, ser);
+                }
+                lv_refr_now(NULL);
+            }
+            TEST_PRINTF("chart with %d series, %s: %u us", (int)series_cnt, mode == 0 ? "polyline" : "lines",
+                        lv_test_perf_elapsed_us(start, rounds));
+
+            lv_obj_delete(chart);
+        }
+    }
+}
+
+#endif
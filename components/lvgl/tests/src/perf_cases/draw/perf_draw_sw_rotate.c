@@ -0,0 +1,82 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+/*A 320x80 partial buffer of a 240x320 display in landscape*/
+#define BUF_W   320
+#define BUF_H   80
+
+typedef struct {
+    uint8_t * src;
+    uint8_t * dst;
+    lv_color_format_t cf;
+} rotate_ctx_t;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/*Rotate by 90 degrees pixel by pixel, walking the columns of the source*/
+static void rotate_naive_cb(void * user_data)
+{
+    rotate_ctx_t * ctx = user_data;
+    uint32_t px_size = lv_color_format_get_size(ctx->cf);
+    int32_t x, y;
+    for(x = 0; x < BUF_W; x++) {
+        uint8_t * d = ctx->dst + (BUF_W - x - 1) * BUF_H * px_size;
+        for(y = 0; y < BUF_H; y++) {
+            const uint8_t * s = ctx->src + (y * BUF_W + x) * px_size;
+            if(px_size == 1) *d = *s;
+            else if(px_size == 2) *(uint16_t *)d = *(const uint16_t *)s;
+            else if(px_size == 4) *(uint32_t *)d = *(const uint32_t *)s;
+            else {
+                d[0] = s[0];
+                d[1] = s[1];
+                d[2] = s[2];
+            }
+            d += px_size;
+        }
+    }
+}
+
+static void rotate_cb(void * user_data)
+{
+    rotate_ctx_t * ctx = user_data;
+    uint32_t px_size = lv_color_format_get_size(ctx->cf);
+    lv_draw_sw_rotate(ctx->src, ctx->dst, BUF_W, BUF_H, BUF_W * px_size, BUF_H * px_size, LV_DISPLAY_ROTATION_90, ctx->cf);
+}
+
+/*Time of rotating a partial buffer pixel by pixel and with `lv_draw_sw_rotate`*/
+void test_rotate_benchmark(void)
+{
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_L8, LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_ARGB8888};
+    rotate_ctx_t ctx;
+    ctx.src = lv_malloc(BUF_W * BUF_H * 4);
+    ctx.dst = lv_malloc(BUF_W * BUF_H * 4);
+    TEST_ASSERT_NOT_NULL(ctx.src);
+    TEST_ASSERT_NOT_NULL(ctx.dst);
+    lv_memset(ctx.src, 0x55, BUF_W * BUF_H * 4);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        ctx.cf = cfs[i];
+        uint32_t naive_us = lv_test_perf_measure_us(rotate_naive_cb, &ctx, 200);
+        uint32_t rotate_us = lv_test_perf_measure_us(rotate_cb, &ctx, 200);
+        TEST_PRINTF("rotating %d bpp by 90 degrees: pixel by pixel %u us, lv_draw_sw_rotate %u us",
+                    (int)lv_color_format_get_size(cfs[i]) * 8, naive_us, rotate_us);
+    }
+
+    lv_free(ctx.src);
+    lv_free(ctx.dst);
+}
+
+#endif
@@ -0,0 +1,89 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+/*A portrait panel used in landscape orientation with about 1/4 screen sized partial buffer.
+ *64 landscape rows keep the stride aligned in both orientations for a fair comparison.*/
+#define PANEL_HOR_RES   240
+#define PANEL_VER_RES   320
+#define BUF_SIZE        (PANEL_VER_RES * 64 * 2)
+
+static uint8_t draw_buf_mem[BUF_SIZE + LV_DRAW_BUF_ALIGN];
+static uint8_t rotated_buf_mem[(64 * 2 + LV_DRAW_BUF_STRIDE_ALIGN) * PANEL_VER_RES + LV_DRAW_BUF_ALIGN];
+
+static lv_display_t * disp;
+static lv_display_t * disp_ori;
+
+/*Rotate the rendered area as the drivers do without rotated rendering*/
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    if(!lv_display_get_rotated_rendering(d)) {
+        int32_t w = lv_area_get_width(area);
+        int32_t h = lv_area_get_height(area);
+        lv_draw_sw_rotate(px_map, lv_draw_buf_align(rotated_buf_mem, LV_COLOR_FORMAT_RGB565), w, h,
+                          lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565),
+                          lv_draw_buf_width_to_stride(h, LV_COLOR_FORMAT_RGB565),
+                          LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_RGB565);
+    }
+
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    disp_ori = lv_display_get_default();
+    disp = lv_display_create(PANEL_HOR_RES, PANEL_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf_mem, LV_COLOR_FORMAT_RGB565), NULL,
+                           BUF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+    lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_90);
+}
+
+void tearDown(void)
+{
+    lv_display_set_default(disp_ori);
+    lv_display_delete(disp);
+    disp = NULL;
+}
+
+/*Time of refreshing a landscape screen*/
+void test_rotated_render_benchmark(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_BLUE, 4), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_palette_darken(LV_PALETTE_BLUE, 2), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_HOR, 0);
+
+    lv_obj_t * btn = lv_button_create(scr);
+    lv_obj_set_pos(btn, 10, 10);
+    lv_obj_set_size(btn, 140, 50);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Rotated button");
+    lv_obj_center(label);
+
+    lv_obj_t * arc = lv_arc_create(scr);
+    lv_obj_set_pos(arc, 170, 10);
+    lv_obj_set_size(arc, 130, 130);
+    lv_arc_set_value(arc, 70);
+
+    lv_obj_t * img = lv_image_create(scr);
+    lv_image_set_src(img, &test_image_cogwheel_rgb565);
+    lv_obj_set_pos(img, 20, 120);
+    lv_image_set_rotation(img, 300);
+
+    uint32_t mode;
+    for(mode = 0; mode < 2; mode++) {
+        lv_display_set_rotated_rendering(disp, mode == 1);
+        TEST_PRINTF("landscape refresh, %s: %u us", mode == 0 ? "render + lv_draw_sw_rotate" : "rotated rendering",
+                    lv_test_perf_refr_us(NULL, 20));
+    }
+}
+
+#endif
@@ -0,0 +1,57 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Time of rendering zoomed and rotated image widgets*/
+void test_transform_benchmark(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+
+    static const struct {
+        const char * name;
+        int32_t rotation;
+        int32_t scale;
+        bool aa;
+    } cases[] = {
+        {"rotated by 30 degrees", 300, LV_SCALE_NONE, true},
+        {"zoomed to 150%", 0, 384, true},
+        {"zoomed to 200%", 0, 512, true},
+        {"zoomed to 200% without anti-aliasing", 0, 512, false},
+        {"rotated by 90 degrees", 900, LV_SCALE_NONE, true},
+        {"rotated by 180 degrees", 1800, LV_SCALE_NONE, true},
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        uint32_t j;
+        for(j = 0; j < 2; j++) {
+            lv_obj_t * img = lv_image_create(lv_screen_active());
+            lv_image_set_src(img, j == 0 ? &test_image_cogwheel_argb8888 : &test_image_cogwheel_rgb565);
+            lv_obj_center(img);
+            lv_image_set_rotation(img, cases[i].rotation);
+            lv_image_set_scale(img, cases[i].scale);
+            lv_image_set_antialias(img, cases[i].aa);
+
+            TEST_PRINTF("%s image %s: %u us", j == 0 ? "ARGB8888" : "RGB565", cases[i].name,
+                        lv_test_perf_refr_us(img, 50));
+
+            lv_obj_delete(img);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,76 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define CANVAS_SIZE 200
+
+static lv_draw_buf_t * canvas_buf;
+
+void setUp(void)
+{
+    canvas_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(canvas_buf);
+    canvas_buf = NULL;
+}
+
+static void draw_triangles_cb(void * canvas)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_triangle_dsc_t dsc;
+    lv_draw_triangle_dsc_init(&dsc);
+    dsc.bg_color = lv_color_black();
+    dsc.bg_grad.stops[0].color = lv_palette_main(LV_PALETTE_RED);
+    dsc.bg_grad.stops[0].opa = LV_OPA_COVER;
+    dsc.bg_grad.stops[1].color = lv_palette_main(LV_PALETTE_BLUE);
+    dsc.bg_grad.stops[1].opa = LV_OPA_20;
+
+    /*Needles*/
+    int32_t i;
+    for(i = 0; i < 36; i++) {
+        int32_t angle = i * 10;
+        int32_t dx = lv_trigo_sin(angle) * 4 / LV_TRIGO_SIN_MAX;
+        int32_t dy = -lv_trigo_cos(angle) * 4 / LV_TRIGO_SIN_MAX;
+        dsc.p[0].x = 100 - dx;
+        dsc.p[0].y = 100 - dy;
+        dsc.p[1].x = 100 + dx;
+        dsc.p[1].y = 100 + dy;
+        dsc.p[2].x = 100 + lv_trigo_cos(angle) * 90 / LV_TRIGO_SIN_MAX;
+        dsc.p[2].y = 100 + lv_trigo_sin(angle) * 90 / LV_TRIGO_SIN_MAX;
+        lv_draw_triangle(&layer, &dsc);
+    }
+
+    /*The areas below the lines of a chart*/
+    dsc.bg_grad.dir = LV_GRAD_DIR_VER;
+    for(i = 0; i < 10; i++) {
+        dsc.p[0].x = i * 20;
+        dsc.p[0].y = 150 + (i % 3) * 10;
+        dsc.p[1].x = i * 20 + 20;
+        dsc.p[1].y = 150 + ((i + 1) % 3) * 10;
+        dsc.p[2].x = i * 20;
+        dsc.p[2].y = 199;
+        lv_draw_triangle(&layer, &dsc);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+/*Time of drawing some triangles*/
+void test_triangle_benchmark(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+
+    TEST_PRINTF("drawing triangles: %u us", lv_test_perf_measure_us(draw_triangles_cb, canvas, 50));
+}
+
+#endif
@@ -0,0 +1,115 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define MAX_GLYPH_CNT   128
+
+static const char * text =
+    "AVATAR WAVY Towel, LT Yoyo. The quick brown fox jumps over the lazy dog. "
+    "Typography \"quoted\", F.A.T. Wolf; P.J. Yvonne, Tw Te Ty Vo We Yo, AV AW AY LT LV LW LY.";
+
+static uint16_t pair_ids[MAX_GLYPH_CNT * MAX_GLYPH_CNT * 2];
+static int8_t pair_values[MAX_GLYPH_CNT * MAX_GLYPH_CNT];
+static lv_font_fmt_txt_kern_pair_t kern_pairs;
+static lv_font_fmt_txt_dsc_t pair_dsc;
+static lv_font_t pair_font;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/*Create a copy of a font with the kerning classes of its first cmap's glyphs converted to sorted pairs*/
+static const lv_font_t * create_pair_font(const lv_font_t * class_font, bool ids_16)
+{
+    const lv_font_fmt_txt_dsc_t * class_dsc = class_font->dsc;
+    const lv_font_fmt_txt_kern_classes_t * kern_classes = class_dsc->kern_dsc;
+    uint32_t glyph_cnt = class_dsc->cmaps[0].range_length + 1;
+    TEST_ASSERT_EQUAL(1, class_dsc->kern_classes);
+    TEST_ASSERT_LESS_OR_EQUAL(MAX_GLYPH_CNT, glyph_cnt);
+
+    uint8_t * pair_ids_8 = (uint8_t *)pair_ids;
+    uint32_t cnt = 0;
+    uint32_t left;
+    uint32_t right;
+    for(left = 1; left < glyph_cnt; left++) {
+        for(right = 1; right < glyph_cnt; right++) {
+            uint8_t left_class = kern_classes->left_class_mapping[left];
+            uint8_t right_class = kern_classes->right_class_mapping[right];
+            if(left_class == 0 || right_class == 0) continue;
+
+            int8_t value = kern_classes->class_pair_values[(left_class - 1) * kern_classes->right_class_cnt +
+                                                                             (right_class - 1)];
+            if(value == 0) continue;
+
+            if(ids_16) {
+                pair_ids[cnt * 2] = (uint16_t)left;
+                pair_ids[cnt * 2 + 1] = (uint16_t)right;
+            }
+            else {
+                pair_ids_8[cnt * 2] = (uint8_t)left;
+                pair_ids_8[cnt * 2 + 1] = (uint8_t)right;
+            }
+            pair_values[cnt] = value;
+            cnt++;
+        }
+    }
+
+    lv_memzero(&kern_pairs, sizeof(kern_pairs));
+    kern_pairs.glyph_ids = pair_ids;
+    kern_pairs.values = pair_values;
+    kern_pairs.pair_cnt = cnt;
+    kern_pairs.glyph_ids_size = ids_16 ? 1 : 0;
+
+    pair_dsc = *class_dsc;
+    pair_dsc.kern_dsc = &kern_pairs;
+    pair_dsc.kern_classes = 0;
+
+    pair_font = *class_font;
+    pair_font.dsc = &pair_dsc;
+
+    return &pair_font;
+}
+
+static void measure_text_cb(void * font)
+{
+    lv_point_t size;
+    lv_text_get_size(&size, text, font, 0, 0, 240, LV_TEXT_FLAG_NONE);
+}
+
+/*Time of measuring a paragraph with kerning classes, sorted pairs and hashed pairs*/
+void test_font_fmt_txt_kern_benchmark(void)
+{
+    const lv_font_t * fonts[] = {
+        &lv_font_montserrat_12, &lv_font_montserrat_14, &lv_font_montserrat_16, &lv_font_montserrat_20,
+        &lv_font_montserrat_28, &lv_font_montserrat_48
+    };
+    const int32_t sizes[] = {12, 14, 16, 20, 28, 48};
+    const uint32_t rounds = 2000;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        uint32_t class_ns = lv_test_perf_measure_ns(measure_text_cb, (void *)fonts[i], rounds);
+
+        const lv_font_t * font = create_pair_font(fonts[i], false);
+        uint32_t bsearch_ns = lv_test_perf_measure_ns(measure_text_cb, (void *)font, rounds);
+
+        kern_pairs.hash = lv_font_fmt_txt_kern_hash_create(&kern_pairs);
+        uint32_t hash_ns = lv_test_perf_measure_ns(measure_text_cb, (void *)font, rounds);
+        lv_font_fmt_txt_kern_hash_delete((lv_font_fmt_txt_kern_hash_t *)kern_pairs.hash);
+        kern_pairs.hash = NULL;
+
+        TEST_PRINTF("montserrat %d (%d pairs): classes %u ns, pairs binary search %u ns, pairs hash %u ns",
+                    sizes[i], (int)kern_pairs.pair_cnt, class_ns, bsearch_ns, hash_ns);
+    }
+}
+
+#endif
@@ -0,0 +1,76 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include "lv_test_perf.h"
+
+/* font binary converted to a plain C array */
+extern uint8_t const test_font_1_buf[6876];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Memory usage and the load time of the binary fonts and the time of drawing a label for the first time with them*/
+void test_font_loader_benchmark(void)
+{
+    const char * names[] = {"from file", "from buffer", "mapped", "streamed"};
+
+    /* simulate a memory mapped font file with an aligned copy of the font binary */
+    void * mapped = lv_malloc(sizeof(test_font_1_buf));
+    TEST_ASSERT_NOT_NULL(mapped);
+    lv_memcpy(mapped, test_font_1_buf, sizeof(test_font_1_buf));
+
+    uint32_t i;
+    for(i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        size_t free_before = lv_test_get_free_mem();
+        uint64_t start = lv_test_perf_start();
+        lv_font_t * font = NULL;
+        switch(i) {
+            case 0:
+                font = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+                break;
+            case 1:
+                font = lv_binfont_create_from_buffer((void *)test_font_1_buf, sizeof(test_font_1_buf));
+                break;
+            case 2:
+                font = lv_binfont_create_from_mapped(mapped, sizeof(test_font_1_buf));
+                break;
+            case 3:
+                font = lv_binfont_create_streamed("A:src/test_assets/test_font_1.fnt", 256, 4);
+                break;
+        }
+        uint32_t load_us = lv_test_perf_elapsed_us(start, 1);
+        TEST_ASSERT_NOT_NULL(font);
+        uint32_t used = (uint32_t)(free_before - lv_test_get_free_mem());
+
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_label_set_text(label, "The quick brown fox jumped over the lazy dog");
+        start = lv_test_perf_start();
+        lv_refr_now(NULL);
+        uint32_t draw_us = lv_test_perf_elapsed_us(start, 1);
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+        TEST_PRINTF("%s: %u bytes, load %u us, first draw %u us", names[i], used, load_us, draw_us);
+#else
+        LV_UNUSED(used);
+        TEST_PRINTF("%s: load %u us, first draw %u us", names[i], load_us, draw_us);
+#endif
+
+        lv_obj_delete(label);
+        lv_binfont_destroy(font);
+    }
+    lv_free(mapped);
+}
+
+#endif
@@ -0,0 +1,78 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+/*The same text as in test_cases/test_font_subset.c, so its characters are in the subset*/
+static const char * text =
+    "Testar teatar!\nESP32->ili9341\n"
+    "Press me, temperature: 21.5 \xC2\xB0" "C " LV_SYMBOL_OK;
+
+LV_FONT_DECLARE(test_font_montserrat_14_subset)
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+/*The approximate size of the glyphs, cmaps and kerning tables of a font*/
+static uint32_t get_font_data_size(const lv_font_t * font, uint32_t * glyph_cnt)
+{
+    const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
+    uint32_t size = dsc->cmap_num * sizeof(lv_font_fmt_txt_cmap_t);
+    uint32_t cnt = 1;
+    uint32_t i;
+    for(i = 0; i < dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &dsc->cmaps[i];
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) cnt += cmap->range_length;
+        else cnt += cmap->list_length;
+        if(cmap->unicode_list) size += cmap->list_length * sizeof(uint16_t);
+    }
+
+    const lv_font_fmt_txt_glyph_dsc_t * last = &dsc->glyph_dsc[cnt - 1];
+    size += last->bitmap_index + (last->box_w * last->box_h * dsc->bpp + 7) / 8;
+    size += cnt * sizeof(lv_font_fmt_txt_glyph_dsc_t);
+
+    if(dsc->kern_dsc && dsc->kern_classes) {
+        const lv_font_fmt_txt_kern_classes_t * kern = dsc->kern_dsc;
+        size += kern->left_class_cnt * kern->right_class_cnt + cnt * 2;
+    }
+    else if(dsc->kern_dsc) {
+        const lv_font_fmt_txt_kern_pair_t * kern = dsc->kern_dsc;
+        size += kern->pair_cnt * (kern->glyph_ids_size ? 5 : 3);
+    }
+
+    *glyph_cnt = cnt - 1;
+    return size;
+}
+
+static void measure_text_cb(void * font)
+{
+    lv_point_t size;
+    lv_text_get_size(&size, text, font, 0, 0, 240, LV_TEXT_FLAG_NONE);
+}
+
+/*Size of the full and the subset font and the time of measuring a text*/
+void test_font_subset_benchmark(void)
+{
+    uint32_t full_cnt;
+    uint32_t subset_cnt;
+    uint32_t full_size = get_font_data_size(&lv_font_montserrat_14, &full_cnt);
+    uint32_t subset_size = get_font_data_size(&test_font_montserrat_14_subset, &subset_cnt);
+    TEST_PRINTF("montserrat 14: %u glyphs %u bytes, subset: %u glyphs %u bytes",
+                full_cnt, full_size, subset_cnt, subset_size);
+
+    uint32_t full_ns = lv_test_perf_measure_ns(measure_text_cb, (void *)&lv_font_montserrat_14, 5000);
+    uint32_t subset_ns = lv_test_perf_measure_ns(measure_text_cb, (void *)&test_font_montserrat_14_subset, 5000);
+    TEST_PRINTF("measure text: full %u ns, subset %u ns", full_ns, subset_ns);
+}
+
+#endif
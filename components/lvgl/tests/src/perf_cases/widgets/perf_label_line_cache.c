@@ -0,0 +1,70 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_LABEL_LINE_CACHE
+
+static void letter_pos_cb(void * label)
+{
+    lv_point_t p;
+    lv_label_get_letter_pos(label, lv_text_get_encoded_length(lv_label_get_text(label)), &p);
+}
+
+/*Time of redrawing labels and positioning a cursor at their end with and without the stored lines*/
+void test_label_line_cache_benchmark(void)
+{
+    const uint32_t line_cnts[] = {1, 10, 50, 100, 200};
+    const uint32_t buf_size = 200 * 64;
+    char * buf = lv_malloc(buf_size);
+    TEST_ASSERT_NOT_NULL(buf);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(line_cnts) / sizeof(line_cnts[0]); i++) {
+        uint32_t j;
+        uint32_t len = 0;
+        for(j = 0; j < line_cnts[i]; j++) {
+            len += lv_snprintf(&buf[len], buf_size - len, "%s%d. The quick brown fox", j ? "\n" : "", (int)j);
+        }
+
+        /*Draw only a few lines from the middle to see the cost of finding the first visible line*/
+        lv_obj_t * cont = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(cont, 240, 48);
+        lv_obj_set_style_pad_all(cont, 0, 0);
+        lv_obj_t * label = lv_label_create(cont);
+        lv_obj_set_width(label, 240);
+        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+        lv_label_set_text(label, buf);
+        lv_obj_update_layout(cont);
+        lv_obj_scroll_to_y(cont, lv_obj_get_height(label) / 2, LV_ANIM_OFF);
+
+        uint32_t cached_refr_us = lv_test_perf_refr_us(label, 100);
+        uint32_t cached_pos_us = lv_test_perf_measure_us(letter_pos_cb, label, 100);
+        lv_label_set_text_static(label, buf);
+        uint32_t refr_us = lv_test_perf_refr_us(label, 100);
+        uint32_t pos_us = lv_test_perf_measure_us(letter_pos_cb, label, 100);
+
+        TEST_PRINTF("%d lines: redraw %u us -> %u us, letter position %u us -> %u us",
+                    (int)line_cnts[i], refr_us, cached_refr_us, pos_us, cached_pos_us);
+        lv_obj_delete(cont);
+    }
+
+    lv_free(buf);
+}
+
+#endif
+
+#endif
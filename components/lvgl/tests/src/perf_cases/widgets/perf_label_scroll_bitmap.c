@@ -0,0 +1,67 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include "lv_test_perf.h"
+
+void setUp(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+}
+
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+
+static void frame_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_test_wait(33);
+}
+
+static uint32_t bench_frame_us(bool bitmap, uint32_t frames)
+{
+    static const char * texts[] = {
+        "Now playing: The quick brown fox jumps over the lazy dog",
+        "Breaking news: Lorem ipsum dolor sit amet, consectetur adipiscing elit",
+        "Temperature 21.5 \xC2\xB0" "C, humidity 45%, wind 12 km/h from the north-west",
+        "Next stop: Central station. Please mind the gap between the train and the platform",
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+        lv_obj_set_width(label, 220);
+        lv_obj_set_pos(label, 10, 10 + i * 30);
+        /*Static texts are not rendered to a bitmap*/
+        if(bitmap) lv_label_set_text(label, texts[i]);
+        else lv_label_set_text_static(label, texts[i]);
+    }
+    lv_refr_now(NULL);
+
+    uint32_t us = lv_test_perf_measure_us(frame_cb, NULL, frames);
+
+    lv_obj_clean(lv_screen_active());
+    return us;
+}
+
+/*CPU time of 4 marquee labels per frame at 30 FPS on an RGB565 display*/
+void test_label_scroll_bitmap_benchmark(void)
+{
+    uint32_t glyphs_us = bench_frame_us(false, 300);
+    uint32_t bitmap_us = bench_frame_us(true, 300);
+    TEST_PRINTF("4 marquee labels: glyphs %u us/frame (%u%% CPU at 30 FPS), bitmap %u us/frame (%u%% CPU at 30 FPS)",
+                glyphs_us, glyphs_us * 100 / 33333, bitmap_us, bitmap_us * 100 / 33333);
+}
+
+#endif
+
+#endif
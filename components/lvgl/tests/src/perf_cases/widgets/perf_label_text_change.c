@@ -0,0 +1,69 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t flushed_px;
+
+static void flush_start_event_cb(lv_event_t * e)
+{
+    const lv_area_t * area = lv_event_get_param(e);
+    flushed_px += lv_area_get_size(area);
+}
+
+void setUp(void)
+{
+    lv_display_add_event_cb(lv_display_get_default(), flush_start_event_cb, LV_EVENT_FLUSH_START, NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), flush_start_event_cb, NULL);
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_LABEL_LINE_CACHE
+
+static uint32_t count_counter_bytes(lv_obj_t * label, bool partial)
+{
+    static char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Uptime 12:00:00");
+    if(partial) lv_label_set_text(label, buf);
+    else lv_label_set_text_static(label, buf);
+    lv_refr_now(NULL);
+
+    flushed_px = 0;
+    uint32_t s;
+    for(s = 1; s <= 60; s++) {
+        lv_snprintf(buf, sizeof(buf), "Uptime 12:%02d:%02d", (int)(s / 60), (int)(s % 60));
+        /*Static texts are not compared with the previous text so the whole label is invalidated*/
+        if(partial) lv_label_set_text(label, buf);
+        else lv_label_set_text_static(label, buf);
+        lv_refr_now(NULL);
+    }
+
+    /*RGB565 pixels*/
+    return flushed_px * 2 / 60;
+}
+
+/*Bytes sent to an RGB565 display per update of a seconds counter*/
+void test_label_text_change_benchmark(void)
+{
+    const lv_text_align_t aligns[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+    const char * names[] = {"left", "center", "right"};
+    uint32_t i;
+    for(i = 0; i < sizeof(aligns) / sizeof(aligns[0]); i++) {
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_obj_set_style_text_align(label, aligns[i], 0);
+        lv_obj_set_width(label, 220);
+        uint32_t full = count_counter_bytes(label, false);
+        uint32_t partial = count_counter_bytes(label, true);
+        TEST_PRINTF("seconds counter (%s): %u bytes -> %u bytes per update", names[i], full, partial);
+        lv_obj_delete(label);
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_color_format_t alpha_layer_cf;
+static uint32_t layer_chunk_cnt;
+
+static void draw_main_begin_cb(lv_event_t * e)
+{
+    lv_layer_t * layer = lv_event_get_layer(e);
+    if(layer->color_format != lv_display_get_color_format(NULL)) alpha_layer_cf = layer->color_format;
+    layer_chunk_cnt++;
+}
+
+static lv_obj_t * create_translucent_widget(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 300, 300);
+    lv_obj_set_style_radius(obj, 40, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex3(0xf88), 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, 0);
+    lv_obj_set_style_opa_layered(obj, LV_OPA_50, 0);
+    lv_obj_set_style_pad_all(obj, 0, 0);
+    lv_obj_center(obj);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_label_set_text(label, "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Quisque suscipit risus nec.");
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 10);
+
+    lv_obj_t * img = lv_image_create(obj);
+    lv_image_set_src(img, &test_image_cogwheel_argb8888);
+    lv_obj_align(img, LV_ALIGN_BOTTOM_MID, 0, -10);
+
+    lv_obj_add_event_cb(obj, draw_main_begin_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+
+    return obj;
+}
+
+static void refresh(void)
+{
+    alpha_layer_cf = LV_COLOR_FORMAT_UNKNOWN;
+    layer_chunk_cnt = 0;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_obj_remove_local_style_prop(lv_screen_active(), LV_STYLE_BG_COLOR, 0);
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+}
+
+void test_draw_layer_rgb565a8_on_rgb565_display(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565);
+    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_hex3(0x8cf), 0);
+    create_translucent_widget();
+
+    refresh();
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565A8, alpha_layer_cf);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_layer_rgb565a8.png");
+}
+
+void test_draw_layer_rgb565a8_chunk_count(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565);
+    lv_obj_t * obj = create_translucent_widget();
+    lv_obj_set_style_radius(obj, 0, 0);
+
+    refresh();
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565A8, alpha_layer_cf);
+
+    /*3 bytes per pixel instead of 4 so more rows fit into a chunk*/
+    uint32_t rows_per_chunk = LV_DRAW_LAYER_SIMPLE_BUF_SIZE / (300 * 3);
+    TEST_ASSERT_EQUAL((300 + rows_per_chunk - 1) / rows_per_chunk, layer_chunk_cnt);
+}
+
+void test_draw_layer_argb8888_on_xrgb8888_display(void)
+{
+    create_translucent_widget();
+
+    refresh();
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, alpha_layer_cf);
+}
+
+void test_draw_layer_rgb565a8_not_used_with_bitmap_mask(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_a8);
+
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565);
+    lv_obj_t * obj = create_translucent_widget();
+    lv_obj_set_style_bitmap_mask_src(obj, &test_image_cogwheel_a8, 0);
+
+    refresh();
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, alpha_layer_cf);
+}
+
+#endif
@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_SIZE 220
+
+static lv_draw_buf_t * buf_color;
+static lv_draw_buf_t * buf_image;
+static lv_draw_buf_t * image_buf;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    if(buf_color) lv_draw_buf_destroy(buf_color);
+    if(buf_image) lv_draw_buf_destroy(buf_image);
+    if(image_buf) lv_draw_buf_destroy(image_buf);
+    buf_color = NULL;
+    buf_image = NULL;
+    image_buf = NULL;
+}
+
+static void draw_arc(lv_draw_buf_t * buf, int32_t radius, int32_t width, int32_t start_angle, int32_t end_angle,
+                     bool rounded, bool image)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.center.x = CANVAS_SIZE / 2;
+    dsc.center.y = CANVAS_SIZE / 2;
+    dsc.radius = radius;
+    dsc.width = width;
+    dsc.start_angle = start_angle;
+    dsc.end_angle = end_angle;
+    dsc.rounded = rounded;
+    dsc.color = lv_color_hex(0xff0000);
+    if(image) {
+        /*Align the image to the arc's area*/
+        image_buf->header.w = 2 * radius;
+        image_buf->header.h = 2 * radius;
+        dsc.img_src = image_buf;
+    }
+    lv_draw_arc(&layer, &dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_delete(canvas);
+}
+
+/**
+ * Draw an arc with a color and with an image of the same color and
+ * compare the pixels
+ * @param max_diff  store the largest difference here
+ * @param diff_cnt  store the number of pixels which differ by more than 2 here
+ */
+static void compare_arcs(int32_t radius, int32_t width, int32_t start_angle, int32_t end_angle, bool rounded,
+                         uint32_t * max_diff, uint32_t * diff_cnt)
+{
+    draw_arc(buf_color, radius, width, start_angle, end_angle, rounded, false);
+    draw_arc(buf_image, radius, width, start_angle, end_angle, rounded, true);
+
+    *max_diff = 0;
+    *diff_cnt = 0;
+    uint32_t y;
+    for(y = 0; y < CANVAS_SIZE; y++) {
+        const lv_color32_t * row_color = lv_draw_buf_goto_xy(buf_color, 0, y);
+        const lv_color32_t * row_image = lv_draw_buf_goto_xy(buf_image, 0, y);
+        uint32_t x;
+        for(x = 0; x < CANVAS_SIZE; x++) {
+            /*Only the green and blue channels change on red arcs*/
+            uint32_t diff = LV_ABS((int32_t)row_color[x].green - row_image[x].green);
+            if(diff > *max_diff) *max_diff = diff;
+            if(diff > 2) (*diff_cnt)++;
+        }
+    }
+}
+
+void test_arc_matches_masked_arc(void)
+{
+    buf_color = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, 0);
+    buf_image = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, 0);
+
+    /*Arcs with image are still drawn with masks, so use an image with the arc's color*/
+    image_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_RGB565, 0);
+    uint32_t y;
+    for(y = 0; y < CANVAS_SIZE; y++) {
+        uint16_t * row = lv_draw_buf_goto_xy(image_buf, 0, y);
+        uint32_t x;
+        for(x = 0; x < CANVAS_SIZE; x++) row[x] = lv_color_to_u16(lv_color_hex(0xff0000));
+    }
+
+    static const int32_t arcs[][4] = {
+        /*radius, width, start angle, end angle*/
+        {100, 20, 0, 90},
+        {100, 20, 30, 300},
+        {100, 5, 350, 20},
+        {80, 1, 135, 225},
+        {60, 60, 45, 200},
+        {40, 12, 270, 90},
+        {10, 3, 0, 180},
+        {100, 30, 200, 201},
+    };
+
+    /*The circles are the same as with masks. Only the anti-aliasing of the angles' lines
+     *is calculated differently, so only the pixels along them can differ by more than 2.*/
+    uint32_t i;
+    for(i = 0; i < sizeof(arcs) / sizeof(arcs[0]); i++) {
+        uint32_t r;
+        for(r = 0; r < 2; r++) {
+            uint32_t max_diff;
+            uint32_t diff_cnt;
+            compare_arcs(arcs[i][0], arcs[i][1], arcs[i][2], arcs[i][3], r, &max_diff, &diff_cnt);
+            TEST_ASSERT_LESS_OR_EQUAL(16, max_diff);
+            TEST_ASSERT_LESS_OR_EQUAL(2 * arcs[i][1] + 4, diff_cnt);
+        }
+    }
+}
+
+static void create_arcs(void)
+{
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * arc = lv_arc_create(lv_screen_active());
+        lv_obj_set_size(arc, 150, 150);
+        lv_obj_set_pos(arc, 20 + (i % 4) * 190, 30 + (i / 4) * 220);
+        lv_obj_set_style_arc_width(arc, 4 + i * 3, 0);
+        lv_obj_set_style_arc_width(arc, 4 + i * 3, LV_PART_INDICATOR);
+        lv_obj_set_style_arc_rounded(arc, i % 2, 0);
+        lv_obj_set_style_arc_rounded(arc, i % 2, LV_PART_INDICATOR);
+        lv_arc_set_bg_angles(arc, i * 20, 300 + i * 20);
+        lv_arc_set_value(arc, 10 + i * 12);
+    }
+}
+
+void test_arc_render(void)
+{
+    create_arcs();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/arc_analytic.png");
+}
+
+#endif
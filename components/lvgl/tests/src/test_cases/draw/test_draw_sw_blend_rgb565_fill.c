@@ -0,0 +1,142 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+
+#include "unity/unity.h"
+
+/* Test the opaque RGB565 fill and copy of the software renderer with every width of the
+ * 240 px wide target display and with all the 2/4/8 byte alignments of the first pixel.
+ * The test configs use LV_DRAW_SW_ASM_NONE, so the C fill and copy are tested as on the ESP32.
+ * In the OPTIONS_TEST_SSE2 build the same cases check the SSE2 functions.*/
+
+#define MAX_W       240
+#define MAX_H       3
+#define GAP         5                           /*Extra pixels at the end of the rows if the stride is not w*/
+#define BUF_PX      ((MAX_W + GAP + 4) * MAX_H + 8)
+#define GUARD       0xA55A
+
+static uint64_t dest_buf64[BUF_PX / 4 + 1];     /*uint64_t to be 8 byte aligned*/
+static uint64_t src_buf64[BUF_PX / 4 + 1];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static uint16_t * get_buf(uint64_t * buf64, int32_t ofs)
+{
+    return (uint16_t *)buf64 + ofs;
+}
+
+static void init_fill_dsc(lv_draw_sw_blend_fill_dsc_t * dsc, lv_color_t color, int32_t ofs, int32_t w, int32_t h,
+                          int32_t stride_px)
+{
+    lv_memzero(dsc, sizeof(lv_draw_sw_blend_fill_dsc_t));
+    dsc->dest_buf = get_buf(dest_buf64, ofs);
+    dsc->dest_w = w;
+    dsc->dest_h = h;
+    dsc->dest_stride = stride_px * 2;
+    dsc->color = color;
+    dsc->opa = LV_OPA_COVER;
+}
+
+static void init_copy_dsc(lv_draw_sw_blend_image_dsc_t * dsc, int32_t ofs, int32_t w, int32_t h, int32_t stride_px)
+{
+    lv_memzero(dsc, sizeof(lv_draw_sw_blend_image_dsc_t));
+    dsc->dest_buf = get_buf(dest_buf64, ofs);
+    dsc->dest_w = w;
+    dsc->dest_h = h;
+    dsc->dest_stride = stride_px * 2;
+    dsc->src_buf = get_buf(src_buf64, ofs);
+    dsc->src_stride = stride_px * 2;
+    dsc->src_color_format = LV_COLOR_FORMAT_RGB565;
+    dsc->opa = LV_OPA_COVER;
+    dsc->blend_mode = LV_BLEND_MODE_NORMAL;
+}
+
+static void reset_dest(void)
+{
+    uint16_t * buf = get_buf(dest_buf64, 0);
+    uint32_t i;
+    for(i = 0; i < BUF_PX; i++) buf[i] = GUARD;
+}
+
+/*Check that exactly the area is written and the gaps between the rows are untouched*/
+static void check_dest(int32_t ofs, int32_t w, int32_t h, int32_t stride_px, uint16_t expected_color,
+                       const uint16_t * expected_buf)
+{
+    const uint16_t * buf = get_buf(dest_buf64, 0);
+    int32_t i;
+    for(i = 0; i < BUF_PX; i++) {
+        int32_t rel = i - ofs;
+        int32_t y = rel >= 0 ? rel / stride_px : -1;
+        int32_t x = rel >= 0 ? rel % stride_px : -1;
+        bool in_area = y >= 0 && y < h && x < w;
+        uint16_t expected = in_area ? (expected_buf ? expected_buf[i] : expected_color) : GUARD;
+        if(buf[i] != expected) {
+            TEST_PRINTF("w: %d, h: %d, offset: %d, stride: %d, pixel: %d", w, h, ofs, stride_px, i);
+            TEST_ASSERT_EQUAL_HEX16(expected, buf[i]);
+        }
+    }
+}
+
+static void test_fill_color(lv_color_t color)
+{
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    uint16_t color16 = lv_color_to_u16(color);
+    int32_t w;
+    int32_t ofs;
+    for(w = 1; w <= MAX_W; w++) {
+        for(ofs = 0; ofs < 4; ofs++) {
+            /*Continuous rows and rows with gap*/
+            reset_dest();
+            init_fill_dsc(&dsc, color, ofs, w, MAX_H, w);
+            lv_draw_sw_blend_color_to_rgb565(&dsc);
+            check_dest(ofs, w, MAX_H, w, color16, NULL);
+
+            reset_dest();
+            init_fill_dsc(&dsc, color, ofs, w, MAX_H, w + GAP);
+            lv_draw_sw_blend_color_to_rgb565(&dsc);
+            check_dest(ofs, w, MAX_H, w + GAP, color16, NULL);
+        }
+    }
+}
+
+void test_rgb565_fill_all_widths(void)
+{
+    test_fill_color(lv_color_hex(0x3366cc));  /*Different bytes*/
+    test_fill_color(lv_color_white());        /*Same bytes: 0xFFFF*/
+    test_fill_color(lv_color_black());        /*Same bytes: 0x0000*/
+}
+
+void test_rgb565_copy_all_widths(void)
+{
+    lv_draw_sw_blend_image_dsc_t dsc;
+    uint16_t * src = get_buf(src_buf64, 0);
+    uint32_t i;
+    for(i = 0; i < BUF_PX; i++) src[i] = (uint16_t)(i * 2654435761u >> 7);
+
+    int32_t w;
+    int32_t ofs;
+    for(w = 1; w <= MAX_W; w++) {
+        for(ofs = 0; ofs < 4; ofs++) {
+            reset_dest();
+            init_copy_dsc(&dsc, ofs, w, MAX_H, w);
+            lv_draw_sw_blend_image_to_rgb565(&dsc);
+            check_dest(ofs, w, MAX_H, w, 0, src);
+
+            reset_dest();
+            init_copy_dsc(&dsc, ofs, w, MAX_H, w + GAP);
+            lv_draw_sw_blend_image_to_rgb565(&dsc);
+            check_dest(ofs, w, MAX_H, w + GAP, 0, src);
+        }
+    }
+}
+
+#endif
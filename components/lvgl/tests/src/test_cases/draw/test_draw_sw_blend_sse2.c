@@ -0,0 +1,478 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2
+
+#include "../../src/draw/sw/blend/sse2/lv_blend_sse2.h"
+
+/* The SSE2 blend functions are compared to the per-pixel formulas of
+ * `lv_draw_sw_blend_to_rgb565.c` and `lv_draw_sw_blend_to_argb8888.c`.
+ * The results must be bit-exact as the screenshot tests are shared with the C implementation.*/
+
+#define MAX_W       67
+#define MAX_H       5
+#define BUF_STRIDE  ((MAX_W + 3) * 4)
+#define BUF_SIZE    (BUF_STRIDE * MAX_H)
+
+typedef enum {
+    BLEND_COVER,
+    BLEND_OPA,
+    BLEND_MASK,
+    BLEND_MASK_OPA,
+} blend_case_t;
+
+static uint8_t src_buf[BUF_SIZE];
+static uint8_t dest_buf[BUF_SIZE];
+static uint8_t ref_buf[BUF_SIZE];
+static lv_opa_t mask_buf[MAX_W * MAX_H];
+
+static uint32_t rnd_state;
+
+static const int32_t widths[] = {1, 3, 4, 7, 8, 9, 15, 16, 17, 33, MAX_W};
+
+void setUp(void)
+{
+    rnd_state = 0x12345678;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static uint32_t rnd(void)
+{
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+/*Prefer the values where the blending has special cases*/
+static uint8_t rnd_opa(void)
+{
+    static const uint8_t special[] = {0, 1, 2, 3, 127, 128, 252, 253, 254, 255};
+    uint32_t r = rnd();
+    if(r & 1) return special[(r >> 1) % sizeof(special)];
+    return (uint8_t)(r >> 8);
+}
+
+static void fill_random(uint8_t * buf, bool alpha)
+{
+    uint32_t i;
+    for(i = 0; i < BUF_SIZE; i++) buf[i] = (uint8_t)rnd();
+    if(alpha) {
+        /*Have some opaque and transparent areas too*/
+        uint8_t a = rnd_opa();
+        for(i = 3; i < BUF_SIZE; i += 4) {
+            if((rnd() & 7) == 0) a = rnd_opa();
+            buf[i] = a;
+        }
+    }
+
+    for(i = 0; i < sizeof(mask_buf); i++) {
+        if((rnd() & 3) == 0) mask_buf[i] = rnd_opa();
+        else mask_buf[i] = i % 16 < 8 ? 0xFF : 0x00;
+    }
+}
+
+static lv_opa_t case_opa(blend_case_t c)
+{
+    return (c == BLEND_COVER || c == BLEND_MASK) ? LV_OPA_COVER : (lv_opa_t)(rnd() % LV_OPA_MAX);
+}
+
+static const lv_opa_t * case_mask(blend_case_t c)
+{
+    return (c == BLEND_MASK || c == BLEND_MASK_OPA) ? mask_buf : NULL;
+}
+
+static lv_opa_t ref_mix(const lv_opa_t * mask, int32_t x, lv_opa_t opa)
+{
+    if(mask == NULL) return opa;
+    if(opa >= LV_OPA_MAX) return mask[x];
+    return LV_OPA_MIX2(mask[x], opa);
+}
+
+static uint16_t ref_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 0) return c2;
+    if(mix == 255) return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+
+    lv_opa_t mix_inv = 255 - mix;
+    return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+           ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+           (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+}
+
+static lv_color32_t ref_32_32_mix(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) return fg;
+    if(fg.alpha <= LV_OPA_MIN) return bg;
+    if(bg.alpha == 255) return lv_color_mix32(fg, bg);
+
+    lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+    fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+    lv_color32_t res = lv_color_mix32(fg, bg);
+    res.alpha = res_alpha;
+    return res;
+}
+
+/*Start from the second pixel to test the unaligned cases too*/
+static void init_fill_dsc(lv_draw_sw_blend_fill_dsc_t * dsc, int32_t w, int32_t px_size, blend_case_t c)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest_buf + px_size;
+    dsc->dest_w = w;
+    dsc->dest_h = MAX_H;
+    dsc->dest_stride = BUF_STRIDE;
+    dsc->color = lv_color_make((uint8_t)rnd(), (uint8_t)rnd(), (uint8_t)rnd());
+    dsc->opa = case_opa(c);
+    dsc->mask_buf = case_mask(c);
+    dsc->mask_stride = MAX_W;
+}
+
+static void init_image_dsc(lv_draw_sw_blend_image_dsc_t * dsc, int32_t w, int32_t dest_px_size, int32_t src_px_size,
+                           blend_case_t c)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest_buf + dest_px_size;
+    dsc->dest_w = w;
+    dsc->dest_h = MAX_H;
+    dsc->dest_stride = BUF_STRIDE;
+    dsc->src_buf = src_buf + src_px_size;
+    dsc->src_stride = BUF_STRIDE - src_px_size;
+    dsc->opa = case_opa(c);
+    dsc->mask_buf = case_mask(c);
+    dsc->mask_stride = MAX_W;
+    dsc->blend_mode = LV_BLEND_MODE_NORMAL;
+}
+
+static void ref_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    int32_t x, y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        uint16_t * dest = (uint16_t *)((uint8_t *)dsc->dest_buf + y * dsc->dest_stride);
+        const lv_opa_t * mask = dsc->mask_buf ? dsc->mask_buf + y * dsc->mask_stride : NULL;
+        for(x = 0; x < dsc->dest_w; x++) {
+            dest[x] = lv_color_16_16_mix(color16, dest[x], ref_mix(mask, x, dsc->opa));
+        }
+    }
+}
+
+static void ref_image_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, lv_color_format_t src_cf)
+{
+    uint32_t src_px_size = lv_color_format_get_size(src_cf);
+    int32_t x, y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        uint16_t * dest = (uint16_t *)((uint8_t *)dsc->dest_buf + y * dsc->dest_stride);
+        const uint8_t * src = (const uint8_t *)dsc->src_buf + y * dsc->src_stride;
+        const lv_opa_t * mask = dsc->mask_buf ? dsc->mask_buf + y * dsc->mask_stride : NULL;
+        for(x = 0; x < dsc->dest_w; x++) {
+            const uint8_t * px = &src[x * src_px_size];
+            if(src_cf == LV_COLOR_FORMAT_RGB565) {
+                dest[x] = lv_color_16_16_mix(((const uint16_t *)src)[x], dest[x], ref_mix(mask, x, dsc->opa));
+            }
+            else if(src_cf == LV_COLOR_FORMAT_ARGB8888) {
+                lv_opa_t mix;
+                if(mask == NULL) mix = dsc->opa >= LV_OPA_MAX ? px[3] : LV_OPA_MIX2(px[3], dsc->opa);
+                else if(dsc->opa >= LV_OPA_MAX) mix = LV_OPA_MIX2(px[3], mask[x]);
+                else mix = LV_OPA_MIX3(px[3], mask[x], dsc->opa);
+                dest[x] = ref_24_16_mix(px, dest[x], mix);
+            }
+            else {
+                dest[x] = ref_24_16_mix(px, dest[x], ref_mix(mask, x, dsc->opa));
+            }
+        }
+    }
+}
+
+static void ref_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t x, y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        lv_color32_t * dest = (lv_color32_t *)((uint8_t *)dsc->dest_buf + y * dsc->dest_stride);
+        const lv_opa_t * mask = dsc->mask_buf ? dsc->mask_buf + y * dsc->mask_stride : NULL;
+        for(x = 0; x < dsc->dest_w; x++) {
+            dest[x] = ref_32_32_mix(lv_color_to_32(dsc->color, ref_mix(mask, x, dsc->opa)), dest[x]);
+        }
+    }
+}
+
+static void ref_image_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc, lv_color_format_t src_cf)
+{
+    uint32_t src_px_size = lv_color_format_get_size(src_cf);
+    int32_t x, y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        lv_color32_t * dest = (lv_color32_t *)((uint8_t *)dsc->dest_buf + y * dsc->dest_stride);
+        const uint8_t * src = (const uint8_t *)dsc->src_buf + y * dsc->src_stride;
+        const lv_opa_t * mask = dsc->mask_buf ? dsc->mask_buf + y * dsc->mask_stride : NULL;
+        for(x = 0; x < dsc->dest_w; x++) {
+            const uint8_t * px = &src[x * src_px_size];
+            lv_color32_t fg;
+            if(src_cf == LV_COLOR_FORMAT_RGB565) {
+                const lv_color16_t * c16 = (const lv_color16_t *)px;
+                fg.red = (c16->red * 2106) >> 8;
+                fg.green = (c16->green * 1037) >> 8;
+                fg.blue = (c16->blue * 2106) >> 8;
+                fg.alpha = ref_mix(mask, x, dsc->opa);
+            }
+            else if(src_cf == LV_COLOR_FORMAT_ARGB8888) {
+                fg = *(const lv_color32_t *)px;
+                if(mask == NULL) {
+                    if(dsc->opa < LV_OPA_MAX) fg.alpha = LV_OPA_MIX2(fg.alpha, dsc->opa);
+                }
+                else if(dsc->opa >= LV_OPA_MAX) fg.alpha = LV_OPA_MIX2(fg.alpha, mask[x]);
+                else fg.alpha = LV_OPA_MIX3(fg.alpha, dsc->opa, mask[x]);
+            }
+            else {
+                fg.red = px[2];
+                fg.green = px[1];
+                fg.blue = px[0];
+                fg.alpha = ref_mix(mask, x, dsc->opa);
+            }
+            dest[x] = ref_32_32_mix(fg, dest[x]);
+        }
+    }
+}
+
+static lv_result_t call_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc, blend_case_t c)
+{
+    switch(c) {
+        case BLEND_COVER:
+            return lv_color_blend_to_rgb565_sse2(dsc);
+        case BLEND_OPA:
+            return lv_color_blend_to_rgb565_with_opa_sse2(dsc);
+        case BLEND_MASK:
+            return lv_color_blend_to_rgb565_with_mask_sse2(dsc);
+        default:
+            return lv_color_blend_to_rgb565_mix_mask_opa_sse2(dsc);
+    }
+}
+
+static lv_result_t call_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc, blend_case_t c)
+{
+    switch(c) {
+        case BLEND_COVER:
+            return lv_color_blend_to_argb8888_sse2(dsc);
+        case BLEND_OPA:
+            return lv_color_blend_to_argb8888_with_opa_sse2(dsc);
+        case BLEND_MASK:
+            return lv_color_blend_to_argb8888_with_mask_sse2(dsc);
+        default:
+            return lv_color_blend_to_argb8888_mix_mask_opa_sse2(dsc);
+    }
+}
+
+static lv_result_t call_image_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, lv_color_format_t src_cf,
+                                        blend_case_t c)
+{
+    uint32_t px_size = lv_color_format_get_size(src_cf);
+    if(src_cf == LV_COLOR_FORMAT_RGB565) {
+        switch(c) {
+            case BLEND_COVER:
+                return lv_rgb565_blend_normal_to_rgb565_sse2(dsc);
+            case BLEND_OPA:
+                return lv_rgb565_blend_normal_to_rgb565_with_opa_sse2(dsc);
+            case BLEND_MASK:
+                return lv_rgb565_blend_normal_to_rgb565_with_mask_sse2(dsc);
+            default:
+                return lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_sse2(dsc);
+        }
+    }
+    else if(src_cf == LV_COLOR_FORMAT_ARGB8888) {
+        switch(c) {
+            case BLEND_COVER:
+                return lv_argb8888_blend_normal_to_rgb565_sse2(dsc);
+            case BLEND_OPA:
+                return lv_argb8888_blend_normal_to_rgb565_with_opa_sse2(dsc);
+            case BLEND_MASK:
+                return lv_argb8888_blend_normal_to_rgb565_with_mask_sse2(dsc);
+            default:
+                return lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_sse2(dsc);
+        }
+    }
+    else {
+        switch(c) {
+            case BLEND_COVER:
+                return lv_rgb888_blend_normal_to_rgb565_sse2(dsc, px_size);
+            case BLEND_OPA:
+                return lv_rgb888_blend_normal_to_rgb565_with_opa_sse2(dsc, px_size);
+            case BLEND_MASK:
+                return lv_rgb888_blend_normal_to_rgb565_with_mask_sse2(dsc, px_size);
+            default:
+                return lv_rgb888_blend_normal_to_rgb565_mix_mask_opa_sse2(dsc, px_size);
+        }
+    }
+}
+
+static lv_result_t call_image_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc, lv_color_format_t src_cf,
+                                          blend_case_t c)
+{
+    uint32_t px_size = lv_color_format_get_size(src_cf);
+    if(src_cf == LV_COLOR_FORMAT_RGB565) {
+        switch(c) {
+            case BLEND_COVER:
+                return lv_rgb565_blend_normal_to_argb8888_sse2(dsc);
+            case BLEND_OPA:
+                return lv_rgb565_blend_normal_to_argb8888_with_opa_sse2(dsc);
+            case BLEND_MASK:
+                return lv_rgb565_blend_normal_to_argb8888_with_mask_sse2(dsc);
+            default:
+                return lv_rgb565_blend_normal_to_argb8888_mix_mask_opa_sse2(dsc);
+        }
+    }
+    else if(src_cf == LV_COLOR_FORMAT_ARGB8888) {
+        switch(c) {
+            case BLEND_COVER:
+                return lv_argb8888_blend_normal_to_argb8888_sse2(dsc);
+            case BLEND_OPA:
+                return lv_argb8888_blend_normal_to_argb8888_with_opa_sse2(dsc);
+            case BLEND_MASK:
+                return lv_argb8888_blend_normal_to_argb8888_with_mask_sse2(dsc);
+            default:
+                return lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_sse2(dsc);
+        }
+    }
+    else {
+        switch(c) {
+            case BLEND_COVER:
+                return lv_rgb888_blend_normal_to_argb8888_sse2(dsc, px_size);
+            case BLEND_OPA:
+                return lv_rgb888_blend_normal_to_argb8888_with_opa_sse2(dsc, px_size);
+            case BLEND_MASK:
+                return lv_rgb888_blend_normal_to_argb8888_with_mask_sse2(dsc, px_size);
+            default:
+                return lv_rgb888_blend_normal_to_argb8888_mix_mask_opa_sse2(dsc, px_size);
+        }
+    }
+}
+
+static void run_color(int32_t dest_px_size)
+{
+    uint32_t i, c, iter;
+    for(iter = 0; iter < 8; iter++) {
+        for(c = BLEND_COVER; c <= BLEND_MASK_OPA; c++) {
+            for(i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+                lv_draw_sw_blend_fill_dsc_t dsc;
+                fill_random(dest_buf, true);
+                init_fill_dsc(&dsc, widths[i], dest_px_size, c);
+
+                lv_memcpy(ref_buf, dest_buf, BUF_SIZE);
+                dsc.dest_buf = ref_buf + dest_px_size;
+                if(dest_px_size == 2) ref_color_to_rgb565(&dsc);
+                else ref_color_to_argb8888(&dsc);
+
+                dsc.dest_buf = dest_buf + dest_px_size;
+                if(dest_px_size == 2) TEST_ASSERT_EQUAL(LV_RESULT_OK, call_color_to_rgb565(&dsc, c));
+                else TEST_ASSERT_EQUAL(LV_RESULT_OK, call_color_to_argb8888(&dsc, c));
+
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, BUF_SIZE);
+            }
+        }
+    }
+}
+
+static void run_image(int32_t dest_px_size, lv_color_format_t src_cf)
+{
+    uint32_t src_px_size = lv_color_format_get_size(src_cf);
+    uint32_t i, c, iter;
+    for(iter = 0; iter < 8; iter++) {
+        for(c = BLEND_COVER; c <= BLEND_MASK_OPA; c++) {
+            for(i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+                lv_draw_sw_blend_image_dsc_t dsc;
+                fill_random(src_buf, true);
+                fill_random(dest_buf, true);
+                init_image_dsc(&dsc, widths[i], dest_px_size, src_px_size, c);
+
+                lv_memcpy(ref_buf, dest_buf, BUF_SIZE);
+                dsc.dest_buf = ref_buf + dest_px_size;
+                if(dest_px_size == 2) {
+                    ref_image_to_rgb565(&dsc, src_cf);
+                }
+                /*XRGB8888 is copied with the X byte*/
+                else if(c == BLEND_COVER && src_cf == LV_COLOR_FORMAT_XRGB8888) {
+                    int32_t y;
+                    for(y = 0; y < dsc.dest_h; y++) {
+                        lv_memcpy(ref_buf + dest_px_size + y * BUF_STRIDE, (uint8_t *)dsc.src_buf + y * dsc.src_stride,
+                                  dsc.dest_w * 4);
+                    }
+                }
+                else {
+                    ref_image_to_argb8888(&dsc, src_cf);
+                }
+
+                dsc.dest_buf = dest_buf + dest_px_size;
+                if(dest_px_size == 2) TEST_ASSERT_EQUAL(LV_RESULT_OK, call_image_to_rgb565(&dsc, src_cf, c));
+                else TEST_ASSERT_EQUAL(LV_RESULT_OK, call_image_to_argb8888(&dsc, src_cf, c));
+
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, BUF_SIZE);
+            }
+        }
+    }
+}
+
+void test_sse2_color_to_rgb565(void)
+{
+    run_color(2);
+}
+
+void test_sse2_image_to_rgb565(void)
+{
+    run_image(2, LV_COLOR_FORMAT_RGB565);
+    run_image(2, LV_COLOR_FORMAT_RGB888);
+    run_image(2, LV_COLOR_FORMAT_XRGB8888);
+    run_image(2, LV_COLOR_FORMAT_ARGB8888);
+}
+
+void test_sse2_color_to_argb8888(void)
+{
+    run_color(4);
+}
+
+void test_sse2_image_to_argb8888(void)
+{
+    run_image(4, LV_COLOR_FORMAT_RGB565);
+    run_image(4, LV_COLOR_FORMAT_RGB888);
+    run_image(4, LV_COLOR_FORMAT_XRGB8888);
+    run_image(4, LV_COLOR_FORMAT_ARGB8888);
+}
+
+#else /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2*/
+
+/*The SSE2 backend is enabled only in the OPTIONS_TEST_SSE2 build*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_sse2_color_to_rgb565(void)
+{
+    TEST_PASS();
+}
+
+void test_sse2_image_to_rgb565(void)
+{
+    TEST_PASS();
+}
+
+void test_sse2_color_to_argb8888(void)
+{
+    TEST_PASS();
+}
+
+void test_sse2_image_to_argb8888(void)
+{
+    TEST_PASS();
+}
+
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_BYTES > 0
+
+#define shadow_cache_p (LV_GLOBAL_DEFAULT()->sw_shadow_cache)
+
+void setUp(void)
+{
+    lv_cache_drop_all(shadow_cache_p, NULL);
+    lv_cache_set_max_size(shadow_cache_p, LV_DRAW_SW_SHADOW_CACHE_BYTES, NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_cache_drop_all(shadow_cache_p, NULL);
+    lv_cache_set_max_size(shadow_cache_p, LV_DRAW_SW_SHADOW_CACHE_BYTES, NULL);
+}
+
+static lv_obj_t * create_card(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, int32_t shadow_w,
+                              int32_t spread)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_white(), 0);
+    lv_obj_set_style_radius(obj, radius, 0);
+    lv_obj_set_style_shadow_width(obj, shadow_w, 0);
+    lv_obj_set_style_shadow_spread(obj, spread, 0);
+    lv_obj_set_style_shadow_offset_y(obj, 4, 0);
+    return obj;
+}
+
+static void create_cards(void)
+{
+    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_hex3(0xddd), 0);
+
+    /*The same shadow with different sizes*/
+    create_card(30, 30, 200, 100, 12, 20, 0);
+    create_card(270, 30, 300, 60, 12, 20, 0);
+
+    /*Small enough for the other corners to affect the blurred corner*/
+    create_card(620, 30, 20, 30, 12, 20, 0);
+    create_card(700, 30, 40, 16, 4, 30, 2);
+
+    /*Different parameters*/
+    create_card(30, 200, 200, 100, 0, 10, 0);
+    create_card(270, 200, 200, 100, 30, 15, 5);
+    create_card(530, 200, 200, 100, LV_RADIUS_CIRCLE, 25, 0);
+
+    /*Too large to be cached*/
+    create_card(100, 360, 600, 80, 40, 100, 0);
+}
+
+void test_box_shadow_cache_render(void)
+{
+    create_cards();
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/box_shadow_cache.png");
+    size_t cache_size = lv_cache_get_size(shadow_cache_p, NULL);
+    TEST_ASSERT_GREATER_THAN(0, cache_size);
+
+    /*Rendered from the cached corners*/
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/box_shadow_cache.png");
+    TEST_ASSERT_EQUAL(cache_size, lv_cache_get_size(shadow_cache_p, NULL));
+
+    /*The same without cache*/
+    lv_cache_drop_all(shadow_cache_p, NULL);
+    lv_cache_set_max_size(shadow_cache_p, 0, NULL);
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/box_shadow_cache.png");
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(shadow_cache_p, NULL));
+}
+
+void test_box_shadow_cache_same_shape(void)
+{
+    /*Only the position differs*/
+    create_card(30, 30, 200, 100, 12, 20, 0);
+    lv_refr_now(NULL);
+    size_t cache_size = lv_cache_get_size(shadow_cache_p, NULL);
+    TEST_ASSERT_EQUAL(2 * 32 * 32, cache_size);
+
+    create_card(300, 30, 200, 100, 12, 20, 0);
+    create_card(300, 200, 400, 100, 12, 20, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(cache_size, lv_cache_get_size(shadow_cache_p, NULL));
+
+    /*The spread makes the blurred area larger, but the corner is the same*/
+    create_card(30, 200, 200, 100, 12, 20, 5);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(cache_size, lv_cache_get_size(shadow_cache_p, NULL));
+
+    /*Different shadow width*/
+    create_card(500, 350, 200, 100, 12, 10, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(cache_size + 2 * 22 * 22, lv_cache_get_size(shadow_cache_p, NULL));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_box_shadow_cache_render(void)
+{
+    TEST_PASS();
+}
+
+void test_box_shadow_cache_same_shape(void)
+{
+    TEST_PASS();
+}
+
+#endif
+
+#endif
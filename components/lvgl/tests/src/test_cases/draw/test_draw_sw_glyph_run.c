@@ -0,0 +1,112 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GLYPH_RUN
+
+#define CANVAS_W    400
+#define CANVAS_H    300
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * draw_buf;
+
+void setUp(void)
+{
+    draw_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(draw_buf);
+}
+
+static lv_draw_unit_t * get_sw_unit(void)
+{
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u && lv_draw_sw_get_sw_unit(u) == NULL) u = u->next;
+    TEST_ASSERT_NOT_NULL(u);
+    return u;
+}
+
+/*Draw directly with a software draw unit (glyph run) or with an other draw unit (glyphs one by one)*/
+static void draw_label(lv_draw_unit_t * unit, lv_layer_t * layer, const lv_draw_label_dsc_t * dsc,
+                       const lv_area_t * coords, const lv_area_t * clip)
+{
+    lv_layer_t * target_layer_ori = unit->target_layer;
+    const lv_area_t * clip_area_ori = unit->clip_area;
+    unit->target_layer = layer;
+    unit->clip_area = clip;
+    lv_draw_sw_label(unit, dsc, coords);
+    unit->target_layer = target_layer_ori;
+    unit->clip_area = clip_area_ori;
+}
+
+static void draw_labels(lv_draw_unit_t * unit)
+{
+    lv_canvas_fill_bg(canvas, lv_color_hex3(0xeee), LV_OPA_COVER);
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_area_t clip = {0, 0, CANVAS_W - 1, CANVAS_H - 1};
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+
+    /*Kerned and overlapping glyphs*/
+    dsc.text = "AVATAR WAVY Towel, LT Yoyo. fj ff\nThe quick brown fox jumps";
+    dsc.color = lv_color_hex(0x203080);
+    lv_area_t coords = {10, 10, 230, 60};
+    draw_label(unit, &layer, &dsc, &coords, &clip);
+
+    /*Negative letter space, underline, selection and opacity*/
+    dsc.letter_space = -2;
+    dsc.decor = LV_TEXT_DECOR_UNDERLINE;
+    dsc.sel_start = 4;
+    dsc.sel_end = 12;
+    dsc.sel_color = lv_color_white();
+    dsc.sel_bg_color = lv_color_hex(0x208020);
+    dsc.opa = LV_OPA_70;
+    lv_area_move(&coords, 0, 60);
+    draw_label(unit, &layer, &dsc, &coords, &clip);
+
+    /*Clipped glyphs and a larger font*/
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = "Clipped text with a larger font";
+    dsc.font = &lv_font_montserrat_28;
+    dsc.align = LV_TEXT_ALIGN_RIGHT;
+    lv_area_t clip_small = {40, 135, 200, 180};
+    lv_area_set(&coords, 10, 130, 390, 200);
+    draw_label(unit, &layer, &dsc, &coords, &clip_small);
+
+    /*Too large for the run*/
+    dsc.font = &lv_font_montserrat_48;
+    dsc.align = LV_TEXT_ALIGN_LEFT;
+    lv_area_set(&coords, 10, 200, 390, 290);
+    draw_label(unit, &layer, &dsc, &coords, &clip);
+}
+
+void test_draw_sw_glyph_run_same_as_glyphs(void)
+{
+    uint32_t buf_size = draw_buf->header.stride * CANVAS_H;
+    uint8_t * ref = lv_malloc(buf_size);
+    TEST_ASSERT_NOT_NULL(ref);
+
+    /*Glyphs one by one*/
+    lv_draw_unit_t other_unit;
+    lv_memzero(&other_unit, sizeof(other_unit));
+    draw_labels(&other_unit);
+    lv_memcpy(ref, draw_buf->data, buf_size);
+
+    draw_labels(get_sw_unit());
+    TEST_ASSERT_EQUAL_MEMORY(ref, draw_buf->data, buf_size);
+
+    lv_free(ref);
+}
+
+#endif
+
+#endif
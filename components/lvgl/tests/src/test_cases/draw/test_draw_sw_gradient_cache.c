@@ -0,0 +1,192 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../src/draw/sw/lv_draw_sw_gradient_private.h"
+
+#include "unity/unity.h"
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->sw_grad_cache)
+
+void setUp(void)
+{
+    lv_cache_drop_all(grad_cache_p, NULL);
+    lv_cache_set_max_size(grad_cache_p, LV_DRAW_SW_GRADIENT_CACHE_SIZE, NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_cache_drop_all(grad_cache_p, NULL);
+    lv_cache_set_max_size(grad_cache_p, LV_DRAW_SW_GRADIENT_CACHE_SIZE, NULL);
+}
+
+static void init_grad_dsc(lv_grad_dsc_t * dsc, lv_grad_dir_t dir, lv_color_t c1, lv_color_t c2)
+{
+    lv_memzero(dsc, sizeof(lv_grad_dsc_t));
+    dsc->dir = dir;
+    dsc->stops_count = 2;
+    dsc->stops[0].color = c1;
+    dsc->stops[0].opa = LV_OPA_COVER;
+    dsc->stops[0].frac = 0;
+    dsc->stops[1].color = c2;
+    dsc->stops[1].opa = LV_OPA_COVER;
+    dsc->stops[1].frac = 255;
+}
+
+void test_gradient_map_is_reused(void)
+{
+    lv_grad_dsc_t dsc;
+    init_grad_dsc(&dsc, LV_GRAD_DIR_VER, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+
+    lv_grad_t * grad1 = lv_gradient_get(&dsc, 100, 80);
+    TEST_ASSERT_NOT_NULL(grad1);
+    TEST_ASSERT_NOT_NULL(grad1->cache_entry);
+    TEST_ASSERT_EQUAL_INT32(80, grad1->size);
+    size_t cache_size = lv_cache_get_size(grad_cache_p, NULL);
+    TEST_ASSERT_GREATER_THAN(0, cache_size);
+
+    /*Acquired again while the first one is still used*/
+    lv_grad_t * grad2 = lv_gradient_get(&dsc, 50, 80);
+    TEST_ASSERT_EQUAL_PTR(grad1, grad2);
+    lv_gradient_cleanup(grad2);
+    lv_gradient_cleanup(grad1);
+
+    /*A horizontal gradient with the same stops and size has the same map*/
+    dsc.dir = LV_GRAD_DIR_HOR;
+    grad2 = lv_gradient_get(&dsc, 80, 10);
+    TEST_ASSERT_EQUAL_PTR(grad1, grad2);
+    lv_gradient_cleanup(grad2);
+
+    TEST_ASSERT_EQUAL(cache_size, lv_cache_get_size(grad_cache_p, NULL));
+}
+
+void test_gradient_map_key(void)
+{
+    lv_grad_dsc_t dsc;
+    init_grad_dsc(&dsc, LV_GRAD_DIR_VER, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+    lv_grad_t * grad1 = lv_gradient_get(&dsc, 100, 80);
+
+    /*Different size*/
+    lv_grad_t * grad2 = lv_gradient_get(&dsc, 100, 81);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad2);
+    TEST_ASSERT_EQUAL_INT32(81, grad2->size);
+    lv_gradient_cleanup(grad2);
+
+    /*Different color*/
+    dsc.stops[1].color = lv_color_hex(0x0000fe);
+    grad2 = lv_gradient_get(&dsc, 100, 80);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000fe), grad2->color_map[79]);
+    lv_gradient_cleanup(grad2);
+
+    /*Different opacity*/
+    dsc.stops[1].color = lv_color_hex(0x0000ff);
+    dsc.stops[1].opa = LV_OPA_50;
+    grad2 = lv_gradient_get(&dsc, 100, 80);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad2);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, grad2->opa_map[79]);
+    lv_gradient_cleanup(grad2);
+
+    lv_gradient_cleanup(grad1);
+}
+
+static uint32_t log_error_cnt;
+
+static void count_log_errors_cb(lv_log_level_t level, const char * buf)
+{
+    LV_UNUSED(buf);
+    if(level == LV_LOG_LEVEL_ERROR) log_error_cnt++;
+}
+
+void test_gradient_map_too_large_for_the_cache(void)
+{
+    lv_grad_dsc_t dsc;
+    init_grad_dsc(&dsc, LV_GRAD_DIR_HOR, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+
+    log_error_cnt = 0;
+    lv_log_register_print_cb(count_log_errors_cb);
+
+    /*Doesn't fit into the cache, so a not cached map is returned*/
+    int32_t w = LV_DRAW_SW_GRADIENT_CACHE_SIZE;
+    lv_grad_t * grad = lv_gradient_get(&dsc, w, 10);
+    TEST_ASSERT_NOT_NULL(grad);
+    TEST_ASSERT_NULL(grad->cache_entry);
+    TEST_ASSERT_EQUAL_INT32(w, grad->size);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), grad->color_map[w - 1]);
+    lv_gradient_cleanup(grad);
+
+    lv_log_register_print_cb(NULL);
+
+    /*It's not an error, so it must not be logged on every draw*/
+    TEST_ASSERT_EQUAL_UINT32(0, log_error_cnt);
+}
+
+static lv_obj_t * create_grad_obj(lv_grad_dir_t dir, lv_color_t c1, lv_color_t c2, int32_t y)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 240, 100);
+    lv_obj_set_y(obj, y);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, c1, 0);
+    lv_obj_set_style_bg_grad_color(obj, c2, 0);
+    lv_obj_set_style_bg_grad_dir(obj, dir, 0);
+    return obj;
+}
+
+void test_gradient_cache_render(void)
+{
+    create_grad_obj(LV_GRAD_DIR_VER, lv_color_hex(0xff0000), lv_color_hex(0x0000ff), 0);
+    create_grad_obj(LV_GRAD_DIR_HOR, lv_color_hex(0x00ff00), lv_color_hex(0xffff00), 110);
+    lv_obj_set_style_radius(create_grad_obj(LV_GRAD_DIR_VER, lv_color_hex(0x00ffff), lv_color_hex(0x000000), 220), 20, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/gradient_cache.png");
+    TEST_ASSERT_GREATER_THAN(0, lv_cache_get_size(grad_cache_p, NULL));
+
+    /*Rendered from the cached maps*/
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/gradient_cache.png");
+
+    /*The same without cache*/
+    lv_cache_drop_all(grad_cache_p, NULL);
+    lv_cache_set_max_size(grad_cache_p, 0, NULL);
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/gradient_cache.png");
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(grad_cache_p, NULL));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_gradient_map_is_reused(void)
+{
+    TEST_PASS();
+}
+
+void test_gradient_map_key(void)
+{
+    TEST_PASS();
+}
+
+void test_gradient_map_too_large_for_the_cache(void)
+{
+    TEST_PASS();
+}
+
+void test_gradient_cache_render(void)
+{
+    TEST_PASS();
+}
+
+#endif
+
+#endif
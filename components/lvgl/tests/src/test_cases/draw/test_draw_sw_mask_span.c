@@ -0,0 +1,86 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * create_rect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, lv_opa_t opa)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_opa(obj, opa, 0);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_radius(obj, radius, 0);
+    return obj;
+}
+
+static void create_arc(int32_t x, int32_t y, int32_t size, int32_t width)
+{
+    lv_obj_t * arc = lv_arc_create(lv_screen_active());
+    lv_obj_set_pos(arc, x, y);
+    lv_obj_set_size(arc, size, size);
+    lv_obj_set_style_arc_width(arc, width, 0);
+    lv_obj_set_style_arc_width(arc, width, LV_PART_INDICATOR);
+    lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
+    lv_arc_set_value(arc, 70);
+}
+
+static void create_image(int32_t x, int32_t y, const void * src, int32_t radius)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_obj_set_pos(img, x, y);
+    lv_image_set_src(img, src);
+    lv_obj_set_style_radius(img, radius, 0);
+}
+
+static void create_scene(void)
+{
+    lv_obj_set_style_bg_color(lv_screen_active(), lv_palette_lighten(LV_PALETTE_GREY, 3), 0);
+
+    /*Wide lines where most of the mask is fully opaque or transparent*/
+    create_rect(20, 20, 300, 120, 20, LV_OPA_COVER);
+    create_rect(340, 20, 200, 120, LV_RADIUS_CIRCLE, LV_OPA_COVER);
+    create_rect(560, 20, 220, 120, 60, LV_OPA_50);
+
+    /*Narrow enough not to be split*/
+    create_rect(20, 160, 24, 60, 12, LV_OPA_COVER);
+    create_rect(60, 160, 40, 60, 8, LV_OPA_70);
+
+    create_arc(120, 160, 140, 20);
+    create_arc(280, 160, 200, 60);
+
+    create_image(500, 160, &test_image_cogwheel_rgb565, 30);
+    create_image(640, 160, &test_image_cogwheel_argb8888, LV_RADIUS_CIRCLE);
+
+    /*Rounded clip area on the children*/
+    lv_obj_t * cont = create_rect(20, 380, 400, 80, 30, LV_OPA_COVER);
+    lv_obj_set_style_clip_corner(cont, true, 0);
+    lv_obj_t * child = lv_obj_create(cont);
+    lv_obj_remove_style_all(child);
+    lv_obj_set_size(child, 400, 40);
+    lv_obj_set_style_bg_opa(child, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(child, lv_palette_main(LV_PALETTE_RED), 0);
+}
+
+void test_mask_span_render(void)
+{
+    create_scene();
+    TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE("draw/mask_span.png", LV_TEST_ARC_TOLERANCE);
+}
+
+#endif
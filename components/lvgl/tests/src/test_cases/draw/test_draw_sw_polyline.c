@@ -0,0 +1,88 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_SIZE 100
+
+static lv_draw_buf_t * canvas_buf;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    if(canvas_buf) lv_draw_buf_destroy(canvas_buf);
+    canvas_buf = NULL;
+}
+
+static lv_obj_t * create_line(const lv_point_precise_t * points, uint32_t point_cnt, int32_t x, int32_t y,
+                              int32_t width, bool rounded, lv_opa_t opa)
+{
+    lv_obj_t * line = lv_line_create(lv_screen_active());
+    lv_line_set_points(line, points, point_cnt);
+    lv_obj_set_pos(line, x, y);
+    lv_obj_set_style_line_width(line, width, 0);
+    lv_obj_set_style_line_rounded(line, rounded, 0);
+    lv_obj_set_style_line_opa(line, opa, 0);
+    return line;
+}
+
+void test_polyline_render(void)
+{
+    static const lv_point_precise_t zigzag[] = {{0, 60}, {40, 0}, {80, 60}, {120, 0}, {160, 60}};
+    static const lv_point_precise_t square[] = {{0, 0}, {100, 0}, {100, 100}, {0, 100}, {0, 0}};
+    static const lv_point_precise_t spike[] = {{0, 80}, {30, 0}, {60, 80}, {61, 0}, {200, 40}};
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        int32_t width = 1 + i * 4;
+        create_line(zigzag, 5, 20 + i * 190, 20, width, false, LV_OPA_COVER);
+        create_line(square, 5, 40 + i * 190, 130, width, i % 2, LV_OPA_50);
+        create_line(spike, 5, 10 + i * 190, 290, width, true, LV_OPA_COVER);
+    }
+
+    /*Dashed lines are still drawn line by line*/
+    lv_obj_t * line = create_line(square, 5, 20, 370, 3, false, LV_OPA_COVER);
+    lv_obj_set_style_line_dash_width(line, 6, 0);
+    lv_obj_set_style_line_dash_gap(line, 4, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/polyline.png");
+}
+
+void test_polyline_joints_are_blended_once(void)
+{
+    canvas_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, 0);
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    /*A joint in the middle and a segment going back on the previous one*/
+    static const lv_point_precise_t points[] = {{10, 10}, {50, 50}, {90, 10}, {70, 30}};
+    lv_draw_line_dsc_t dsc;
+    lv_draw_line_dsc_init(&dsc);
+    dsc.color = lv_color_black();
+    dsc.opa = LV_OPA_50;
+    dsc.width = 9;
+    dsc.points = points;
+    dsc.point_cnt = 4;
+    lv_draw_polyline(&layer, &dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    const lv_color32_t * px_body = lv_draw_buf_goto_xy(canvas_buf, 30, 30);
+    const lv_color32_t * px_joint = lv_draw_buf_goto_xy(canvas_buf, 50, 50);
+    const lv_color32_t * px_overlap = lv_draw_buf_goto_xy(canvas_buf, 75, 25);
+    TEST_ASSERT_UINT8_WITHIN(2, 0x80, px_body->green);
+    TEST_ASSERT_EQUAL_UINT8(px_body->green, px_joint->green);
+    TEST_ASSERT_EQUAL_UINT8(px_body->green, px_overlap->green);
+}
+
+#endif
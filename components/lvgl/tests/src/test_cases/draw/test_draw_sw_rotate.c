@@ -0,0 +1,103 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define MAX_SIZE    100
+#define BUF_SIZE    ((MAX_SIZE * 4 + 64) * (MAX_SIZE + 8))
+
+static uint8_t src_buf[BUF_SIZE];
+static uint8_t dst_buf[BUF_SIZE];
+static uint8_t ref_buf[BUF_SIZE];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/*Rotate pixel by pixel, walking the columns of the source*/
+static void rotate_ref(const uint8_t * src, uint8_t * dst, int32_t w, int32_t h, int32_t src_stride,
+                       int32_t dst_stride, lv_display_rotation_t rotation, uint32_t px_size)
+{
+    int32_t x, y;
+    for(x = 0; x < w; x++) {
+        for(y = 0; y < h; y++) {
+            uint8_t * d;
+            if(rotation == LV_DISPLAY_ROTATION_90) d = dst + (w - x - 1) * dst_stride + y * px_size;
+            else if(rotation == LV_DISPLAY_ROTATION_180) d = dst + (h - y - 1) * dst_stride + (w - x - 1) * px_size;
+            else d = dst + x * dst_stride + (h - y - 1) * px_size;
+            const uint8_t * s = src + y * src_stride + x * px_size;
+            if(px_size == 1) *d = *s;
+            else if(px_size == 2) *(uint16_t *)d = *(const uint16_t *)s;
+            else if(px_size == 4) *(uint32_t *)d = *(const uint32_t *)s;
+            else {
+                d[0] = s[0];
+                d[1] = s[1];
+                d[2] = s[2];
+            }
+        }
+    }
+}
+
+static void test_rotate(lv_color_format_t cf, int32_t w, int32_t h, int32_t pad)
+{
+    static const lv_display_rotation_t rotations[] = {LV_DISPLAY_ROTATION_90, LV_DISPLAY_ROTATION_180, LV_DISPLAY_ROTATION_270};
+    uint32_t px_size = lv_color_format_get_size(cf);
+    int32_t src_stride = w * px_size + pad;
+
+    uint32_t i;
+    for(i = 0; i < BUF_SIZE; i++) src_buf[i] = (uint8_t)(i * 7 + i / 251);
+
+    for(i = 0; i < 3; i++) {
+        bool swap = rotations[i] != LV_DISPLAY_ROTATION_180;
+        int32_t dst_w = swap ? h : w;
+        int32_t dst_h = swap ? w : h;
+        int32_t dst_stride = dst_w * px_size + pad;
+
+        lv_memset(dst_buf, 0xaa, BUF_SIZE);
+        lv_memset(ref_buf, 0xaa, BUF_SIZE);
+        rotate_ref(src_buf, ref_buf, w, h, src_stride, dst_stride, rotations[i], px_size);
+        lv_draw_sw_rotate(src_buf, dst_buf, w, h, src_stride, dst_stride, rotations[i], cf);
+
+        /*The padding must be untouched too*/
+        TEST_ASSERT_EQUAL_MEMORY(ref_buf, dst_buf, dst_stride * dst_h);
+    }
+}
+
+static void test_sizes(lv_color_format_t cf)
+{
+    test_rotate(cf, 1, 1, 0);
+    test_rotate(cf, 8, 8, 0);
+    test_rotate(cf, 16, 4, 3 * lv_color_format_get_size(cf));
+    test_rotate(cf, 37, 23, 5 * lv_color_format_get_size(cf));
+    test_rotate(cf, 64, 17, 0);
+    test_rotate(cf, MAX_SIZE, 77, 64);
+}
+
+void test_rotate_l8(void)
+{
+    test_sizes(LV_COLOR_FORMAT_L8);
+}
+
+void test_rotate_rgb565(void)
+{
+    test_sizes(LV_COLOR_FORMAT_RGB565);
+}
+
+void test_rotate_rgb888(void)
+{
+    test_sizes(LV_COLOR_FORMAT_RGB888);
+}
+
+void test_rotate_argb8888(void)
+{
+    test_sizes(LV_COLOR_FORMAT_ARGB8888);
+}
+
+#endif
@@ -0,0 +1,221 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*A portrait panel used in landscape orientation with about 1/4 screen sized partial buffer.
+ *64 landscape rows keep the stride aligned in both orientations for a fair comparison.*/
+#define PANEL_HOR_RES   240
+#define PANEL_VER_RES   320
+#define BUF_SIZE        (PANEL_VER_RES * 64 * 2)
+
+static uint8_t fb_ref[PANEL_HOR_RES * PANEL_VER_RES * 4];
+static uint8_t fb_act[PANEL_HOR_RES * PANEL_VER_RES * 4];
+static uint8_t draw_buf_mem[BUF_SIZE + LV_DRAW_BUF_ALIGN];
+static uint8_t rotated_buf_mem[(PANEL_VER_RES * 4 + LV_DRAW_BUF_STRIDE_ALIGN) * PANEL_VER_RES + LV_DRAW_BUF_ALIGN];
+
+static uint32_t flush_cnt;
+static bool flushed_full_columns;
+
+static lv_display_t * disp;
+static lv_display_t * disp_ori;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    uint8_t * fb = lv_display_get_user_data(d);
+    lv_area_t rotated_area = *area;
+    lv_display_rotation_t rotation = lv_display_get_rotation(d);
+    lv_color_format_t cf = lv_display_get_color_format(d);
+    uint32_t px_size = lv_color_format_get_size(cf);
+
+    /*Rotate the rendered area as the drivers do without rotated rendering*/
+    if(rotation != LV_DISPLAY_ROTATION_0 && !lv_display_get_rotated_rendering(d)) {
+        int32_t w = lv_area_get_width(area);
+        int32_t h = lv_area_get_height(area);
+        uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
+        uint32_t h_stride = lv_draw_buf_width_to_stride(h, cf);
+        uint8_t * rotated_buf = lv_draw_buf_align(rotated_buf_mem, cf);
+        lv_draw_sw_rotate(px_map, rotated_buf, w, h, w_stride, rotation == LV_DISPLAY_ROTATION_180 ? w_stride : h_stride,
+                          rotation, cf);
+        px_map = rotated_buf;
+        lv_display_rotate_area(d, &rotated_area);
+    }
+
+    flush_cnt++;
+    if(lv_area_get_height(&rotated_area) != PANEL_VER_RES) flushed_full_columns = false;
+
+    int32_t w = lv_area_get_width(&rotated_area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    int32_t y;
+    for(y = rotated_area.y1; y <= rotated_area.y2; y++) {
+        lv_memcpy(&fb[(y * PANEL_HOR_RES + rotated_area.x1) * px_size], px_map, w * px_size);
+        px_map += stride;
+    }
+
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    disp_ori = lv_display_get_default();
+    disp = lv_display_create(PANEL_HOR_RES, PANEL_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf_mem, LV_COLOR_FORMAT_RGB565), NULL,
+                           BUF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+}
+
+void tearDown(void)
+{
+    lv_display_set_default(disp_ori);
+    lv_display_delete(disp);
+    disp = NULL;
+}
+
+static void create_ui(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_BLUE, 4), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_palette_darken(LV_PALETTE_BLUE, 2), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_HOR, 0);
+
+    lv_obj_t * btn = lv_button_create(scr);
+    lv_obj_set_pos(btn, 10, 10);
+    lv_obj_set_size(btn, 140, 50);
+    lv_obj_set_style_shadow_width(btn, 20, 0);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Rotated button");
+    lv_obj_center(label);
+
+    lv_obj_t * slider = lv_slider_create(scr);
+    lv_obj_set_pos(slider, 20, 90);
+    lv_obj_set_width(slider, 130);
+    lv_slider_set_value(slider, 40, LV_ANIM_OFF);
+
+    lv_obj_t * arc = lv_arc_create(scr);
+    lv_obj_set_pos(arc, 170, 10);
+    lv_obj_set_size(arc, 130, 130);
+    lv_arc_set_value(arc, 70);
+
+    lv_obj_t * img = lv_image_create(scr);
+    lv_image_set_src(img, &test_image_cogwheel_argb8888);
+    lv_obj_set_pos(img, 5, 120);
+
+    img = lv_image_create(scr);
+    lv_image_set_src(img, &test_image_cogwheel_rgb565);
+    lv_obj_set_pos(img, 110, 130);
+    lv_image_set_rotation(img, 300);
+    lv_obj_set_style_image_opa(img, LV_OPA_70, 0);
+
+    label = lv_label_create(scr);
+    lv_label_set_text(label, "The quick brown fox\njumps over the lazy dog");
+    lv_obj_set_pos(label, 180, 170);
+    lv_obj_set_style_text_opa(label, LV_OPA_80, 0);
+}
+
+static void render(uint8_t * fb, bool rotated)
+{
+    lv_display_set_user_data(disp, fb);
+    lv_display_set_rotated_rendering(disp, rotated);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+}
+
+static void test_rotation(lv_display_rotation_t rotation)
+{
+    lv_display_set_rotation(disp, rotation);
+    create_ui();
+
+    lv_memzero(fb_ref, sizeof(fb_ref));
+    lv_memzero(fb_act, sizeof(fb_act));
+    render(fb_ref, false);
+    render(fb_act, true);
+
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, fb_act, sizeof(fb_ref));
+}
+
+void test_rotated_render_90(void)
+{
+    test_rotation(LV_DISPLAY_ROTATION_90);
+}
+
+void test_rotated_render_180(void)
+{
+    test_rotation(LV_DISPLAY_ROTATION_180);
+}
+
+void test_rotated_render_270(void)
+{
+    test_rotation(LV_DISPLAY_ROTATION_270);
+}
+
+static void draw_post_event_cb(lv_event_t * e)
+{
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    lv_vector_dsc_t * ctx = lv_vector_dsc_create(layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_fpoint_t pc = {240, 60};
+    lv_vector_path_append_circle(path, &pc, 50, 30);
+    lv_vector_dsc_set_fill_color32(ctx, lv_color_to_32(lv_palette_main(LV_PALETTE_RED), LV_OPA_70));
+    lv_vector_dsc_add_path(ctx, path);
+    lv_area_t rect = {20, 150, 120, 200};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_rect(path, &rect, 10, 10);
+    lv_vector_dsc_rotate(ctx, 10);
+    lv_vector_dsc_set_fill_color(ctx, lv_palette_main(LV_PALETTE_GREEN));
+    lv_vector_dsc_add_path(ctx, path);
+    lv_draw_vector(ctx);
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(ctx);
+
+    lv_draw_mask_rect_dsc_t mask_dsc;
+    lv_draw_mask_rect_dsc_init(&mask_dsc);
+    lv_area_set(&mask_dsc.area, 15, 15, 300, 220);
+    mask_dsc.radius = 60;
+    lv_draw_mask_rect(layer, &mask_dsc);
+}
+
+void test_rotated_render_mask_and_vector(void)
+{
+    /*Rectangle masks and vector graphics are drawn to a not rotated temporary layer*/
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_ARGB8888);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf_mem, LV_COLOR_FORMAT_ARGB8888), NULL,
+                           BUF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_obj_add_event_cb(lv_screen_active(), draw_post_event_cb, LV_EVENT_DRAW_POST, NULL);
+
+    lv_display_rotation_t rotation;
+    for(rotation = LV_DISPLAY_ROTATION_90; rotation <= LV_DISPLAY_ROTATION_270; rotation++) {
+        lv_obj_clean(lv_screen_active());
+        lv_display_set_rotation(disp, rotation);
+        create_ui();
+
+        lv_memzero(fb_ref, sizeof(fb_ref));
+        lv_memzero(fb_act, sizeof(fb_act));
+        render(fb_ref, false);
+        render(fb_act, true);
+
+        TEST_ASSERT_EQUAL_MEMORY(fb_ref, fb_act, sizeof(fb_ref));
+    }
+}
+
+void test_rotated_render_flushes_rotated_areas(void)
+{
+    lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_90);
+    create_ui();
+
+    flush_cnt = 0;
+    flushed_full_columns = true;
+    render(fb_act, true);
+
+    /*The rows of the landscape screen are the columns of the panel*/
+    TEST_ASSERT_GREATER_THAN_UINT32(1, flush_cnt);
+    TEST_ASSERT_TRUE(flushed_full_columns);
+}
+
+#endif
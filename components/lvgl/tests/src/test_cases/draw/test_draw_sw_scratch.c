@@ -0,0 +1,174 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_draw_sw_unit_t * get_sw_unit(void)
+{
+    /*Only the software draw unit is created in the tests*/
+    TEST_ASSERT_EQUAL(1, LV_GLOBAL_DEFAULT()->draw_info.unit_cnt);
+    return (lv_draw_sw_unit_t *)LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_widgets(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 300, 200);
+    lv_obj_set_style_radius(obj, 30, 0);
+    lv_obj_set_style_shadow_width(obj, 20, 0);
+    lv_obj_set_style_border_width(obj, 3, 0);
+
+    lv_obj_t * arc = lv_arc_create(lv_screen_active());
+    lv_obj_set_pos(arc, 350, 20);
+
+    static lv_point_precise_t points[] = {{0, 0}, {100, 30}, {150, 120}};
+    lv_obj_t * line = lv_line_create(lv_screen_active());
+    lv_line_set_points(line, points, 3);
+    lv_obj_set_style_line_width(line, 5, 0);
+    lv_obj_set_style_line_rounded(line, true, 0);
+    lv_obj_set_pos(line, 550, 100);
+}
+
+void test_scratch_is_reused(void)
+{
+    lv_draw_sw_unit_t * u = get_sw_unit();
+    TEST_ASSERT_NOT_NULL(u);
+
+    create_widgets();
+    lv_refr_now(NULL);
+
+    /*It's enlarged to the largest need*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(u->scratch_buf);
+    TEST_ASSERT_GREATER_THAN(0, u->scratch_size);
+    TEST_ASSERT_EQUAL_UINT32(0, u->scratch_used);
+
+    /*Doesn't grow if the same is drawn again*/
+    uint8_t * scratch_buf = u->scratch_buf;
+    uint32_t scratch_size = u->scratch_size;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(scratch_buf, u->scratch_buf);
+    TEST_ASSERT_EQUAL_UINT32(scratch_size, u->scratch_size);
+    TEST_ASSERT_EQUAL_UINT32(0, u->scratch_used);
+}
+
+void test_scratch_alloc(void)
+{
+    lv_draw_sw_unit_t * u = get_sw_unit();
+    lv_draw_unit_t * draw_unit = (lv_draw_unit_t *)u;
+
+    create_widgets();
+    lv_refr_now(NULL);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_OR_EQUAL(64, u->scratch_size);
+
+    /*Allocated from the scratch buffer and aligned*/
+    uint8_t * buf1 = lv_draw_sw_scratch_alloc(draw_unit, 3);
+    uint8_t * buf2 = lv_draw_sw_scratch_alloc(draw_unit, 20);
+    TEST_ASSERT_EQUAL_PTR(u->scratch_buf, buf1);
+    TEST_ASSERT_EQUAL_PTR(u->scratch_buf + 8, buf2);
+    TEST_ASSERT_EQUAL_UINT32(8 + 24, u->scratch_used);
+
+    /*Doesn't fit, so it's allocated from the heap*/
+    uint32_t required = u->scratch_used + u->scratch_size;
+    uint8_t * buf3 = lv_draw_sw_scratch_alloc(draw_unit, u->scratch_size);
+    TEST_ASSERT_NOT_NULL(buf3);
+    TEST_ASSERT_TRUE(buf3 < u->scratch_buf || buf3 >= u->scratch_buf + u->scratch_size);
+    TEST_ASSERT_EQUAL_UINT32(required, u->scratch_required);
+    TEST_ASSERT_EQUAL_UINT32(8 + 24, u->scratch_used);
+
+    lv_draw_sw_scratch_free(draw_unit, buf3);
+    lv_draw_sw_scratch_free(draw_unit, buf2);
+    TEST_ASSERT_EQUAL_UINT32(8, u->scratch_used);
+    lv_draw_sw_scratch_free(draw_unit, buf1);
+    TEST_ASSERT_EQUAL_UINT32(0, u->scratch_used);
+
+    /*Enlarged for the next task*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(required, u->scratch_size);
+
+    /*Not a software draw unit*/
+    uint8_t * buf4 = lv_draw_sw_scratch_alloc(NULL, 16);
+    TEST_ASSERT_NOT_NULL(buf4);
+    TEST_ASSERT_EQUAL_UINT32(0, u->scratch_used);
+    lv_draw_sw_scratch_free(NULL, buf4);
+}
+
+static void refr_n(uint32_t n)
+{
+    uint32_t i;
+    for(i = 0; i < n; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+}
+
+void test_scratch_shrink(void)
+{
+    lv_draw_sw_unit_t * u = get_sw_unit();
+    lv_draw_unit_t * draw_unit = (lv_draw_unit_t *)u;
+
+    /*Start without the scratch memory enlarged by the other tests*/
+    refr_n(LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT);
+    TEST_ASSERT_NULL(u->scratch_buf);
+
+    create_widgets();
+    refr_n(2);
+    uint32_t scratch_size = u->scratch_size;
+    TEST_ASSERT_GREATER_THAN(0, scratch_size);
+
+    /*A large buffer enlarges the scratch memory for the next refresh*/
+    lv_draw_sw_scratch_free(draw_unit, lv_draw_sw_scratch_alloc(draw_unit, 100 * 1024));
+    refr_n(1);
+    TEST_ASSERT_GREATER_OR_EQUAL(100 * 1024, u->scratch_size);
+    uint8_t * large_buf = u->scratch_buf;
+
+    /*It's kept for a while even if the refreshes need much less*/
+    refr_n(LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT - 1);
+    TEST_ASSERT_EQUAL_PTR(large_buf, u->scratch_buf);
+    TEST_ASSERT_GREATER_OR_EQUAL(100 * 1024, u->scratch_size);
+
+    /*Refreshes without invalid areas don't count*/
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT; i++) lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(large_buf, u->scratch_buf);
+
+    /*But it's shrunk to the real need after enough refreshes*/
+    refr_n(1);
+    TEST_ASSERT_EQUAL_UINT32(scratch_size, u->scratch_size);
+    TEST_ASSERT_NOT_NULL(u->scratch_buf);
+
+    /*Kept as long as the refreshes need more than half of it*/
+    refr_n(LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT * 2);
+    TEST_ASSERT_EQUAL_UINT32(scratch_size, u->scratch_size);
+
+    /*Freed if nothing needed it for enough refreshes*/
+    lv_obj_clean(lv_screen_active());
+    refr_n(LV_DRAW_SW_SCRATCH_SHRINK_REFR_CNT - 1);
+    TEST_ASSERT_EQUAL_UINT32(scratch_size, u->scratch_size);
+    refr_n(1);
+    TEST_ASSERT_NULL(u->scratch_buf);
+    TEST_ASSERT_EQUAL_UINT32(0, u->scratch_size);
+
+    /*Allocated again when needed*/
+    create_widgets();
+    refr_n(2);
+    TEST_ASSERT_EQUAL_UINT32(scratch_size, u->scratch_size);
+}
+
+#endif
@@ -0,0 +1,171 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_SIZE 120
+#define IMG_W       40
+#define IMG_H       30
+#define IMG_OFS     40
+
+static lv_draw_buf_t * canvas_buf;
+static lv_draw_buf_t * ref_buf;
+static lv_draw_buf_t * img_buf;
+
+void setUp(void)
+{
+    canvas_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_ARGB8888, 0);
+    ref_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_ARGB8888, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(canvas_buf);
+    canvas_buf = NULL;
+    lv_draw_buf_destroy(ref_buf);
+    ref_buf = NULL;
+    if(img_buf) lv_draw_buf_destroy(img_buf);
+    img_buf = NULL;
+}
+
+static uint32_t img_px_color(int32_t x, int32_t y)
+{
+    return 0xff000000 | (uint32_t)(x * 6) << 16 | (uint32_t)(y * 8) << 8 | (uint32_t)((x * 7 + y * 13) & 0xff);
+}
+
+static void create_img(lv_color_format_t cf)
+{
+    img_buf = lv_draw_buf_create(IMG_W, IMG_H, cf, 0);
+    int32_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            uint32_t c = img_px_color(x, y);
+            if(cf == LV_COLOR_FORMAT_ARGB8888) {
+                *(uint32_t *)lv_draw_buf_goto_xy(img_buf, x, y) = c;
+            }
+            else {
+                *(uint16_t *)lv_draw_buf_goto_xy(img_buf, x, y) = lv_color_to_u16(lv_color_hex(c));
+            }
+        }
+    }
+}
+
+static void draw_img(lv_draw_buf_t * buf, int32_t rotation, int32_t scale, bool aa)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, buf);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = img_buf;
+    dsc.rotation = rotation;
+    dsc.scale_x = scale;
+    dsc.scale_y = scale;
+    dsc.pivot.x = IMG_W / 2;
+    dsc.pivot.y = IMG_H / 2;
+    dsc.antialias = aa;
+    lv_area_t coords = {IMG_OFS, IMG_OFS, IMG_OFS + IMG_W - 1, IMG_OFS + IMG_H - 1};
+    lv_draw_image(&layer, &dsc, &coords);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static uint32_t get_px(lv_draw_buf_t * buf, int32_t x, int32_t y)
+{
+    return *(uint32_t *)lv_draw_buf_goto_xy(buf, x, y);
+}
+
+/*Check that every pixel of the canvas is the background or exactly the pixel of the not transformed image
+ *it was rotated from. The pivot is the center of a pixel.*/
+static void check_right_angle(int32_t rotation, lv_color_format_t cf)
+{
+    create_img(cf);
+    draw_img(ref_buf, 0, LV_SCALE_NONE, true);
+    draw_img(canvas_buf, rotation, LV_SCALE_NONE, true);
+
+    int32_t px = IMG_OFS + IMG_W / 2;
+    int32_t py = IMG_OFS + IMG_H / 2;
+    int32_t img_px_cnt = 0;
+    int32_t x, y;
+    for(y = 0; y < CANVAS_SIZE; y++) {
+        for(x = 0; x < CANVAS_SIZE; x++) {
+            uint32_t c = get_px(canvas_buf, x, y);
+            if(c == 0xff000000) continue;
+
+            int32_t xs, ys;
+            if(rotation == 900) {
+                xs = px + (y - py);
+                ys = py - (x - px);
+            }
+            else if(rotation == 1800) {
+                xs = 2 * px - x;
+                ys = 2 * py - y;
+            }
+            else {
+                xs = px - (y - py);
+                ys = py + (x - px);
+            }
+
+            TEST_ASSERT_TRUE(xs >= IMG_OFS && xs < IMG_OFS + IMG_W && ys >= IMG_OFS && ys < IMG_OFS + IMG_H);
+            TEST_ASSERT_EQUAL_HEX32(get_px(ref_buf, xs, ys), c);
+            img_px_cnt++;
+        }
+    }
+
+    /*Only the pixels from the first row and column of the image can be out of the transformed area
+     *(and the black pixel of the image)*/
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(IMG_W * IMG_H - IMG_W - IMG_H, img_px_cnt);
+}
+
+void test_transform_rotate_90_argb8888(void)
+{
+    check_right_angle(900, LV_COLOR_FORMAT_ARGB8888);
+}
+
+void test_transform_rotate_180_argb8888(void)
+{
+    check_right_angle(1800, LV_COLOR_FORMAT_ARGB8888);
+}
+
+void test_transform_rotate_270_argb8888(void)
+{
+    check_right_angle(2700, LV_COLOR_FORMAT_ARGB8888);
+}
+
+void test_transform_rotate_90_rgb565(void)
+{
+    check_right_angle(900, LV_COLOR_FORMAT_RGB565);
+}
+
+void test_transform_scale_2x_without_antialiasing(void)
+{
+    create_img(LV_COLOR_FORMAT_ARGB8888);
+    draw_img(canvas_buf, 0, 2 * LV_SCALE_NONE, false);
+
+    /*No interpolation: each pixel is a source pixel which is at the half distance from the pivot
+     *(rounded down or up)*/
+    int32_t x, y;
+    for(y = IMG_OFS; y < IMG_OFS + IMG_H; y++) {
+        for(x = IMG_OFS; x < IMG_OFS + IMG_W; x++) {
+            int32_t dx = x - IMG_OFS - IMG_W / 2 + 2 * IMG_W;
+            int32_t dy = y - IMG_OFS - IMG_H / 2 + 2 * IMG_H;
+            uint32_t c = get_px(canvas_buf, x, y);
+            bool found = false;
+            int32_t i;
+            for(i = 0; i < 4; i++) {
+                int32_t xs = IMG_W / 2 + (dx + (i & 1)) / 2 - IMG_W;
+                int32_t ys = IMG_H / 2 + (dy + (i >> 1)) / 2 - IMG_H;
+                if(c == img_px_color(xs, ys)) found = true;
+            }
+            TEST_ASSERT_TRUE(found);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_SIZE 200
+
+static lv_draw_buf_t * canvas_buf;
+
+void setUp(void)
+{
+    canvas_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(canvas_buf);
+    canvas_buf = NULL;
+}
+
+static void draw_triangle(lv_layer_t * layer, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                          lv_grad_dir_t grad_dir)
+{
+    lv_draw_triangle_dsc_t dsc;
+    lv_draw_triangle_dsc_init(&dsc);
+    dsc.bg_color = lv_color_black();
+    dsc.p[0].x = x0;
+    dsc.p[0].y = y0;
+    dsc.p[1].x = x1;
+    dsc.p[1].y = y1;
+    dsc.p[2].x = x2;
+    dsc.p[2].y = y2;
+    dsc.bg_grad.dir = grad_dir;
+    dsc.bg_grad.stops[0].color = lv_palette_main(LV_PALETTE_RED);
+    dsc.bg_grad.stops[0].opa = LV_OPA_COVER;
+    dsc.bg_grad.stops[1].color = lv_palette_main(LV_PALETTE_BLUE);
+    dsc.bg_grad.stops[1].opa = LV_OPA_20;
+    lv_draw_triangle(layer, &dsc);
+}
+
+static lv_obj_t * create_canvas(lv_layer_t * layer)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_canvas_init_layer(canvas, layer);
+    return canvas;
+}
+
+static uint8_t get_px(int32_t x, int32_t y)
+{
+    const lv_color32_t * px = lv_draw_buf_goto_xy(canvas_buf, x, y);
+    return px->green;
+}
+
+void test_triangle_coverage(void)
+{
+    lv_layer_t layer;
+    lv_obj_t * canvas = create_canvas(&layer);
+
+    /*The points are the corners of the pixels*/
+    draw_triangle(&layer, 10, 10, 10, 110, 110, 110, LV_GRAD_DIR_NONE);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    /*The straight edges are sharp*/
+    TEST_ASSERT_EQUAL_UINT8(0xff, get_px(9, 50));
+    TEST_ASSERT_EQUAL_UINT8(0x00, get_px(10, 50));
+    TEST_ASSERT_EQUAL_UINT8(0x00, get_px(50, 109));
+    TEST_ASSERT_EQUAL_UINT8(0xff, get_px(50, 110));
+
+    /*The diagonal goes through the center of the pixels*/
+    TEST_ASSERT_EQUAL_UINT8(0x00, get_px(49, 50));
+    TEST_ASSERT_UINT8_WITHIN(2, 0x80, get_px(50, 50));
+    TEST_ASSERT_EQUAL_UINT8(0xff, get_px(51, 50));
+}
+
+void test_triangle_render(void)
+{
+    lv_layer_t layer;
+    lv_obj_t * canvas = create_canvas(&layer);
+
+    draw_triangle(&layer, 10, 10, 90, 30, 40, 90, LV_GRAD_DIR_NONE);
+    draw_triangle(&layer, 110, 90, 190, 10, 150, 60, LV_GRAD_DIR_HOR);
+    draw_triangle(&layer, 10, 110, 90, 190, 20, 180, LV_GRAD_DIR_VER);
+    /*Thin and partially out of the canvas*/
+    draw_triangle(&layer, 100, 120, 300, 130, 110, 125, LV_GRAD_DIR_NONE);
+    draw_triangle(&layer, 150, 150, 190, 190, -50, 250, LV_GRAD_DIR_HOR);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/triangle.png");
+}
+
+#endif
@@ -38,7 +38,7 @@ void test_render_to_l8(void)
             char buf[128];
             lv_snprintf(buf, sizeof(buf), "draw/render/l8/demo_render_%s_opa_%d.png",
                         lv_demo_render_get_scene_name(i), opa_values[opa]);
-            TEST_ASSERT_EQUAL_SCREENSHOT(buf);
+            TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE(buf, i == LV_DEMO_RENDER_SCENE_ARC_NORMAL ? LV_TEST_ARC_TOLERANCE : 0);
         }
     }
 #endif
@@ -0,0 +1,171 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define glyph_cache_p (LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache)
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_font_fmt_txt_glyph_cache_drop_all();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    lv_cache_set_max_size(glyph_cache_p, LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, NULL);
+#endif
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+
+static void create_labels(void)
+{
+    LV_FONT_DECLARE(test_font_montserrat_ascii_1bpp);
+    LV_FONT_DECLARE(test_font_montserrat_ascii_2bpp);
+    LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp);
+    LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp_compressed);
+    const lv_font_t * fonts[] = {
+        &test_font_montserrat_ascii_1bpp,
+        &test_font_montserrat_ascii_2bpp,
+        &test_font_montserrat_ascii_4bpp,
+        &test_font_montserrat_ascii_4bpp_compressed,
+        &lv_font_montserrat_14,
+    };
+
+    lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_obj_set_style_text_font(label, fonts[i], 0);
+        lv_label_set_text(label, "The quick brown fox jumps over the lazy dog.\n"
+                          "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG!\n"
+                          "0123456789 @#$%&*()[]{}<>/\\|?");
+    }
+}
+
+void test_font_fmt_txt_glyph_cache_render(void)
+{
+    /*Render without cache first to be sure the cache gives the same result*/
+    lv_cache_set_max_size(glyph_cache_p, 0, NULL);
+    create_labels();
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_fmt_txt_glyph_cache.png");
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(glyph_cache_p, NULL));
+
+    lv_cache_set_max_size(glyph_cache_p, LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, NULL);
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_fmt_txt_glyph_cache.png");
+    TEST_ASSERT_NOT_EQUAL(0, lv_cache_get_size(glyph_cache_p, NULL));
+
+    /*Render the glyphs from the cache*/
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_fmt_txt_glyph_cache.png");
+}
+
+static uint32_t log_error_cnt;
+
+static void count_log_errors_cb(lv_log_level_t level, const char * buf)
+{
+    LV_UNUSED(buf);
+    if(level == LV_LOG_LEVEL_ERROR) log_error_cnt++;
+}
+
+void test_font_fmt_txt_glyph_cache_small(void)
+{
+    log_error_cnt = 0;
+    lv_log_register_print_cb(count_log_errors_cb);
+
+    /*Glyphs not fitting into the cache are decoded directly*/
+    lv_cache_set_max_size(glyph_cache_p, 300, NULL);
+    create_labels();
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_fmt_txt_glyph_cache.png");
+    TEST_ASSERT_LESS_OR_EQUAL(300, lv_cache_get_size(glyph_cache_p, NULL));
+
+    lv_log_register_print_cb(NULL);
+
+    /*It's not an error, so it must not be logged for every glyph*/
+    TEST_ASSERT_EQUAL_UINT32(0, log_error_cnt);
+}
+
+void test_font_fmt_txt_glyph_cache_binfont_destroy(void)
+{
+    lv_font_t * font = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+    TEST_ASSERT_NOT_NULL(font);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "The quick brown fox jumped over the lazy dog");
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_EQUAL(0, lv_cache_get_size(glyph_cache_p, NULL));
+
+    /*The glyphs of the destroyed font can't stay in the cache*/
+    lv_obj_delete(label);
+    lv_binfont_destroy(font);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(glyph_cache_p, NULL));
+}
+
+#endif
+
+#if LV_FONT_FMT_TXT_GID_CACHE_SIZE > 0
+
+static uint32_t get_gid(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+    if(!lv_font_get_glyph_dsc(font, &g, letter, 0)) return 0;
+    return g.resolved_font == font ? g.gid.index : 0;
+}
+
+void test_font_fmt_txt_gid_cache_lookup(void)
+{
+    LV_FONT_DECLARE(test_font_1);
+    LV_FONT_DECLARE(test_font_2);
+
+    /*Letters of the sparse cmap, some not existing letters and 'A' from the first cmap*/
+    static const uint32_t letters[] = {0xB0, 0xB1, 0x2022, 0xF001, 0xF002, 0xF8A2, 0xC5, 0xC4, 0xD6, 'A'};
+    uint32_t gids_1[sizeof(letters) / sizeof(letters[0])];
+    uint32_t gids_2[sizeof(letters) / sizeof(letters[0])];
+
+    uint32_t i;
+    for(i = 0; i < sizeof(letters) / sizeof(letters[0]); i++) {
+        gids_1[i] = get_gid(&test_font_1, letters[i]);
+        gids_2[i] = get_gid(&test_font_2, letters[i]);
+    }
+
+    TEST_ASSERT_EQUAL(96, gids_1[0]);
+    TEST_ASSERT_EQUAL(97, gids_1[2]);
+    TEST_ASSERT_EQUAL(0, gids_1[1]);
+    TEST_ASSERT_EQUAL(0, gids_1[6]);
+    TEST_ASSERT_EQUAL(34, gids_1[9]);
+
+    /*Look them up again from the cache in a different order with the two fonts interleaved*/
+    uint32_t round;
+    for(round = 0; round < 3; round++) {
+        for(i = sizeof(letters) / sizeof(letters[0]); i > 0; i--) {
+            TEST_ASSERT_EQUAL(gids_2[i - 1], get_gid(&test_font_2, letters[i - 1]));
+            TEST_ASSERT_EQUAL(gids_1[i - 1], get_gid(&test_font_1, letters[i - 1]));
+        }
+    }
+}
+
+void test_font_fmt_txt_gid_cache_binfont_reload(void)
+{
+    /*The gids of a destroyed font mustn't be used for a new font at the same address*/
+    lv_font_t * font = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+    TEST_ASSERT_NOT_NULL(font);
+    TEST_ASSERT_EQUAL(97, get_gid(font, 0x2022));
+    lv_binfont_destroy(font);
+
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_GID_CACHE_SIZE; i++) {
+        TEST_ASSERT_NULL(LV_GLOBAL_DEFAULT()->font_fmt_txt_gid_cache[i].fdsc);
+    }
+}
+
+#endif
+
+#endif
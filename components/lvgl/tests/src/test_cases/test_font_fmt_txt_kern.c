@@ -0,0 +1,130 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define MAX_GLYPH_CNT   128
+
+static uint16_t pair_ids[MAX_GLYPH_CNT * MAX_GLYPH_CNT * 2];
+static int8_t pair_values[MAX_GLYPH_CNT * MAX_GLYPH_CNT];
+static lv_font_fmt_txt_kern_pair_t kern_pairs;
+static lv_font_fmt_txt_dsc_t pair_dsc;
+static lv_font_t pair_font;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_font_fmt_txt_kern_hash_delete((lv_font_fmt_txt_kern_hash_t *)kern_pairs.hash);
+    kern_pairs.hash = NULL;
+}
+
+/*Create a copy of a font with the kerning classes of its first cmap's glyphs converted to sorted pairs*/
+static const lv_font_t * create_pair_font(const lv_font_t * class_font, bool ids_16)
+{
+    const lv_font_fmt_txt_dsc_t * class_dsc = class_font->dsc;
+    const lv_font_fmt_txt_kern_classes_t * kern_classes = class_dsc->kern_dsc;
+    uint32_t glyph_cnt = class_dsc->cmaps[0].range_length + 1;
+    TEST_ASSERT_EQUAL(1, class_dsc->kern_classes);
+    TEST_ASSERT_LESS_OR_EQUAL(MAX_GLYPH_CNT, glyph_cnt);
+
+    uint8_t * pair_ids_8 = (uint8_t *)pair_ids;
+    uint32_t cnt = 0;
+    uint32_t left;
+    uint32_t right;
+    for(left = 1; left < glyph_cnt; left++) {
+        for(right = 1; right < glyph_cnt; right++) {
+            uint8_t left_class = kern_classes->left_class_mapping[left];
+            uint8_t right_class = kern_classes->right_class_mapping[right];
+            if(left_class == 0 || right_class == 0) continue;
+
+            int8_t value = kern_classes->class_pair_values[(left_class - 1) * kern_classes->right_class_cnt +
+                                                                             (right_class - 1)];
+            if(value == 0) continue;
+
+            if(ids_16) {
+                pair_ids[cnt * 2] = (uint16_t)left;
+                pair_ids[cnt * 2 + 1] = (uint16_t)right;
+            }
+            else {
+                pair_ids_8[cnt * 2] = (uint8_t)left;
+                pair_ids_8[cnt * 2 + 1] = (uint8_t)right;
+            }
+            pair_values[cnt] = value;
+            cnt++;
+        }
+    }
+
+    lv_memzero(&kern_pairs, sizeof(kern_pairs));
+    kern_pairs.glyph_ids = pair_ids;
+    kern_pairs.values = pair_values;
+    kern_pairs.pair_cnt = cnt;
+    kern_pairs.glyph_ids_size = ids_16 ? 1 : 0;
+
+    pair_dsc = *class_dsc;
+    pair_dsc.kern_dsc = &kern_pairs;
+    pair_dsc.kern_classes = 0;
+
+    pair_font = *class_font;
+    pair_font.dsc = &pair_dsc;
+
+    return &pair_font;
+}
+
+static void assert_same_kerning(const lv_font_t * class_font, const lv_font_t * font)
+{
+    uint32_t left;
+    uint32_t right;
+    for(left = 0x20; left < 0x7F; left++) {
+        for(right = 0x20; right < 0x7F; right++) {
+            TEST_ASSERT_EQUAL(lv_font_get_glyph_width(class_font, left, right),
+                              lv_font_get_glyph_width(font, left, right));
+        }
+    }
+}
+
+static void test_hash(const lv_font_t * class_font, bool ids_16)
+{
+    const lv_font_t * font = create_pair_font(class_font, ids_16);
+    TEST_ASSERT_NOT_EQUAL(0, kern_pairs.pair_cnt);
+
+    /*Binary search*/
+    assert_same_kerning(class_font, font);
+
+    kern_pairs.hash = lv_font_fmt_txt_kern_hash_create(&kern_pairs);
+    TEST_ASSERT_NOT_NULL(kern_pairs.hash);
+    TEST_ASSERT_GREATER_THAN(kern_pairs.pair_cnt, kern_pairs.hash->mask);
+    assert_same_kerning(class_font, font);
+}
+
+void test_font_fmt_txt_kern_hash_8bit_ids(void)
+{
+    test_hash(&lv_font_montserrat_14, false);
+}
+
+void test_font_fmt_txt_kern_hash_16bit_ids(void)
+{
+    test_hash(&lv_font_montserrat_48, true);
+}
+
+void test_font_fmt_txt_kern_hash_no_pairs(void)
+{
+    create_pair_font(&lv_font_montserrat_14, false);
+    kern_pairs.pair_cnt = 0;
+    kern_pairs.hash = lv_font_fmt_txt_kern_hash_create(&kern_pairs);
+    TEST_ASSERT_NOT_NULL(kern_pairs.hash);
+
+    /*No kerning at all*/
+    lv_font_glyph_dsc_t g_av;
+    lv_font_glyph_dsc_t g_a;
+    lv_font_get_glyph_dsc(&pair_font, &g_av, 'A', 'V');
+    lv_font_get_glyph_dsc(&pair_font, &g_a, 'A', 0);
+    TEST_ASSERT_EQUAL(g_a.adv_w, g_av.adv_w);
+}
+
+#endif
@@ -25,9 +25,12 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static void compare_glyphs(const lv_font_t * f1, const lv_font_t * f2);
 void test_font_loader_with_cache(void);
 void test_font_loader_no_cache(void);
 void test_font_loader_from_buffer(void);
+void test_font_loader_from_mapped(void);
+void test_font_loader_streamed(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -66,12 +69,8 @@ void tearDown(void)
 
 }
 
-static void common(void)
+static void check_rendering(void)
 {
-    compare_fonts(&test_font_1, font_1_bin);
-    compare_fonts(&test_font_2, font_2_bin);
-    compare_fonts(&test_font_3, font_3_bin);
-
     /* create labels for testing */
     lv_obj_t * scr = lv_screen_active();
     lv_obj_t * label1 = lv_label_create(scr);
@@ -97,6 +96,24 @@ static void common(void)
     lv_binfont_destroy(font_3_bin);
 }
 
+static void common(void)
+{
+    compare_fonts(&test_font_1, font_1_bin);
+    compare_fonts(&test_font_2, font_2_bin);
+    compare_fonts(&test_font_3, font_3_bin);
+
+    check_rendering();
+}
+
+/* simulate a memory mapped font file with an aligned copy of the font binary */
+static void * map_font(const uint8_t * buf, uint32_t size)
+{
+    void * mapped = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(mapped);
+    lv_memcpy(mapped, buf, size);
+    return mapped;
+}
+
 void test_font_loader_with_cache(void)
 {
     /*Test with cache ('A' has cache)*/
@@ -145,6 +162,87 @@ void test_font_loader_from_buffer(void)
     common();
 }
 
+void test_font_loader_from_mapped(void)
+{
+    void * mapped_1 = map_font(test_font_1_buf, sizeof(test_font_1_buf));
+    void * mapped_2 = map_font(test_font_2_buf, sizeof(test_font_2_buf));
+    void * mapped_3 = map_font(test_font_3_buf, sizeof(test_font_3_buf));
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    size_t free_before = mon.free_size;
+#endif
+
+    font_1_bin = lv_binfont_create_from_mapped(mapped_1, sizeof(test_font_1_buf));
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    /*Only the font, its descriptor and the cmaps are allocated*/
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_LESS_THAN(512, free_before - mon.free_size);
+#endif
+
+    font_2_bin = lv_binfont_create_from_mapped(mapped_2, sizeof(test_font_2_buf));
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+
+    font_3_bin = lv_binfont_create_from_mapped(mapped_3, sizeof(test_font_3_buf));
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    /*The glyphs are not loaded so compare them through the font API*/
+    compare_glyphs(&test_font_1, font_1_bin);
+    compare_glyphs(&test_font_2, font_2_bin);
+    compare_glyphs(&test_font_3, font_3_bin);
+
+    check_rendering();
+
+    lv_free(mapped_1);
+    lv_free(mapped_2);
+    lv_free(mapped_3);
+}
+
+void test_font_loader_from_mapped_invalid(void)
+{
+    uint8_t * mapped = map_font(test_font_1_buf, sizeof(test_font_1_buf));
+
+    /*Truncated*/
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(mapped, 100));
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(mapped, sizeof(test_font_1_buf) - 1));
+
+    /*Unaligned*/
+    lv_memmove(mapped + 1, mapped, sizeof(test_font_1_buf) - 1);
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(mapped + 1, sizeof(test_font_1_buf) - 1));
+
+    lv_free(mapped);
+}
+
+void test_font_loader_streamed(void)
+{
+    /*Small pages to read the glyphs from several pages and replace the pages often*/
+    font_1_bin = lv_binfont_create_streamed("A:src/test_assets/test_font_1.fnt", 64, 4);
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+    font_2_bin = lv_binfont_create_streamed("A:src/test_assets/test_font_2.fnt", 64, 4);
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+
+    font_3_bin = lv_binfont_create_streamed("B:src/test_assets/test_font_3.fnt", 512, 2);
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    compare_glyphs(&test_font_1, font_1_bin);
+    compare_glyphs(&test_font_2, font_2_bin);
+    compare_glyphs(&test_font_3, font_3_bin);
+
+    check_rendering();
+
+    /*Only one page*/
+    lv_font_t * font = lv_binfont_create_streamed("A:src/test_assets/test_font_1.fnt", 16, 1);
+    TEST_ASSERT_NOT_NULL(font);
+    compare_glyphs(&test_font_1, font);
+    lv_binfont_destroy(font);
+
+    TEST_ASSERT_NULL(lv_binfont_create_streamed("A:src/test_assets/not_existing.fnt", 64, 4));
+}
+
 void test_font_loader_reload(void)
 {
     /*Reload a font which is being used by a label*/
@@ -322,4 +420,53 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
  *   STATIC FUNCTIONS
  **********************/
 
+static void compare_glyph_bitmaps(lv_font_glyph_dsc_t * g1, lv_font_glyph_dsc_t * g2)
+{
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(g1->box_w, g1->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(g2->box_w, g2->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    const lv_draw_buf_t * bmp1 = lv_font_get_glyph_bitmap(g1, buf1);
+    const lv_draw_buf_t * bmp2 = lv_font_get_glyph_bitmap(g2, buf2);
+    TEST_ASSERT_NOT_NULL(bmp1);
+    TEST_ASSERT_NOT_NULL(bmp2);
+
+    for(int32_t y = 0; y < g1->box_h; y++) {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(bmp1->data + y * bmp1->header.stride,
+                                              bmp2->data + y * bmp2->header.stride, g1->box_w, "glyph_bitmap");
+    }
+
+    lv_font_glyph_release_draw_data(g1);
+    lv_font_glyph_release_draw_data(g2);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
+static void compare_glyphs(const lv_font_t * f1, const lv_font_t * f2)
+{
+    TEST_ASSERT_EQUAL_INT_MESSAGE(f1->line_height, f2->line_height, "line_height");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(f1->base_line, f2->base_line, "base_line");
+
+    const lv_font_fmt_txt_dsc_t * dsc1 = f1->dsc;
+    for(int i = 0; i < dsc1->cmap_num; ++i) {
+        uint32_t letter;
+        for(letter = dsc1->cmaps[i].range_start;
+            letter < dsc1->cmaps[i].range_start + dsc1->cmaps[i].range_length; letter++) {
+            lv_font_glyph_dsc_t g1;
+            lv_font_glyph_dsc_t g2;
+            /*'A' is the next letter to check the kerning too*/
+            bool found1 = lv_font_get_glyph_dsc(f1, &g1, letter, 'A');
+            bool found2 = lv_font_get_glyph_dsc(f2, &g2, letter, 'A');
+            TEST_ASSERT_EQUAL_MESSAGE(found1, found2, "found");
+            if(!found1) continue;
+
+            TEST_ASSERT_EQUAL_INT_MESSAGE(g1.adv_w, g2.adv_w, "adv_w");
+            TEST_ASSERT_EQUAL_INT_MESSAGE(g1.box_w, g2.box_w, "box_w");
+            TEST_ASSERT_EQUAL_INT_MESSAGE(g1.box_h, g2.box_h, "box_h");
+            TEST_ASSERT_EQUAL_INT_MESSAGE(g1.ofs_x, g2.ofs_x, "ofs_x");
+            TEST_ASSERT_EQUAL_INT_MESSAGE(g1.ofs_y, g2.ofs_y, "ofs_y");
+
+            if(g1.box_w * g1.box_h > 0) compare_glyph_bitmaps(&g1, &g2);
+        }
+    }
+}
+
 #endif // LV_BUILD_TEST
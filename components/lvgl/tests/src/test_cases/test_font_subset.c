@@ -0,0 +1,147 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*The characters of the string literals of this file are in the subset (see tests/CMakeLists.txt)*/
+static const char * text =
+    "Testar teatar!\nESP32->ili9341\n"
+    "Press me, temperature: 21.5 \xC2\xB0" "C " LV_SYMBOL_OK;
+
+LV_FONT_DECLARE(test_font_montserrat_14_subset)
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void compare_glyph_bitmaps(lv_font_glyph_dsc_t * g1, lv_font_glyph_dsc_t * g2)
+{
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(g1->box_w, g1->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(g2->box_w, g2->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    const lv_draw_buf_t * bmp1 = lv_font_get_glyph_bitmap(g1, buf1);
+    const lv_draw_buf_t * bmp2 = lv_font_get_glyph_bitmap(g2, buf2);
+    TEST_ASSERT_NOT_NULL(bmp1);
+    TEST_ASSERT_NOT_NULL(bmp2);
+
+    int32_t y;
+    for(y = 0; y < g1->box_h; y++) {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(bmp1->data + y * bmp1->header.stride, bmp2->data + y * bmp2->header.stride,
+                                      g1->box_w);
+    }
+
+    lv_font_glyph_release_draw_data(g1);
+    lv_font_glyph_release_draw_data(g2);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
+void test_font_subset_glyphs(void)
+{
+    const lv_font_t * full = &lv_font_montserrat_14;
+    const lv_font_t * subset = &test_font_montserrat_14_subset;
+    TEST_ASSERT_EQUAL(full->line_height, subset->line_height);
+    TEST_ASSERT_EQUAL(full->base_line, subset->base_line);
+
+    uint32_t i = 0;
+    while(text[i] != '\0') {
+        uint32_t letter = lv_text_encoded_next(text, &i);
+        uint32_t j = 0;
+        while(text[j] != '\0') {
+            /*Every pair to check the kerning too*/
+            uint32_t letter_next = lv_text_encoded_next(text, &j);
+            if(letter == '\n' || letter_next == '\n') continue;
+
+            lv_font_glyph_dsc_t g1;
+            lv_font_glyph_dsc_t g2;
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(full, &g1, letter, letter_next));
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(subset, &g2, letter, letter_next));
+            TEST_ASSERT_EQUAL(g1.adv_w, g2.adv_w);
+            TEST_ASSERT_EQUAL(g1.box_w, g2.box_w);
+            TEST_ASSERT_EQUAL(g1.box_h, g2.box_h);
+            TEST_ASSERT_EQUAL(g1.ofs_x, g2.ofs_x);
+            TEST_ASSERT_EQUAL(g1.ofs_y, g2.ofs_y);
+            /*Compare the bitmap only with the first next letter*/
+            if(j == 1 && g1.box_w * g1.box_h > 0) compare_glyph_bitmaps(&g1, &g2);
+        }
+    }
+}
+
+void test_font_subset_missing(void)
+{
+    /*Not used in any string literal of this file*/
+    static const uint32_t letters[] = {'Q', 'Z', 'q', '~', 0x2022, 0xF001};
+    uint32_t i;
+    for(i = 0; i < sizeof(letters) / sizeof(letters[0]); i++) {
+        lv_font_glyph_dsc_t g;
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_14, &g, letters[i], 0));
+        TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&test_font_montserrat_14_subset, &g, letters[i], 0));
+    }
+}
+
+void test_font_subset_dense_cmaps(void)
+{
+    const lv_font_fmt_txt_dsc_t * dsc = test_font_montserrat_14_subset.dsc;
+    uint32_t sparse_cnt = 0;
+    uint32_t gid = 1;
+    uint32_t i;
+    for(i = 0; i < dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &dsc->cmaps[i];
+        TEST_ASSERT_EQUAL(gid, cmap->glyph_id_start);
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            sparse_cnt++;
+            gid += cmap->list_length;
+        }
+        else {
+            /*Only the longer runs of characters are stored as ranges*/
+            TEST_ASSERT_EQUAL(LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY, cmap->type);
+            TEST_ASSERT_GREATER_OR_EQUAL(3, cmap->range_length);
+            gid += cmap->range_length;
+        }
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(1, sparse_cnt);
+}
+
+static void draw_text(lv_obj_t * canvas, const lv_font_t * font)
+{
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = text;
+    dsc.font = font;
+    lv_area_t coords = {4, 4, 235, 95};
+    lv_draw_label(&layer, &dsc, &coords);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_font_subset_render(void)
+{
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(240, 100, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+    uint8_t * ref = lv_malloc(buf_size);
+    TEST_ASSERT_NOT_NULL(ref);
+
+    draw_text(canvas, &lv_font_montserrat_14);
+    lv_memcpy(ref, draw_buf->data, buf_size);
+    draw_text(canvas, &test_font_montserrat_14_subset);
+    TEST_ASSERT_EQUAL_MEMORY(ref, draw_buf->data, buf_size);
+
+    lv_free(ref);
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(draw_buf);
+}
+
+#endif
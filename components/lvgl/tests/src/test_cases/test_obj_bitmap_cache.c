@@ -0,0 +1,144 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_OBJ_BITMAP_CACHE_SIZE > 0
+
+static lv_obj_t * label;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_obj_bitmap_cache_resize(LV_OBJ_BITMAP_CACHE_SIZE, true);
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+}
+
+static lv_obj_t * create_panel(lv_obj_t * parent, int32_t x)
+{
+    lv_obj_t * panel = lv_obj_create(parent);
+    lv_obj_set_size(panel, 300, 200);
+    lv_obj_set_pos(panel, x, 50);
+    lv_obj_set_style_shadow_width(panel, 20, 0);
+    lv_obj_set_style_bg_grad_color(panel, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(panel, LV_GRAD_DIR_VER, 0);
+
+    label = lv_label_create(panel);
+    lv_label_set_text(label, "Cached label");
+
+    lv_obj_t * btn = lv_button_create(panel);
+    lv_obj_align(btn, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_label_set_text(lv_label_create(btn), "Button");
+
+    return panel;
+}
+
+void test_obj_bitmap_cache_render(void)
+{
+    lv_obj_t * panel = create_panel(lv_screen_active(), 50);
+    lv_obj_t * panel_cached = create_panel(lv_screen_active(), 400);
+    lv_obj_add_flag(panel_cached, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    lv_obj_set_style_radius(panel, 30, 0);
+    lv_obj_set_style_radius(panel_cached, 30, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("obj_bitmap_cache_1.png");
+    TEST_ASSERT_NOT_EQUAL(0, lv_obj_bitmap_cache_get_size());
+
+    /*Drawing again from the bitmap should give the same result*/
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("obj_bitmap_cache_1.png");
+}
+
+void test_obj_bitmap_cache_invalidate_child(void)
+{
+    lv_obj_t * panel = create_panel(lv_screen_active(), 400);
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    lv_refr_now(NULL);
+
+    uint32_t size = lv_obj_bitmap_cache_get_size();
+    TEST_ASSERT_NOT_EQUAL(0, size);
+
+    /*Changing a child drops the bitmap of the parent*/
+    lv_label_set_text(label, "Changed label");
+    TEST_ASSERT_EQUAL(0, lv_obj_bitmap_cache_get_size());
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(size, lv_obj_bitmap_cache_get_size());
+
+    create_panel(lv_screen_active(), 50);
+    lv_label_set_text(label, "Changed label");
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("obj_bitmap_cache_2.png");
+}
+
+void test_obj_bitmap_cache_release(void)
+{
+    lv_obj_t * panel1 = create_panel(lv_screen_active(), 50);
+    lv_obj_t * panel2 = create_panel(lv_screen_active(), 400);
+    lv_obj_add_flag(panel1, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    lv_obj_add_flag(panel2, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    lv_refr_now(NULL);
+
+    uint32_t size = lv_obj_bitmap_cache_get_size();
+    TEST_ASSERT_NOT_EQUAL(0, size);
+
+    lv_obj_remove_flag(panel1, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    TEST_ASSERT_EQUAL(size / 2, lv_obj_bitmap_cache_get_size());
+
+    lv_obj_delete(panel2);
+    TEST_ASSERT_EQUAL(0, lv_obj_bitmap_cache_get_size());
+}
+
+void test_obj_bitmap_cache_budget(void)
+{
+    lv_obj_t * panel1 = create_panel(lv_screen_active(), 50);
+    lv_obj_t * panel2 = create_panel(lv_screen_active(), 400);
+    lv_obj_add_flag(panel1, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    lv_obj_add_flag(panel2, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    lv_refr_now(NULL);
+
+    uint32_t size = lv_obj_bitmap_cache_get_size();
+
+    /*Only one bitmap fits, the other widget should be drawn normally*/
+    lv_obj_bitmap_cache_resize(size / 2, true);
+    lv_obj_bitmap_cache_drop(NULL);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(size / 2, lv_obj_bitmap_cache_get_size());
+
+    /*Too small for any bitmap*/
+    lv_obj_bitmap_cache_resize(100, true);
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("obj_bitmap_cache_3.png");
+    TEST_ASSERT_EQUAL(0, lv_obj_bitmap_cache_get_size());
+}
+
+void test_obj_bitmap_cache_rgb565a8(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565);
+
+    /*The shadow doesn't cover the bitmap so it needs alpha channel*/
+    lv_obj_t * panel = create_panel(lv_screen_active(), 50);
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_CACHE_AS_BITMAP);
+    lv_refr_now(NULL);
+
+    lv_area_t area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(panel);
+    lv_obj_get_coords(panel, &area);
+    lv_area_increase(&area, ext_draw_size, ext_draw_size);
+
+    /*2 bytes RGB565 and 1 byte alpha per pixel*/
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(&area), LV_COLOR_FORMAT_RGB565);
+    TEST_ASSERT_EQUAL(stride * lv_area_get_height(&area) * 3 / 2, lv_obj_bitmap_cache_get_size());
+}
+
+#endif
+
+#endif
@@ -50,7 +50,7 @@ void test_arc_basic_render(void)
     lv_obj_center(arc);
     lv_arc_set_value(arc, 70);
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/arc_1.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE("widgets/arc_1.png", LV_TEST_ARC_TOLERANCE);
 }
 
 void test_arc_rgb565a8_image(void)
@@ -294,7 +294,7 @@ void test_two_overlapping_arcs_can_be_interacted_independently(void)
     TEST_ASSERT_EQUAL_UINT32(1, event_cnt2);
 
     // Verify that the screen remains as expected after the interactions
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/overlapping_arcs_test.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE("widgets/overlapping_arcs_test.png", LV_TEST_ARC_TOLERANCE);
 }
 
 
@@ -0,0 +1,167 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static const char * text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n"
+    "Cras malesuada ultrices magna in rutrum. Suspendisse potenti.\n\n"
+    "Aenean tincidunt, lorem eget efficitur porta, mi nisl dapibus leo, sed gravida enim erat quis metus.\n";
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_LABEL_LINE_CACHE
+
+/*Static texts are not cached so they can be used as reference*/
+static lv_obj_t * create_label(const char * txt, bool cached, lv_text_align_t align)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    if(cached) lv_label_set_text(label, txt);
+    else lv_label_set_text_static(label, txt);
+    lv_obj_set_width(label, 180);
+    lv_obj_set_style_text_align(label, align, 0);
+    return label;
+}
+
+static void assert_same_hit_test(lv_obj_t * cached, lv_obj_t * ref)
+{
+    lv_obj_update_layout(lv_screen_active());
+
+    uint32_t len = lv_text_get_encoded_length(lv_label_get_text(ref));
+    uint32_t i;
+    for(i = 0; i <= len; i++) {
+        lv_point_t p_cached;
+        lv_point_t p_ref;
+        lv_label_get_letter_pos(cached, i, &p_cached);
+        lv_label_get_letter_pos(ref, i, &p_ref);
+        TEST_ASSERT_EQUAL(p_ref.x, p_cached.x);
+        TEST_ASSERT_EQUAL(p_ref.y, p_cached.y);
+    }
+
+    int32_t h = lv_obj_get_height(ref);
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y += 5) {
+        for(x = 0; x < 180; x += 3) {
+            lv_point_t p = {x, y};
+            TEST_ASSERT_EQUAL(lv_label_get_letter_on(ref, &p, false), lv_label_get_letter_on(cached, &p, false));
+            TEST_ASSERT_EQUAL(lv_label_is_char_under_pos(ref, &p), lv_label_is_char_under_pos(cached, &p));
+        }
+    }
+}
+
+void test_label_line_cache_hit_test(void)
+{
+    const lv_text_align_t aligns[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+    uint32_t i;
+    for(i = 0; i < sizeof(aligns) / sizeof(aligns[0]); i++) {
+        lv_obj_t * cached = create_label(text, true, aligns[i]);
+        lv_obj_t * ref = create_label(text, false, aligns[i]);
+        assert_same_hit_test(cached, ref);
+
+        /*The lines need to be recalculated with the new parameters*/
+        lv_obj_set_width(cached, 120);
+        lv_obj_set_width(ref, 120);
+        lv_obj_set_style_text_letter_space(cached, 2, 0);
+        lv_obj_set_style_text_letter_space(ref, 2, 0);
+        assert_same_hit_test(cached, ref);
+
+        lv_obj_clean(lv_screen_active());
+    }
+}
+
+void test_label_line_cache_size(void)
+{
+    lv_obj_t * cached = create_label(text, true, LV_TEXT_ALIGN_LEFT);
+    lv_obj_t * ref = create_label(text, false, LV_TEXT_ALIGN_LEFT);
+    lv_obj_set_style_text_line_space(cached, 3, 0);
+    lv_obj_set_style_text_line_space(ref, 3, 0);
+    lv_obj_set_height(cached, LV_SIZE_CONTENT);
+    lv_obj_set_height(ref, LV_SIZE_CONTENT);
+    lv_obj_update_layout(lv_screen_active());
+    TEST_ASSERT_EQUAL(lv_obj_get_height(ref), lv_obj_get_height(cached));
+
+    /*Empty text and text ending with a new line*/
+    lv_label_set_text(cached, "");
+    lv_label_set_text_static(ref, "");
+    lv_obj_update_layout(lv_screen_active());
+    TEST_ASSERT_EQUAL(lv_obj_get_height(ref), lv_obj_get_height(cached));
+
+    lv_label_set_text(cached, "a\n");
+    lv_label_set_text_static(ref, "a\n");
+    lv_obj_update_layout(lv_screen_active());
+    TEST_ASSERT_EQUAL(lv_obj_get_height(ref), lv_obj_get_height(cached));
+
+    /*Measure a text with the stored lines*/
+    lv_draw_label_lines_t lines;
+    lv_memzero(&lines, sizeof(lines));
+    TEST_ASSERT_TRUE(lv_draw_label_lines_update(&lines, text, &lv_font_montserrat_14, 0, 180, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_TRUE(lv_draw_label_lines_is_valid(&lines, &lv_font_montserrat_14, 0, 180, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_FALSE(lv_draw_label_lines_is_valid(&lines, &lv_font_montserrat_14, 0, 181, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_FALSE(lv_draw_label_lines_is_valid(&lines, &lv_font_montserrat_16, 0, 180, LV_TEXT_FLAG_NONE));
+
+    lv_point_t size_lines;
+    lv_point_t size_ref;
+    lv_draw_label_lines_get_size(&lines, text, 2, &size_lines);
+    lv_text_get_size(&size_ref, text, &lv_font_montserrat_14, 0, 2, 180, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(size_ref.x, size_lines.x);
+    TEST_ASSERT_EQUAL(size_ref.y, size_lines.y);
+
+    lv_draw_label_lines_invalidate(&lines);
+    TEST_ASSERT_FALSE(lv_draw_label_lines_is_valid(&lines, &lv_font_montserrat_14, 0, 180, LV_TEXT_FLAG_NONE));
+    lv_draw_label_lines_free(&lines);
+}
+
+void test_label_line_cache_render(void)
+{
+    const lv_text_align_t aligns[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+    lv_obj_t * labels[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        labels[i] = create_label(text, true, aligns[i]);
+        lv_obj_set_pos(labels[i], 20 + i * 200, 20);
+    }
+
+    /*A long scrolled label where the first visible line is found from the stored lines*/
+    static char long_text[1024];
+    lv_snprintf(long_text, sizeof(long_text), "%s%s%s%s", text, text, text, text);
+    lv_obj_t * long_label = create_label(long_text, true, LV_TEXT_ALIGN_LEFT);
+    lv_obj_set_height(long_label, 150);
+    lv_obj_set_pos(long_label, 620, 20);
+    lv_obj_scroll_to_y(long_label, 240, LV_ANIM_OFF);
+
+    lv_obj_t * dot_label = create_label(text, true, LV_TEXT_ALIGN_LEFT);
+    lv_label_set_long_mode(dot_label, LV_LABEL_LONG_DOT);
+    lv_obj_set_height(dot_label, 60);
+    lv_obj_set_pos(dot_label, 20, 300);
+
+    lv_obj_t * scroll_label = create_label(text, true, LV_TEXT_ALIGN_CENTER);
+    lv_label_set_long_mode(scroll_label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+    lv_obj_set_pos(scroll_label, 220, 300);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_line_cache.png");
+
+    /*The same without the stored lines*/
+    for(i = 0; i < 3; i++) lv_label_set_text_static(labels[i], text);
+    lv_label_set_text_static(long_label, long_text);
+    /*The dots are written into the text so it can't be a string literal*/
+    static char dot_text[512];
+    lv_strcpy(dot_text, text);
+    lv_label_set_text_static(dot_label, dot_text);
+    lv_label_set_text_static(scroll_label, text);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_line_cache.png");
+}
+
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static const char * text = "The quick brown fox jumps over the lazy dog. AVATAR WAVY Towel, 21.5 \xC2\xB0" "C";
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+}
+
+#if LV_LABEL_SCROLL_BITMAP_SIZE
+
+static lv_obj_t * create_label(lv_label_long_mode_t long_mode, int32_t y)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_long_mode(label, long_mode);
+    lv_obj_set_width(label, 220);
+    lv_obj_set_pos(label, 10, y);
+    lv_obj_set_style_text_color(label, lv_color_hex(0x203080), 0);
+    return label;
+}
+
+/*Static texts are always drawn glyph by glyph so they can be used as reference*/
+static void assert_same_as_glyphs(lv_obj_t * label, bool static_ref)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    if(static_ref) lv_label_set_text_static(label, text);
+    else lv_label_set_text(label, text);
+
+    /*The bitmap is created only for scrolling labels, then the offset is set manually*/
+    lv_refr_now(NULL);
+    lv_anim_delete(label, NULL);
+
+    /*Check some offsets including the circular wrap around*/
+    static const int32_t offsets[] = {0, -1, -37, -250, -420};
+    lv_draw_buf_t * draw_buf = lv_display_get_buf_active(NULL);
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+    static uint8_t * ref[5];
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        l->offset.x = offsets[i];
+        lv_obj_invalidate(label);
+        lv_refr_now(NULL);
+        if(static_ref) {
+            TEST_ASSERT_NULL(l->scroll_bitmap);
+            ref[i] = lv_malloc(buf_size);
+            TEST_ASSERT_NOT_NULL(ref[i]);
+            lv_memcpy(ref[i], draw_buf->data, buf_size);
+        }
+        else {
+            TEST_ASSERT_NOT_NULL(l->scroll_bitmap);
+            TEST_ASSERT_EQUAL_MEMORY(ref[i], draw_buf->data, buf_size);
+            lv_free(ref[i]);
+        }
+    }
+}
+
+void test_label_scroll_bitmap_same_as_glyphs(void)
+{
+    lv_obj_t * circular = create_label(LV_LABEL_LONG_SCROLL_CIRCULAR, 10);
+    assert_same_as_glyphs(circular, true);
+    assert_same_as_glyphs(circular, false);
+
+    lv_obj_t * scroll = create_label(LV_LABEL_LONG_SCROLL, 50);
+    lv_obj_set_style_text_font(scroll, &lv_font_montserrat_28, 0);
+    lv_obj_set_style_text_decor(scroll, LV_TEXT_DECOR_UNDERLINE, 0);
+    assert_same_as_glyphs(scroll, true);
+    assert_same_as_glyphs(scroll, false);
+
+    /*Where the glyphs and the underline overlap they are not blended twice with the bitmap,
+     *so test the opacity without decoration*/
+    lv_obj_t * opa = create_label(LV_LABEL_LONG_SCROLL_CIRCULAR, 100);
+    lv_obj_set_style_text_letter_space(opa, 2, 0);
+    lv_obj_set_style_text_opa(opa, LV_OPA_70, 0);
+    assert_same_as_glyphs(opa, true);
+    assert_same_as_glyphs(opa, false);
+}
+
+void test_label_scroll_bitmap_invalidate(void)
+{
+    lv_obj_t * label = create_label(LV_LABEL_LONG_SCROLL_CIRCULAR, 10);
+    lv_label_t * l = (lv_label_t *)label;
+    lv_label_set_text(label, text);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(l->scroll_bitmap);
+
+    /*The text is drawn again only if it's changed*/
+    const lv_draw_buf_t * bitmap = l->scroll_bitmap;
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_PTR(bitmap, l->scroll_bitmap);
+
+    lv_label_set_text(label, "An other text which is longer than the label");
+    TEST_ASSERT_NULL(l->scroll_bitmap);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(l->scroll_bitmap);
+
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_20, 0);
+    TEST_ASSERT_NULL(l->scroll_bitmap);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(l->scroll_bitmap);
+
+    /*Short texts don't scroll*/
+    lv_label_set_text(label, "Short");
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(l->scroll_bitmap);
+
+    /*Other long modes*/
+    lv_label_set_text(label, text);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(l->scroll_bitmap);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t flushed_px;
+
+static void flush_start_event_cb(lv_event_t * e)
+{
+    const lv_area_t * area = lv_event_get_param(e);
+    flushed_px += lv_area_get_size(area);
+}
+
+void setUp(void)
+{
+    lv_display_add_event_cb(lv_display_get_default(), flush_start_event_cb, LV_EVENT_FLUSH_START, NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), flush_start_event_cb, NULL);
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_LABEL_LINE_CACHE
+
+static lv_obj_t * create_label(const lv_font_t * font, lv_text_align_t align, int32_t w)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_align(label, align, 0);
+    lv_obj_set_width(label, w);
+    return label;
+}
+
+/*Refresh only the invalidated areas, then everything, and the result should be the same*/
+static void assert_same_as_full_refresh(void)
+{
+    lv_draw_buf_t * draw_buf = lv_display_get_buf_active(NULL);
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+    uint8_t * partial = lv_malloc(buf_size);
+    TEST_ASSERT_NOT_NULL(partial);
+
+    lv_refr_now(NULL);
+    lv_memcpy(partial, draw_buf->data, buf_size);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(draw_buf->data, partial, buf_size);
+
+    lv_free(partial);
+}
+
+void test_label_text_change_same_as_full_refresh(void)
+{
+    static const char * texts[] = {
+        "Uptime 12:00:05\nTemp. 21.5 \xC2\xB0" "C AVATAR Yoyo",
+        "Uptime 12:00:06\nTemp. 21.7 \xC2\xB0" "C AVATAX Yoyo",
+        "Uptime 12:00:17\nTemp. 9.75 \xC2\xB0" "C WAVY Towel",
+        "Uptime 12:01:11\nTemp. 9.75 \xC2\xB0" "C WAVY Towel, and a longer text to wrap",
+        "Uptime 12:01:11\nTemp. -9.7 \xC2\xB0" "C WAVY Towel, and a longer text to wrap",
+    };
+    const lv_text_align_t aligns[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+
+    lv_obj_t * labels[6];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        labels[i] = create_label(&lv_font_montserrat_14, aligns[i], 240);
+        lv_obj_set_pos(labels[i], 10, 10 + i * 60);
+        labels[i + 3] = create_label(&lv_font_montserrat_28, aligns[i], 360);
+        lv_obj_set_pos(labels[i + 3], 300, 10 + i * 130);
+    }
+    lv_obj_set_style_text_letter_space(labels[1], 3, 0);
+    lv_obj_set_style_text_line_space(labels[4], -4, 0);
+    lv_label_set_long_mode(labels[5], LV_LABEL_LONG_CLIP);
+    lv_obj_set_height(labels[5], 60);
+    lv_refr_now(NULL);
+
+    uint32_t k;
+    for(k = 0; k < 12; k++) {
+        for(i = 0; i < 6; i++) {
+            lv_label_set_text(labels[i], texts[(k + i) % 5]);
+        }
+        assert_same_as_full_refresh();
+
+        for(i = 0; i < 6; i++) {
+            lv_label_set_text_fmt(labels[i], "%s", texts[(k * 3 + i) % 5]);
+        }
+        assert_same_as_full_refresh();
+    }
+}
+
+void test_label_text_change_invalidates_changed_letters(void)
+{
+    lv_obj_t * label = create_label(&lv_font_montserrat_14, LV_TEXT_ALIGN_LEFT, 240);
+    lv_label_set_text(label, "Uptime 12:00:05");
+    lv_refr_now(NULL);
+
+    /*Only the last digit*/
+    flushed_px = 0;
+    lv_label_set_text(label, "Uptime 12:00:06");
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, flushed_px);
+    TEST_ASSERT_LESS_OR_EQUAL(12 * lv_font_get_line_height(&lv_font_montserrat_14), flushed_px);
+
+    /*The same text*/
+    flushed_px = 0;
+    lv_label_set_text(label, "Uptime 12:00:06");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, flushed_px);
+
+    /*Different number of lines*/
+    flushed_px = 0;
+    lv_label_set_text(label, "Uptime\n12:00:07");
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_OR_EQUAL(lv_obj_get_width(label) * lv_obj_get_height(label), flushed_px);
+}
+
+#endif
+
+#endif
@@ -140,7 +140,7 @@ void test_scale_render_example_3(void)
     lv_obj_set_style_length(scale, 10, LV_PART_INDICATOR);
     lv_scale_set_range(scale, 10, 40);
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/scale_3.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE("widgets/scale_3.png", LV_TEST_ARC_TOLERANCE);
 }
 
 /* A round scale with section and custom styling */
@@ -219,7 +219,7 @@ void test_scale_render_example_4(void)
     lv_scale_section_set_style(section, LV_PART_ITEMS, &section_minor_tick_style);
     lv_scale_section_set_style(section, LV_PART_MAIN, &section_main_line_style);
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/scale_4.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE("widgets/scale_4.png", LV_TEST_ARC_TOLERANCE);
 }
 
 static void draw_event_cb(lv_event_t * e)
@@ -28,7 +28,7 @@ void test_spinner_spinning(void)
 
         char filename[32];
         lv_snprintf(filename, sizeof(filename), "widgets/spinner_%02d.png", i);
-        TEST_ASSERT_EQUAL_SCREENSHOT(filename);
+        TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE(filename, LV_TEST_ARC_TOLERANCE);
     }
 }
 
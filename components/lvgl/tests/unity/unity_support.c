@@ -82,13 +82,18 @@ static void create_folders_if_needed(const char * path) ;
  **********************/
 
 bool lv_test_assert_image_eq(const char * fn_ref)
+{
+    return lv_test_assert_image_eq_tolerance(fn_ref, REF_IMG_TOLERANCE);
+}
+
+bool lv_test_assert_image_eq_tolerance(const char * fn_ref, uint8_t tolerance)
 {
     bool pass;
 
     lv_obj_t * scr = lv_screen_active();
     lv_obj_invalidate(scr);
 
-    pass = screenshot_compare(fn_ref, "full refresh", REF_IMG_TOLERANCE);
+    pass = screenshot_compare(fn_ref, "full refresh", LV_MAX(tolerance, REF_IMG_TOLERANCE));
     if(!pass) return false;
 
     //Software has minor rounding errors when not the whole image is updated
@@ -12,10 +12,14 @@ extern "C" {
 
 bool lv_test_assert_image_eq(const char * fn_ref);
 
+/* Allow the color channels to differ by `tolerance` (at least REF_IMG_TOLERANCE) from the reference */
+bool lv_test_assert_image_eq_tolerance(const char * fn_ref, uint8_t tolerance);
+
 
 #if LV_COLOR_DEPTH != 32
 #  define TEST_ASSERT_EQUAL_SCREENSHOT(path)                TEST_IGNORE_MESSAGE("Requires LV_COLOR_DEPTH 32");
 #  define TEST_ASSERT_EQUAL_SCREENSHOT_MESSAGE(path, msg)   TEST_PRINTF(msg); TEST_IGNORE_MESSAGE("Requires LV_COLOR_DEPTH 32");
+#  define TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE(path, tolerance)   TEST_IGNORE_MESSAGE("Requires LV_COLOR_DEPTH 32");
 #else
 
 #  define TEST_ASSERT_EQUAL_SCREENSHOT(path)                if(LV_HOR_RES != 800 || LV_VER_RES != 480) {          \
@@ -30,6 +34,12 @@ bool lv_test_assert_image_eq(const char * fn_ref);
     } else {                                                  \
         TEST_ASSERT_MESSAGE(lv_test_assert_image_eq(path), msg);  \
     }
+
+#  define TEST_ASSERT_EQUAL_SCREENSHOT_TOLERANCE(path, tolerance)  if(LV_HOR_RES != 800 || LV_VER_RES != 480) {    \
+        TEST_IGNORE_MESSAGE("Requires 800x480 resolution");                 \
+    } else {                                                              \
+        TEST_ASSERT_MESSAGE(lv_test_assert_image_eq_tolerance(path, tolerance), path);  \
+    }
 #endif
 
 #  define TEST_ASSERT_EQUAL_COLOR(c1, c2)                   TEST_ASSERT_TRUE(lv_color_eq(c1, c2))
@@ -0,0 +1,160 @@
+#include "blend_bench.h"
+
+#if BLEND_BENCH
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "lvgl_private.h"
+#include "draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+
+// Mäter LVGL:s RGB565 blend-kärnor i CPU-cykler på målet.
+// Aktiveras med -D BLEND_BENCH=1 (se platformio.ini). Använder bara
+// lv_draw_sw_blend_color/image_to_rgb565 så att samma fil kan byggas
+// mot en äldre LVGL för att jämföra före/efter.
+
+// 1. KONFIGURATION
+// Samma bredd som displayens buffert, färre rader för att spara RAM
+#define BENCH_W        240
+#define BENCH_H        40
+#define BENCH_ROUNDS   10
+
+static const char * TAG = "blend_bench";
+
+typedef enum {
+    CASE_COVER,
+    CASE_OPA,
+    CASE_MASK,
+    CASE_MASK_OPA,
+} bench_case_t;
+
+static const char * case_names[] = {"cover", "opa", "mask", "mask+opa"};
+
+static uint8_t * dest_buf;
+static uint8_t * src_buf;
+static lv_opa_t * mask_buf;
+
+// 2. HJÄLPFUNKTIONER
+// Fyller buffertarna med ett mönster som har både genomskinliga, halvgenomskinliga och täckande pixlar
+static void fill_pattern(void) {
+    uint32_t i;
+    for(i = 0; i < BENCH_W * BENCH_H * 4; i++) src_buf[i] = (uint8_t)(i * 7 + (i >> 8));
+    for(i = 0; i < BENCH_W * BENCH_H * 2; i++) dest_buf[i] = (uint8_t)(i * 13);
+    for(i = 0; i < BENCH_W * BENCH_H; i++) {
+        uint32_t x = i % BENCH_W;
+        mask_buf[i] = x < 80 ? LV_OPA_TRANSP : x < 160 ? LV_OPA_COVER : (lv_opa_t)(x * 3);
+    }
+}
+
+static void fill_dsc_init(lv_draw_sw_blend_fill_dsc_t * dsc, bench_case_t c) {
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest_buf;
+    dsc->dest_w = BENCH_W;
+    dsc->dest_h = BENCH_H;
+    dsc->dest_stride = BENCH_W * 2;
+    dsc->color = lv_color_hex(0x3080c0);
+    dsc->opa = (c == CASE_OPA || c == CASE_MASK_OPA) ? LV_OPA_50 : LV_OPA_COVER;
+    dsc->mask_buf = (c == CASE_MASK || c == CASE_MASK_OPA) ? mask_buf : NULL;
+    dsc->mask_stride = BENCH_W;
+    lv_area_set(&dsc->relative_area, 0, 0, BENCH_W - 1, BENCH_H - 1);
+}
+
+static void image_dsc_init(lv_draw_sw_blend_image_dsc_t * dsc, bench_case_t c, lv_color_format_t cf,
+                           lv_blend_mode_t mode) {
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest_buf;
+    dsc->dest_w = BENCH_W;
+    dsc->dest_h = BENCH_H;
+    dsc->dest_stride = BENCH_W * 2;
+    dsc->src_buf = src_buf;
+    dsc->src_stride = BENCH_W * lv_color_format_get_size(cf);
+    dsc->src_color_format = cf;
+    dsc->blend_mode = mode;
+    dsc->opa = (c == CASE_OPA || c == CASE_MASK_OPA) ? LV_OPA_50 : LV_OPA_COVER;
+    dsc->mask_buf = (c == CASE_MASK || c == CASE_MASK_OPA) ? mask_buf : NULL;
+    dsc->mask_stride = BENCH_W;
+    lv_area_set(&dsc->relative_area, 0, 0, BENCH_W - 1, BENCH_H - 1);
+    dsc->src_area = dsc->relative_area;
+}
+
+// Bästa av flera körningar för att slippa störningar från avbrott och cache-missar
+static uint32_t measure_fill(bench_case_t c) {
+    uint32_t best = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < BENCH_ROUNDS; r++) {
+        lv_draw_sw_blend_fill_dsc_t dsc;
+        fill_dsc_init(&dsc, c);
+        uint32_t start = esp_cpu_get_cycle_count();
+        lv_draw_sw_blend_color_to_rgb565(&dsc);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        if(cycles < best) best = cycles;
+    }
+    return best;
+}
+
+static uint32_t measure_image(bench_case_t c, lv_color_format_t cf, lv_blend_mode_t mode) {
+    uint32_t best = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < BENCH_ROUNDS; r++) {
+        lv_draw_sw_blend_image_dsc_t dsc;
+        image_dsc_init(&dsc, c, cf, mode);
+        uint32_t start = esp_cpu_get_cycle_count();
+        lv_draw_sw_blend_image_to_rgb565(&dsc);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        if(cycles < best) best = cycles;
+    }
+    return best;
+}
+
+// 3. BENCHMARK
+// Skriver ut cykler per anrop och cykler per pixel (x100) för varje kärna
+void blend_bench_run(void) {
+    dest_buf = malloc(BENCH_W * BENCH_H * 2);
+    src_buf = malloc(BENCH_W * BENCH_H * 4);
+    mask_buf = malloc(BENCH_W * BENCH_H);
+    if(dest_buf == NULL || src_buf == NULL || mask_buf == NULL) {
+        ESP_LOGE(TAG, "Not enough memory");
+        goto out;
+    }
+
+    fill_pattern();
+
+    static const struct {
+        const char * name;
+        lv_color_format_t cf;
+        lv_blend_mode_t mode;
+    } images[] = {
+        {"RGB565 normal", LV_COLOR_FORMAT_RGB565, LV_BLEND_MODE_NORMAL},
+        {"RGB565 additive", LV_COLOR_FORMAT_RGB565, LV_BLEND_MODE_ADDITIVE},
+        {"RGB565 multiply", LV_COLOR_FORMAT_RGB565, LV_BLEND_MODE_MULTIPLY},
+        {"RGB888 normal", LV_COLOR_FORMAT_RGB888, LV_BLEND_MODE_NORMAL},
+        {"XRGB8888 normal", LV_COLOR_FORMAT_XRGB8888, LV_BLEND_MODE_NORMAL},
+        {"ARGB8888 normal", LV_COLOR_FORMAT_ARGB8888, LV_BLEND_MODE_NORMAL},
+    };
+
+    const uint32_t px = BENCH_W * BENCH_H;
+    ESP_LOGI(TAG, "%dx%d px, best of %d, cycles (cycles/px x100)", BENCH_W, BENCH_H, BENCH_ROUNDS);
+
+    bench_case_t c;
+    for(c = CASE_COVER; c <= CASE_MASK_OPA; c++) {
+        uint32_t cycles = measure_fill(c);
+        ESP_LOGI(TAG, "fill %-8s: %8" PRIu32 " (%" PRIu32 ")", case_names[c], cycles, cycles * 100 / px);
+    }
+
+    uint32_t i;
+    for(i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        for(c = CASE_COVER; c <= CASE_MASK_OPA; c++) {
+            uint32_t cycles = measure_image(c, images[i].cf, images[i].mode);
+            ESP_LOGI(TAG, "%s %-8s: %8" PRIu32 " (%" PRIu32 ")", images[i].name, case_names[c], cycles,
+                     cycles * 100 / px);
+        }
+    }
+
+out:
+    free(dest_buf);
+    free(src_buf);
+    free(mask_buf);
+}
+
+#endif // BLEND_BENCH
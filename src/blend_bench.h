@@ -0,0 +1,8 @@
+#ifndef BLEND_BENCH_H
+#define BLEND_BENCH_H
+
+#include "lvgl.h"
+
+void blend_bench_run(void);
+
+#endif
@@ -1,15 +1,26 @@
 #include "display.h"
+#include "blend_bench.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+// Genereras av lv_font_subset() i CMakeLists.txt med bara tecknen i main.c
+LV_FONT_DECLARE(app_font_14)
+
 void app_main(void) {
     // Display initiering
     display_init();
 
+#if BLEND_BENCH
+    // Mäter blend-kärnorna innan UI:t skapas
+    blend_bench_run();
+#endif
+
     // UI-DESIGN
     // Hämtar den aktiva skärmen och sätter bakgrundsfärg
     lv_obj_t *scr = lv_screen_active();
     lv_obj_set_style_bg_color(scr, lv_palette_main(LV_PALETTE_AMBER), 0);
+    // Ärvs av alla etiketter på skärmen
+    lv_obj_set_style_text_font(scr, &app_font_14, 0);
 
     // UI: Lable "text"
     lv_obj_t *label = lv_label_create(scr);